@@ -0,0 +1,458 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "block_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/*
+ * The free blocks are kept in a singly linked list threaded through the first
+ * word of each block, so taking or giving back a block is a push or a pop on
+ * the head of the list.  Both are done with interrupts masked, which is only
+ * for a few instructions.
+ */
+typedef struct xBlockPoolDefinition
+{
+	void * volatile pvFreeList;						/*< First free block, each free block holds a pointer to the next. */
+	uint8_t *pucStorage;							/*< First block of the pool. */
+	size_t xBlockSize;								/*< Size of each block, rounded up by blockpoolBLOCK_SIZE(). */
+	UBaseType_t uxBlockCount;						/*< Number of blocks in the pool. */
+	volatile UBaseType_t uxFreeBlocks;				/*< Number of blocks in the free list. */
+	UBaseType_t uxMinimumFreeBlocks;				/*< Lowest uxFreeBlocks has been, for the high water mark. */
+	UBaseType_t uxFailures;							/*< Allocations that returned NULL. */
+	EventList_t xTasksWaitingForBlock;				/*< Tasks blocked on an empty pool, in priority order. */
+	uint8_t ucStaticallyAllocated;					/*< pdTRUE if created by xBlockPoolCreateStatic(), so not freed on delete. */
+
+} BlockPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Lay the blocks out in the free list and clear the counters.
+ */
+static void prvInitialiseNewBlockPool( BlockPool_t * const pxBlockPool, size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucStorage );
+
+/*
+ * Pop a block from the free list, or count a failure if there is none.  Must
+ * be called with interrupts masked.
+ */
+static void *prvTakeBlock( BlockPool_t * const pxBlockPool );
+
+/*
+ * Push a block on the free list.  Must be called with interrupts masked.
+ */
+static void prvGiveBlock( BlockPool_t * const pxBlockPool, void *pvBlock );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount )
+	{
+	BlockPool_t *pxBlockPool;
+	size_t xStructSize;
+
+		configASSERT( xBlockSize > 0 );
+		configASSERT( uxBlockCount > 0 );
+
+		/* The blocks follow the structure, which is padded so the first block is
+		aligned. */
+		xStructSize = ( sizeof( BlockPool_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		pxBlockPool = ( BlockPool_t * ) pvPortMalloc( xStructSize + blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) ); /*lint !e9079 Block pool is stored after the structure. */
+
+		if( pxBlockPool != NULL )
+		{
+			prvInitialiseNewBlockPool( pxBlockPool, xBlockSize, uxBlockCount, ( ( uint8_t * ) pxBlockPool ) + xStructSize );
+			pxBlockPool->ucStaticallyAllocated = ( uint8_t ) pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( BlockPoolHandle_t ) pxBlockPool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize, UBaseType_t uxBlockCount, void *pvPoolStorage, StaticBlockPool_t *pxStaticBlockPool )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) pxStaticBlockPool; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+	configASSERT( xBlockSize > 0 );
+	configASSERT( uxBlockCount > 0 );
+	configASSERT( pvPoolStorage );
+	configASSERT( pxStaticBlockPool );
+	configASSERT( ( ( ( size_t ) pvPoolStorage ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+
+	/* The dummy structure in block_pool.h must be the size of the real one. */
+	configASSERT( sizeof( StaticBlockPool_t ) == sizeof( BlockPool_t ) );
+
+	prvInitialiseNewBlockPool( pxBlockPool, xBlockSize, uxBlockCount, ( uint8_t * ) pvPoolStorage );
+	pxBlockPool->ucStaticallyAllocated = ( uint8_t ) pdTRUE;
+
+	return ( BlockPoolHandle_t ) pxBlockPool;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolDelete( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+
+	configASSERT( pxBlockPool );
+	configASSERT( listEVENT_LIST_IS_EMPTY( &( pxBlockPool->xTasksWaitingForBlock ) ) != pdFALSE );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( pxBlockPool->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( ( void * ) pxBlockPool );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+void *pvBlockPoolAlloc( BlockPoolHandle_t xBlockPool, TickType_t xTicksToWait )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+void *pvBlock;
+
+	configASSERT( pxBlockPool );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( pxBlockPool->pvFreeList != NULL ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+			{
+				/* NULL and a failure counted if the task is not to wait. */
+				pvBlock = prvTakeBlock( pxBlockPool );
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Block until vBlockPoolFree() moves the task back to a ready
+				list or the time runs out.  The task is no longer ready once
+				on the event list, so the yield below happens even if a block
+				is freed by an interrupt between leaving the critical section
+				and yielding. */
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					vTaskPlaceOnEventList( &( pxBlockPool->xTasksWaitingForBlock ), xTicksToWait );
+					pvBlock = NULL;
+				}
+				else
+				{
+					xTicksToWait = ( TickType_t ) 0;
+					pvBlock = prvTakeBlock( pxBlockPool );
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( ( pvBlock != NULL ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+		{
+			break;
+		}
+
+		/* Only reached after the task was placed on the event list. */
+		portYIELD_WITHIN_API();
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void *pvBlockPoolAllocFromISR( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+UBaseType_t uxSavedInterruptStatus;
+void *pvBlock;
+
+	configASSERT( pxBlockPool );
+
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pvBlock = prvTakeBlock( pxBlockPool );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFree( BlockPoolHandle_t xBlockPool, void *pvBlock )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxBlockPool );
+
+	taskENTER_CRITICAL();
+	{
+		prvGiveBlock( pxBlockPool, pvBlock );
+
+		if( listEVENT_LIST_IS_EMPTY( &( pxBlockPool->xTasksWaitingForBlock ) ) == pdFALSE )
+		{
+			xYieldRequired = xTaskRemoveFromEventList( &( pxBlockPool->xTasksWaitingForBlock ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xYieldRequired != pdFALSE )
+	{
+		portYIELD_WITHIN_API();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFreeFromISR( BlockPoolHandle_t xBlockPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxBlockPool );
+
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		prvGiveBlock( pxBlockPool, pvBlock );
+
+		/* xTaskRemoveFromEventList() puts the task on the pending ready list
+		if the scheduler is suspended. */
+		if( listEVENT_LIST_IS_EMPTY( &( pxBlockPool->xTasksWaitingForBlock ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxBlockPool->xTasksWaitingForBlock ) ) != pdFALSE )
+			{
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBlockPoolGetFreeBlocks( BlockPoolHandle_t xBlockPool )
+{
+	configASSERT( xBlockPool );
+
+	return ( ( BlockPool_t * ) xBlockPool )->uxFreeBlocks;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBlockPoolGetHighWaterMark( BlockPoolHandle_t xBlockPool )
+{
+BlockPool_t * const pxBlockPool = ( BlockPool_t * ) xBlockPool;
+
+	configASSERT( pxBlockPool );
+
+	return pxBlockPool->uxBlockCount - pxBlockPool->uxMinimumFreeBlocks;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBlockPoolGetFailures( BlockPoolHandle_t xBlockPool )
+{
+	configASSERT( xBlockPool );
+
+	return ( ( BlockPool_t * ) xBlockPool )->uxFailures;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewBlockPool( BlockPool_t * const pxBlockPool, size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucStorage )
+{
+UBaseType_t ux;
+uint8_t *pucBlock;
+
+	pxBlockPool->xBlockSize = blockpoolBLOCK_SIZE( xBlockSize );
+	pxBlockPool->uxBlockCount = uxBlockCount;
+	pxBlockPool->pucStorage = pucStorage;
+
+	/* Chain the blocks in address order, the last one ending the list. */
+	pucBlock = pucStorage;
+	for( ux = ( UBaseType_t ) 1; ux < uxBlockCount; ux++ )
+	{
+		*( ( void ** ) pucBlock ) = ( void * ) ( pucBlock + pxBlockPool->xBlockSize ); /*lint !e9087 !e826 Blocks are aligned to hold a pointer. */
+		pucBlock += pxBlockPool->xBlockSize;
+	}
+	*( ( void ** ) pucBlock ) = NULL; /*lint !e9087 !e826 Blocks are aligned to hold a pointer. */
+
+	pxBlockPool->pvFreeList = ( void * ) pucStorage;
+	pxBlockPool->uxFreeBlocks = uxBlockCount;
+	pxBlockPool->uxMinimumFreeBlocks = uxBlockCount;
+	pxBlockPool->uxFailures = ( UBaseType_t ) 0;
+
+	vEventListInitialise( &( pxBlockPool->xTasksWaitingForBlock ) );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTakeBlock( BlockPool_t * const pxBlockPool )
+{
+void *pvBlock = pxBlockPool->pvFreeList;
+
+	if( pvBlock != NULL )
+	{
+		pxBlockPool->pvFreeList = *( ( void ** ) pvBlock ); /*lint !e9087 Free blocks hold the next free block. */
+		pxBlockPool->uxFreeBlocks--;
+
+		if( pxBlockPool->uxFreeBlocks < pxBlockPool->uxMinimumFreeBlocks )
+		{
+			pxBlockPool->uxMinimumFreeBlocks = pxBlockPool->uxFreeBlocks;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		pxBlockPool->uxFailures++;
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGiveBlock( BlockPool_t * const pxBlockPool, void *pvBlock )
+{
+	/* The block must be one of this pool, and the pool can not already hold
+	all its blocks. */
+	configASSERT( ( ( uint8_t * ) pvBlock >= pxBlockPool->pucStorage ) && ( ( uint8_t * ) pvBlock < ( pxBlockPool->pucStorage + ( pxBlockPool->xBlockSize * ( size_t ) pxBlockPool->uxBlockCount ) ) ) );
+	configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBlock - pxBlockPool->pucStorage ) % pxBlockPool->xBlockSize ) == 0 );
+	configASSERT( pxBlockPool->uxFreeBlocks < pxBlockPool->uxBlockCount );
+
+	*( ( void ** ) pvBlock ) = pxBlockPool->pvFreeList; /*lint !e9087 Free blocks hold the next free block. */
+	pxBlockPool->pvFreeList = pvBlock;
+	pxBlockPool->uxFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
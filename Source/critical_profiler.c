@@ -0,0 +1,362 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not
+configured to include the critical section profiler. */
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+/* Everything is accessed with interrupts masked: the port calls in from its
+critical section functions, the functions called by the application enter a
+critical section of their own. */
+PRIVILEGED_DATA static CriticalProfilerSite_t xSites[ configCRITICAL_PROFILER_SITES ];
+PRIVILEGED_DATA static CriticalProfilerStats_t xStats;
+
+/* The section being timed, if xInSection is set. */
+PRIVILEGED_DATA static BaseType_t xInSection = pdFALSE;
+PRIVILEGED_DATA static uint32_t ulSectionStart = 0UL;
+PRIVILEGED_DATA static uint32_t ulSectionCaller = 0UL;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add the section being timed, of ulDuration counts, to the counters.
+ */
+static void prvRecordSection( uint32_t ulDuration );
+
+/*
+ * Return the index in the table of callers of the caller of the section
+ * being timed, taking an entry for it if there is a free one or if the
+ * section is longer than the shortest worst case of the table, or
+ * configCRITICAL_PROFILER_SITES if the caller is not kept.
+ */
+static UBaseType_t prvGetSite( uint32_t ulDuration );
+
+/*
+ * Return the bucket of the duration histogram of a section of ulDuration
+ * counts.
+ */
+static UBaseType_t prvGetBucket( uint32_t ulDuration );
+
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerEnter( uint32_t ulCaller )
+{
+	ulSectionCaller = ulCaller;
+	xInSection = pdTRUE;
+
+	/* Stamped last so the profiler is not in the figures. */
+	ulSectionStart = configCRITICAL_PROFILER_GET_TIME();
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerExit( void )
+{
+uint32_t ulEnd;
+
+	ulEnd = configCRITICAL_PROFILER_GET_TIME();
+
+	if( xInSection != pdFALSE )
+	{
+		prvRecordSection( ulEnd - ulSectionStart );
+	}
+	else
+	{
+		/* The section was ended by a context switch, or the counters were
+		cleared inside it. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerTaskSwitched( void )
+{
+uint32_t ulEnd;
+
+	ulEnd = configCRITICAL_PROFILER_GET_TIME();
+
+	if( xInSection != pdFALSE )
+	{
+		xStats.ulSwitched++;
+		prvRecordSection( ulEnd - ulSectionStart );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerGetStats( CriticalProfilerStats_t *pxStats )
+{
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		*pxStats = xStats;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCriticalProfilerGetSite( UBaseType_t uxIndex, CriticalProfilerSite_t *pxSite )
+{
+BaseType_t xReturn = pdFALSE;
+
+	configASSERT( pxSite );
+
+	taskENTER_CRITICAL();
+	{
+		if( uxIndex < xStats.uxSites )
+		{
+			*pxSite = xSites[ uxIndex ];
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerReset( void )
+{
+UBaseType_t ux;
+
+	taskENTER_CRITICAL();
+	{
+		xStats.ulCount = 0;
+		xStats.ulMax = 0;
+		xStats.ulMaxCaller = 0;
+		xStats.ullTotal = 0;
+
+		for( ux = 0; ux < ( UBaseType_t ) criticalprofilerBUCKETS; ux++ )
+		{
+			xStats.ulCounts[ ux ] = 0;
+		}
+
+		xStats.uxSites = 0;
+		xStats.ulLostSections = 0;
+		xStats.ulSwitched = 0;
+
+		/* The section of this function is not counted. */
+		xInSection = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordSection( uint32_t ulDuration )
+{
+UBaseType_t uxSite;
+CriticalProfilerSite_t *pxSite;
+
+	xInSection = pdFALSE;
+
+	xStats.ulCount++;
+	xStats.ullTotal += ulDuration;
+	xStats.ulCounts[ prvGetBucket( ulDuration ) ]++;
+
+	if( ( ulDuration > xStats.ulMax ) || ( xStats.ulCount == 1UL ) )
+	{
+		xStats.ulMax = ulDuration;
+		xStats.ulMaxCaller = ulSectionCaller;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxSite = prvGetSite( ulDuration );
+
+	if( uxSite < ( UBaseType_t ) configCRITICAL_PROFILER_SITES )
+	{
+		pxSite = &( xSites[ uxSite ] );
+		pxSite->ulCount++;
+		pxSite->ullTotal += ulDuration;
+
+		if( ulDuration > pxSite->ulMax )
+		{
+			pxSite->ulMax = ulDuration;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		xStats.ulLostSections++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetSite( uint32_t ulDuration )
+{
+UBaseType_t ux, uxShortest;
+BaseType_t xTake = pdFALSE;
+
+	for( ux = 0; ux < xStats.uxSites; ux++ )
+	{
+		if( xSites[ ux ].ulCaller == ulSectionCaller )
+		{
+			break;
+		}
+	}
+
+	if( ux < xStats.uxSites )
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	else if( xStats.uxSites < ( UBaseType_t ) configCRITICAL_PROFILER_SITES )
+	{
+		xStats.uxSites++;
+		xTake = pdTRUE;
+	}
+	else
+	{
+		uxShortest = 0;
+
+		for( ux = 1; ux < ( UBaseType_t ) configCRITICAL_PROFILER_SITES; ux++ )
+		{
+			if( xSites[ ux ].ulMax < xSites[ uxShortest ].ulMax )
+			{
+				uxShortest = ux;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( ulDuration > xSites[ uxShortest ].ulMax )
+		{
+			/* The sections of the caller that loses its entry are no longer
+			in the table. */
+			xStats.ulLostSections += xSites[ uxShortest ].ulCount;
+			ux = uxShortest;
+			xTake = pdTRUE;
+		}
+		else
+		{
+			ux = ( UBaseType_t ) configCRITICAL_PROFILER_SITES;
+		}
+	}
+
+	if( xTake != pdFALSE )
+	{
+		xSites[ ux ].ulCaller = ulSectionCaller;
+		xSites[ ux ].ulCount = 0;
+		xSites[ ux ].ulMax = 0;
+		xSites[ ux ].ullTotal = 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ux;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetBucket( uint32_t ulDuration )
+{
+UBaseType_t uxBucket = 0;
+
+	while( ( ulDuration >>= 1 ) != 0UL )
+	{
+		uxBucket++;
+	}
+
+	return uxBucket;
+}
+
+#endif /* configUSE_CRITICAL_PROFILER */
+
@@ -74,6 +74,12 @@
 /* Remove the whole file is co-routines are not being used. */
 #if( configUSE_CO_ROUTINES != 0 )
 
+/* Co-routines share the event lists of the queues with the tasks, a bucketed
+event list has one bucket per task priority. */
+#if( ( configUSE_EVENT_LIST_BUCKETS == 1 ) && ( configMAX_CO_ROUTINE_PRIORITIES > configMAX_PRIORITIES ) )
+	#error configMAX_CO_ROUTINE_PRIORITIES cannot be greater than configMAX_PRIORITIES when configUSE_EVENT_LIST_BUCKETS is 1.
+#endif
+
 /*
  * Some kernel aware debuggers require data to be viewed to be global, rather
  * than file scope.
@@ -141,64 +147,69 @@ static void prvCheckDelayedList( void );
 
 /*-----------------------------------------------------------*/
 
-BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
-{
-BaseType_t xReturn;
-CRCB_t *pxCoRoutine;
+/* Co-routine control blocks are only ever allocated from the heap. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* Allocate the memory that will store the co-routine control block. */
-	pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
-	if( pxCoRoutine )
+	BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
 	{
-		/* If pxCurrentCoRoutine is NULL then this is the first co-routine to
-		be created and the co-routine data structures need initialising. */
-		if( pxCurrentCoRoutine == NULL )
-		{
-			pxCurrentCoRoutine = pxCoRoutine;
-			prvInitialiseCoRoutineLists();
-		}
+	BaseType_t xReturn;
+	CRCB_t *pxCoRoutine;
 
-		/* Check the priority is within limits. */
-		if( uxPriority >= configMAX_CO_ROUTINE_PRIORITIES )
+		/* Allocate the memory that will store the co-routine control block. */
+		pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
+		if( pxCoRoutine )
 		{
-			uxPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
-		}
+			/* If pxCurrentCoRoutine is NULL then this is the first co-routine to
+			be created and the co-routine data structures need initialising. */
+			if( pxCurrentCoRoutine == NULL )
+			{
+				pxCurrentCoRoutine = pxCoRoutine;
+				prvInitialiseCoRoutineLists();
+			}
 
-		/* Fill out the co-routine control block from the function parameters. */
-		pxCoRoutine->uxState = corINITIAL_STATE;
-		pxCoRoutine->uxPriority = uxPriority;
-		pxCoRoutine->uxIndex = uxIndex;
-		pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
+			/* Check the priority is within limits. */
+			if( uxPriority >= configMAX_CO_ROUTINE_PRIORITIES )
+			{
+				uxPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
+			}
 
-		/* Initialise all the other co-routine control block parameters. */
-		vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
-		vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
+			/* Fill out the co-routine control block from the function parameters. */
+			pxCoRoutine->uxState = corINITIAL_STATE;
+			pxCoRoutine->uxPriority = uxPriority;
+			pxCoRoutine->uxIndex = uxIndex;
+			pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
 
-		/* Set the co-routine control block as a link back from the ListItem_t.
-		This is so we can get back to the containing CRCB from a generic item
-		in a list. */
-		listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xGenericListItem ), pxCoRoutine );
-		listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
+			/* Initialise all the other co-routine control block parameters. */
+			vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
+			vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
 
-		/* Event lists are always in priority order. */
-		listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+			/* Set the co-routine control block as a link back from the ListItem_t.
+			This is so we can get back to the containing CRCB from a generic item
+			in a list. */
+			listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xGenericListItem ), pxCoRoutine );
+			listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
 
-		/* Now the co-routine has been initialised it can be added to the ready
-		list at the correct priority. */
-		prvAddCoRoutineToReadyQueue( pxCoRoutine );
+			/* Event lists are always in priority order. */
+			listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
 
-		xReturn = pdPASS;
-	}
-	else
-	{
-		xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			/* Now the co-routine has been initialised it can be added to the ready
+			list at the correct priority. */
+			prvAddCoRoutineToReadyQueue( pxCoRoutine );
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+		}
+
+		return xReturn;
 	}
 
-	return xReturn;
-}
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList )
+void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, EventList_t *pxEventList )
 {
 TickType_t xTimeToWake;
 
@@ -231,7 +242,7 @@ TickType_t xTimeToWake;
 	{
 		/* Also add the co-routine to an event list.  If this is done then the
 		function must be called with interrupts disabled. */
-		vListInsert( pxEventList, &( pxCurrentCoRoutine->xEventListItem ) );
+		vEventListInsert( pxEventList, &( pxCurrentCoRoutine->xEventListItem ), pxCurrentCoRoutine->uxPriority );
 	}
 }
 /*-----------------------------------------------------------*/
@@ -367,7 +378,7 @@ UBaseType_t uxPriority;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xCoRoutineRemoveFromEventList( const List_t *pxEventList )
+BaseType_t xCoRoutineRemoveFromEventList( EventList_t *pxEventList )
 {
 CRCB_t *pxUnblockedCRCB;
 BaseType_t xReturn;
@@ -375,7 +386,7 @@ BaseType_t xReturn;
 	/* This function is called from within an interrupt.  It can only access
 	event lists and the pending ready list.  This function assumes that a
 	check has already been made to ensure pxEventList is not empty. */
-	pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+	pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HIGHEST_EVENT_ENTRY( pxEventList );
 	( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
 	vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
 
@@ -87,11 +87,11 @@ header files above, but not in this file, in order to generate the correct
 privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
 
-#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( configUSE_TIMERS == 0 )
+#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( configUSE_TIMERS == 0 ) && ( configUSE_EVENT_GROUP_DIRECT_ISR == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xEventGroupSetBitFromISR() function available.
 #endif
 
-#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 0 )
+#if ( INCLUDE_xEventGroupSetBitFromISR == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 0 ) && ( configUSE_EVENT_GROUP_DIRECT_ISR == 0 )
 	#error INCLUDE_xTimerPendFunctionCall must also be set to one to make the xEventGroupSetBitFromISR() function available.
 #endif
 
@@ -103,24 +103,51 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x0200U
 	#define eventWAIT_FOR_ALL_BITS			0x0400U
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff00U
+	#define eventNUM_BITS					8
 #else
 	#define eventCLEAR_EVENTS_ON_EXIT_BIT	0x01000000UL
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x02000000UL
 	#define eventWAIT_FOR_ALL_BITS			0x04000000UL
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
+	#define eventNUM_BITS					24
 #endif
 
 typedef struct xEventGroupDefinition
 {
 	EventBits_t uxEventBits;
-	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		List_t xTasksWaitingForBits[ eventNUM_BITS ];	/*< Tasks waiting for bits to be set, each in the list of the lowest bit it waits for. */
+		EventBits_t uxBitsWaitedFor[ eventNUM_BITS ];	/*< Bits waited for by the tasks of each list, possibly by tasks that have since timed out. */
+	#else
+		List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
+	#endif
+
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		volatile UBaseType_t uxLocks;			/*< Non zero while a task accesses the bits or the waiting tasks with the scheduler suspended. */
+		volatile EventBits_t uxPendingBits;		/*< Bits set from interrupts while the event group was locked. */
+		volatile EventBits_t uxPendingClear;	/*< Bits cleared from interrupts while the event group was locked, after uxPendingBits. */
+	#endif
 
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
 	#endif
 
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated;		/*< Set to pdTRUE if the event group was created by xEventGroupCreateStatic(), so it is not freed if it is deleted. */
+	#endif
+
 } EventGroup_t;
 
+/* Lists of waiting tasks of an event group. */
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	#define eventWAIT_LISTS								eventNUM_BITS
+	#define eventGET_WAIT_LIST( pxEventBits, uxList )	( &( ( pxEventBits )->xTasksWaitingForBits[ ( uxList ) ] ) )
+#else
+	#define eventWAIT_LISTS								1
+	#define eventGET_WAIT_LIST( pxEventBits, uxList )	( &( ( pxEventBits )->xTasksWaitingForBits ) )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -133,25 +160,145 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits );
 
+/*
+ * Called after an event group has been created, statically or dynamically, to
+ * set up its members.
+ */
+static void prvInitialiseNewEventGroup( EventGroup_t *pxEventBits );
+
+/*
+ * Return the list of waiting tasks a task waiting for uxBitsToWaitFor is placed
+ * in.  Must be called with the scheduler suspended and the event group locked.
+ */
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor );
+
+/*
+ * Set bits in the event group and unblock the tasks whose wait condition is
+ * then met.  Called either with the scheduler suspended and the event group
+ * locked, or from xEventGroupSetBitsFromISR() with interrupts masked and the
+ * event group not locked.  Returns pdTRUE if a task of a higher priority than
+ * the running task was unblocked.
+ */
+static BaseType_t prvSetBits( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR );
+
+/*
+ * Test the tasks of one list of waiting tasks against the event bits (see
+ * prvSetBits()).  The bits of the tasks that are unblocked and clear their bits
+ * on exit are added to *puxBitsToClear.  Returns the bits still waited for by
+ * the tasks left in the list.
+ */
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t *pxEventBits, List_t *pxList, EventBits_t *puxBitsToClear, BaseType_t *pxHigherPriorityTaskWoken, const BaseType_t xFromISR );
+
+/*
+ * Interrupts can set and clear the bits of an event group directly, as long as
+ * no task is accessing it.  A task locks the event group while it accesses it
+ * with the scheduler suspended, the bits set and cleared by interrupts in the
+ * meantime are then applied when the event group is unlocked.  The locks nest.
+ */
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	#define prvLockEventGroup( pxEventBits )		\
+		taskENTER_CRITICAL();						\
+		{											\
+			( ( pxEventBits )->uxLocks )++;			\
+		}											\
+		taskEXIT_CRITICAL()
+
+	static void prvUnlockEventGroup( EventGroup_t *pxEventBits );
+
+#else
+
+	#define prvLockEventGroup( pxEventBits )
+	#define prvUnlockEventGroup( pxEventBits )
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	EventGroupHandle_t xEventGroupCreate( void )
+	{
+	EventGroup_t *pxEventBits;
+
+		pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
+		if( pxEventBits != NULL )
+		{
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* The event group can be freed if it is deleted. */
+				pxEventBits->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseNewEventGroup( pxEventBits );
+		}
+		else
+		{
+			traceEVENT_GROUP_CREATE_FAILED();
+		}
+
+		return ( EventGroupHandle_t ) pxEventBits;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-EventGroupHandle_t xEventGroupCreate( void )
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer )
+	{
+	EventGroup_t *pxEventBits;
+
+		configASSERT( pxEventGroupBuffer != NULL );
+
+		/* The dummy structure in event_groups.h must be the size of the real
+		event group structure. */
+		configASSERT( sizeof( StaticEventGroup_t ) == sizeof( EventGroup_t ) );
+
+		pxEventBits = ( EventGroup_t * ) pxEventGroupBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			/* The event group must not be freed if it is deleted. */
+			pxEventBits->ucStaticallyAllocated = pdTRUE;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+		prvInitialiseNewEventGroup( pxEventBits );
+
+		return ( EventGroupHandle_t ) pxEventBits;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewEventGroup( EventGroup_t *pxEventBits )
 {
-EventGroup_t *pxEventBits;
+UBaseType_t uxList;
+
+	pxEventBits->uxEventBits = 0;
 
-	pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
-	if( pxEventBits != NULL )
+	for( uxList = ( UBaseType_t ) 0; uxList < ( UBaseType_t ) eventWAIT_LISTS; uxList++ )
 	{
-		pxEventBits->uxEventBits = 0;
-		vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
-		traceEVENT_GROUP_CREATE( pxEventBits );
+		vListInitialise( eventGET_WAIT_LIST( pxEventBits, uxList ) );
+
+		#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		{
+			pxEventBits->uxBitsWaitedFor[ uxList ] = 0;
+		}
+		#endif
 	}
-	else
+
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
 	{
-		traceEVENT_GROUP_CREATE_FAILED();
+		pxEventBits->uxLocks = ( UBaseType_t ) 0U;
+		pxEventBits->uxPendingBits = 0;
+		pxEventBits->uxPendingClear = 0;
 	}
+	#endif
 
-	return ( EventGroupHandle_t ) pxEventBits;
+	traceEVENT_GROUP_CREATE( pxEventBits );
 }
 /*-----------------------------------------------------------*/
 
@@ -171,6 +318,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -196,7 +344,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -212,6 +360,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			}
 		}
 	}
+	prvUnlockEventGroup( pxEventBits );
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -290,6 +439,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -346,7 +496,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -356,6 +506,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
 		}
 	}
+	prvUnlockEventGroup( pxEventBits );
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -446,7 +597,37 @@ EventBits_t uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxEventBits->uxLocks == ( UBaseType_t ) 0U )
+			{
+				pxEventBits->uxEventBits &= ~uxBitsToClear;
+			}
+			else
+			{
+				/* A task is accessing the event group, the bits are cleared
+				when it unlocks it. */
+				pxEventBits->uxPendingClear |= uxBitsToClear;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
 	{
@@ -479,116 +660,298 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
+		( void ) prvSetBits( pxEventBits, uxBitsToSet, pdFALSE );
+	}
+	prvUnlockEventGroup( pxEventBits );
+	( void ) xTaskResumeAll();
 
-		/* Set the bits. */
-		pxEventBits->uxEventBits |= uxBitsToSet;
+	return pxEventBits->uxEventBits;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSetBits( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR )
+{
+EventBits_t uxBitsToClear = 0;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* Set the bits. */
+	pxEventBits->uxEventBits |= uxBitsToSet;
 
-		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
+	/* See if the new bit value should unblock any tasks.  The wait condition
+	of a task that is still blocked was not met before this call, so only the
+	tasks waiting for one of the bits being set need to be tested. */
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	{
+	UBaseType_t uxBit;
+
+		/* A task is in the list of the lowest bit it waits for, so the lists
+		above the highest bit being set cannot hold a task waiting for it. */
+		for( uxBit = ( UBaseType_t ) 0; ( uxBitsToSet >> uxBit ) != ( EventBits_t ) 0; uxBit++ )
 		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
+			if( ( pxEventBits->uxBitsWaitedFor[ uxBit ] & uxBitsToSet ) != ( EventBits_t ) 0 )
+			{
+				pxEventBits->uxBitsWaitedFor[ uxBit ] = prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits[ uxBit ] ), &uxBitsToClear, &xHigherPriorityTaskWoken, xFromISR );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#else
+	{
+		( void ) prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxBitsToClear, &xHigherPriorityTaskWoken, xFromISR );
+	}
+	#endif
 
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+	/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+	bit was set in the control word. */
+	pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
 
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t *pxEventBits, List_t *pxList, EventBits_t *puxBitsToClear, BaseType_t *pxHigherPriorityTaskWoken, const BaseType_t xFromISR )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+EventBits_t uxBitsWaitedFor, uxControlBits, uxStillWaitedFor = 0;
+BaseType_t xMatchFound, xTaskWoken;
+
+	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	pxListItem = listGET_HEAD_ENTRY( pxList );
+
+	while( pxListItem != pxListEnd )
+	{
+		pxNext = listGET_NEXT( pxListItem );
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+		xMatchFound = pdFALSE;
+
+		/* Split the bits waited for from the control bits. */
+		uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+		if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		{
+			/* Just looking for single bit being set. */
+			if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
 			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+				xMatchFound = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+		{
+			/* All bits are set. */
+			xMatchFound = pdTRUE;
+		}
+		else
+		{
+			/* Need all bits to be set, but not all the bits were set. */
+		}
+
+		if( xMatchFound != pdFALSE )
+		{
+			/* The bits match.  Should the bits be cleared on exit? */
+			if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+			{
+				*puxBitsToClear |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Store the actual event flag value in the task's event list
+			item before removing the task from the event list.  The
+			eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+			that is was unblocked due to its required bits matching, rather
+			than because it timed out. */
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			{
+				if( xFromISR != pdFALSE )
 				{
-					xMatchFound = pdTRUE;
+					xTaskWoken = xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					xTaskWoken = xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
 				}
 			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+			#else
 			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
+				( void ) xFromISR;
+				xTaskWoken = xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+			}
+			#endif
+
+			if( xTaskWoken != pdFALSE )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
 			}
 			else
 			{
-				/* Need all bits to be set, but not all the bits were set. */
+				mtCOVERAGE_TEST_MARKER();
 			}
+		}
+		else
+		{
+			uxStillWaitedFor |= uxBitsWaitedFor;
+		}
+
+		/* Move onto the next list item.  Note pxListItem->pxNext is not
+		used here as the list item may have been removed from the event list
+		and inserted into the ready/pending reading list. */
+		pxListItem = pxNext;
+	}
+
+	return uxStillWaitedFor;
+}
+/*-----------------------------------------------------------*/
+
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsToWaitFor )
+{
+List_t *pxList;
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	{
+	UBaseType_t uxBit = ( UBaseType_t ) 0;
+
+		while( ( uxBitsToWaitFor & ( ( ( EventBits_t ) 1 ) << uxBit ) ) == ( EventBits_t ) 0 )
+		{
+			uxBit++;
+		}
+
+		pxEventBits->uxBitsWaitedFor[ uxBit ] |= uxBitsToWaitFor;
+		pxList = &( pxEventBits->xTasksWaitingForBits[ uxBit ] );
+	}
+	#else
+	{
+		( void ) uxBitsToWaitFor;
+		pxList = &( pxEventBits->xTasksWaitingForBits );
+	}
+	#endif
+
+	return pxList;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
 
-			if( xMatchFound != pdFALSE )
+	static void prvUnlockEventGroup( EventGroup_t *pxEventBits )
+	{
+	EventBits_t uxPendingBits, uxPendingClear;
+
+		/* Apply the bits set and cleared by interrupts while the event group
+		was locked, the event group staying locked meanwhile.  Interrupts can
+		add more, hence the loop. */
+		do
+		{
+			uxPendingBits = 0;
+			uxPendingClear = 0;
+
+			taskENTER_CRITICAL();
 			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+				if( pxEventBits->uxLocks == ( UBaseType_t ) 1U )
 				{
-					uxBitsToClear |= uxBitsWaitedFor;
+					uxPendingBits = pxEventBits->uxPendingBits;
+					uxPendingClear = pxEventBits->uxPendingClear;
+					pxEventBits->uxPendingBits = 0;
+					pxEventBits->uxPendingClear = 0;
+
+					if( ( uxPendingBits | uxPendingClear ) == ( EventBits_t ) 0 )
+					{
+						pxEventBits->uxLocks = ( UBaseType_t ) 0U;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* A nested lock, the outer one applies the pending bits. */
+					( pxEventBits->uxLocks )--;
 				}
+			}
+			taskEXIT_CRITICAL();
 
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+			if( uxPendingBits != ( EventBits_t ) 0 )
+			{
+				( void ) prvSetBits( pxEventBits, uxPendingBits, pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
-		}
+			/* Still locked, interrupts do not access the bits. */
+			pxEventBits->uxEventBits &= ~uxPendingClear;
 
-		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-		bit was set in the control word. */
-		pxEventBits->uxEventBits &= ~uxBitsToClear;
+		} while( ( uxPendingBits | uxPendingClear ) != ( EventBits_t ) 0 );
 	}
-	( void ) xTaskResumeAll();
 
-	return pxEventBits->uxEventBits;
-}
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
 /*-----------------------------------------------------------*/
 
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+const List_t *pxTasksWaitingForBits;
+UBaseType_t uxList;
 
 	vTaskSuspendAll();
+	/* Never unlocked, interrupts must not use the event group any more. */
+	prvLockEventGroup( pxEventBits );
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
-		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+		for( uxList = ( UBaseType_t ) 0; uxList < ( UBaseType_t ) eventWAIT_LISTS; uxList++ )
 		{
-			/* Unblock the task, returning 0 as the event list is being deleted
-			and	cannot therefore have any bits set. */
-			configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-			( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+			pxTasksWaitingForBits = eventGET_WAIT_LIST( pxEventBits, uxList );
+
+			while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+			{
+				/* Unblock the task, returning 0 as the event list is being
+				deleted and cannot therefore have any bits set. */
+				configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+				( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+			}
 		}
 
-		vPortFree( pxEventBits );
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		{
+			/* Only free the event group if it was allocated dynamically. */
+			if( pxEventBits->ucStaticallyAllocated == pdFALSE )
+			{
+				vPortFree( pxEventBits );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			vPortFree( pxEventBits );
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 	( void ) xTaskResumeAll();
 }
@@ -645,7 +1008,55 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxEventBits->uxLocks == ( UBaseType_t ) 0U )
+			{
+				/* The tasks waiting for the bits are tested with interrupts
+				masked, see configUSE_EVENT_GROUP_BIT_INDEX to only test the
+				ones waiting for the bits being set. */
+				if( prvSetBits( pxEventBits, uxBitsToSet, pdTRUE ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* A task is accessing the event group, the bits are set when
+				it unlocks it.  A clear pended earlier must not undo them. */
+				pxEventBits->uxPendingBits |= uxBitsToSet;
+				pxEventBits->uxPendingClear &= ~uxBitsToSet;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
 	{
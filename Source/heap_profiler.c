@@ -0,0 +1,434 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The profiler calls the heap itself, pvPortMalloc() and vPortFree() must
+keep their names in this file. */
+#define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not
+configured to include the heap profiler. */
+#if( configUSE_HEAP_PROFILER == 1 )
+
+/* The tables and counters are only accessed with the scheduler suspended, as
+the heaps are only called from tasks.  The heap call itself is timed inside
+that suspension, so a block cannot be freed and allocated again by another
+task before it is recorded. */
+PRIVILEGED_DATA static HeapProfilerSite_t xSites[ configHEAP_PROFILER_SITES ];
+PRIVILEGED_DATA static HeapProfilerBlock_t xBlocks[ configHEAP_PROFILER_BLOCKS ];
+PRIVILEGED_DATA static HeapProfilerStats_t xStats;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add a sample to the minimum, maximum and total of *pxTimes.
+ */
+static void prvRecordTime( HeapProfilerTimes_t *pxTimes, uint32_t ulTime );
+
+/*
+ * Return the index of the call site pcFile:usLine, adding it to the table if
+ * it is not there yet, or heapprofilerNO_SITE if the table is full.
+ */
+static UBaseType_t prvGetSite( const char *pcFile, uint16_t usLine );
+
+/*
+ * Return the bucket of the size histogram of a request of xSize bytes.
+ */
+static UBaseType_t prvGetSizeBucket( size_t xSize );
+
+/*-----------------------------------------------------------*/
+
+void *pvHeapProfilerMalloc( size_t xSize, const char *pcFile, uint16_t usLine )
+{
+void *pvReturn;
+uint32_t ulStart;
+UBaseType_t uxSite;
+HeapProfilerSite_t *pxSite;
+HeapProfilerBlock_t *pxBlock;
+
+	vTaskSuspendAll();
+	{
+		ulStart = configHEAP_PROFILER_GET_TIME();
+		pvReturn = pvPortMalloc( xSize );
+		prvRecordTime( &( xStats.xMallocTimes ), configHEAP_PROFILER_GET_TIME() - ulStart );
+
+		xStats.ulSizeCounts[ prvGetSizeBucket( xSize ) ]++;
+
+		uxSite = prvGetSite( pcFile, usLine );
+
+		if( uxSite != heapprofilerNO_SITE )
+		{
+			pxSite = &( xSites[ uxSite ] );
+
+			if( pvReturn != NULL )
+			{
+				pxSite->ulAllocations++;
+				pxSite->ulBytes += ( uint32_t ) xSize;
+			}
+			else
+			{
+				pxSite->ulFailures++;
+			}
+		}
+		else
+		{
+			xStats.ulLostSites++;
+		}
+
+		if( pvReturn != NULL )
+		{
+			if( xStats.uxLiveBlocks < ( UBaseType_t ) configHEAP_PROFILER_BLOCKS )
+			{
+				pxBlock = &( xBlocks[ xStats.uxLiveBlocks ] );
+				pxBlock->pvAddress = pvReturn;
+				pxBlock->xSize = xSize;
+				pxBlock->xTickAllocated = xTaskGetTickCount();
+				pxBlock->uxSite = uxSite;
+				xStats.uxLiveBlocks++;
+
+				/* The live counts of a call site only cover the blocks in the
+				table, they could not be taken back on free otherwise. */
+				if( uxSite != heapprofilerNO_SITE )
+				{
+					pxSite->uxLiveBlocks++;
+					pxSite->xLiveBytes += xSize;
+
+					if( pxSite->xLiveBytes > pxSite->xMaxLiveBytes )
+					{
+						pxSite->xMaxLiveBytes = pxSite->xLiveBytes;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				xStats.uxUntrackedBlocks++;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapProfilerFree( void *pv )
+{
+uint32_t ulStart;
+UBaseType_t ux;
+HeapProfilerBlock_t *pxBlock;
+
+	if( pv != NULL )
+	{
+		vTaskSuspendAll();
+		{
+			ulStart = configHEAP_PROFILER_GET_TIME();
+			vPortFree( pv );
+			prvRecordTime( &( xStats.xFreeTimes ), configHEAP_PROFILER_GET_TIME() - ulStart );
+
+			for( ux = 0; ux < xStats.uxLiveBlocks; ux++ )
+			{
+				if( xBlocks[ ux ].pvAddress == pv )
+				{
+					break;
+				}
+			}
+
+			if( ux < xStats.uxLiveBlocks )
+			{
+				pxBlock = &( xBlocks[ ux ] );
+
+				if( pxBlock->uxSite != heapprofilerNO_SITE )
+				{
+					xSites[ pxBlock->uxSite ].uxLiveBlocks--;
+					xSites[ pxBlock->uxSite ].xLiveBytes -= pxBlock->xSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The last entry takes the place of the freed one. */
+				xStats.uxLiveBlocks--;
+				*pxBlock = xBlocks[ xStats.uxLiveBlocks ];
+			}
+			else
+			{
+				xStats.ulUntrackedFrees++;
+
+				if( xStats.uxUntrackedBlocks > ( UBaseType_t ) 0 )
+				{
+					xStats.uxUntrackedBlocks--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+	else
+	{
+		/* The heaps ignore NULL, so does the profiler. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHeapProfilerGetStats( HeapProfilerStats_t *pxStats )
+{
+	configASSERT( pxStats );
+
+	vTaskSuspendAll();
+	{
+		*pxStats = xStats;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapProfilerGetSite( UBaseType_t uxIndex, HeapProfilerSite_t *pxSite )
+{
+BaseType_t xReturn = pdFALSE;
+
+	configASSERT( pxSite );
+
+	vTaskSuspendAll();
+	{
+		if( uxIndex < xStats.uxSites )
+		{
+			*pxSite = xSites[ uxIndex ];
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapProfilerGetBlock( UBaseType_t uxIndex, HeapProfilerBlock_t *pxBlock )
+{
+BaseType_t xReturn = pdFALSE;
+
+	configASSERT( pxBlock );
+
+	vTaskSuspendAll();
+	{
+		if( uxIndex < xStats.uxLiveBlocks )
+		{
+			*pxBlock = xBlocks[ uxIndex ];
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapProfilerReset( void )
+{
+UBaseType_t ux;
+
+	vTaskSuspendAll();
+	{
+		for( ux = 0; ux < xStats.uxSites; ux++ )
+		{
+			xSites[ ux ].ulAllocations = 0;
+			xSites[ ux ].ulFailures = 0;
+			xSites[ ux ].ulBytes = 0;
+			xSites[ ux ].xMaxLiveBytes = xSites[ ux ].xLiveBytes;
+		}
+
+		xStats.xMallocTimes.ulCount = 0;
+		xStats.xFreeTimes.ulCount = 0;
+
+		for( ux = 0; ux < ( UBaseType_t ) heapprofilerSIZE_BUCKETS; ux++ )
+		{
+			xStats.ulSizeCounts[ ux ] = 0;
+		}
+
+		xStats.ulLostSites = 0;
+		xStats.ulUntrackedFrees = 0;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordTime( HeapProfilerTimes_t *pxTimes, uint32_t ulTime )
+{
+	if( pxTimes->ulCount == 0 )
+	{
+		pxTimes->ulMin = ulTime;
+		pxTimes->ulMax = ulTime;
+		pxTimes->ulTotal = 0;
+	}
+	else if( ulTime < pxTimes->ulMin )
+	{
+		pxTimes->ulMin = ulTime;
+	}
+	else if( ulTime > pxTimes->ulMax )
+	{
+		pxTimes->ulMax = ulTime;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxTimes->ulCount++;
+	pxTimes->ulTotal += ulTime;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetSite( const char *pcFile, uint16_t usLine )
+{
+UBaseType_t ux;
+
+	/* __FILE__ is the same string for every call made from one file, the
+	pointers can be compared. */
+	for( ux = 0; ux < xStats.uxSites; ux++ )
+	{
+		if( ( xSites[ ux ].usLine == usLine ) && ( xSites[ ux ].pcFile == pcFile ) )
+		{
+			break;
+		}
+	}
+
+	if( ux < xStats.uxSites )
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	else if( xStats.uxSites < ( UBaseType_t ) configHEAP_PROFILER_SITES )
+	{
+		xSites[ ux ].pcFile = pcFile;
+		xSites[ ux ].usLine = usLine;
+		xStats.uxSites++;
+	}
+	else
+	{
+		ux = heapprofilerNO_SITE;
+	}
+
+	return ux;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetSizeBucket( size_t xSize )
+{
+UBaseType_t uxBucket = 0;
+
+	while( ( xSize >>= 1 ) != ( size_t ) 0 )
+	{
+		uxBucket++;
+	}
+
+	return uxBucket;
+}
+
+#endif /* configUSE_HEAP_PROFILER */
+
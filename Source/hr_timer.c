@@ -0,0 +1,474 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hr_timer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if( configUSE_HR_TIMER == 1 )
+
+#if ( INCLUDE_vTaskDelay != 1 )
+	#error INCLUDE_vTaskDelay must be set to 1 for vTaskDelayUs() to be available
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES must be set to 1 for the timeouts to know their task
+#endif
+
+/* Time after which a timeout that could not end the wait of its task, the
+scheduler being suspended, tries again. */
+#define hrtimerRETRY_COUNTS		hrtimerUS_TO_COUNTS( 10 )
+
+/* Microseconds per tick, for the tick delay that backs up vTaskDelayUs(). */
+#define hrtimerUS_PER_TICK		( ( uint32_t ) 1000000UL / ( uint32_t ) configTICK_RATE_HZ )
+
+/*
+ * A timer.  The active timers are linked in deadline order from
+ * pxActiveTimers, the list and the timers are only changed with interrupts
+ * masked.
+ */
+typedef struct xHrTimerDefinition
+{
+	struct xHrTimerDefinition *pxNext;				/*< Next active timer, its deadline is not before this one. */
+	HrTimerCallbackFunction_t pxCallbackFunction;	/*< Called by the compare interrupt when the deadline is reached. */
+	void *pvTimerID;								/*< Given to the timer on creation, for the callback. */
+	uint32_t ulDeadline;							/*< Time the timer expires, or expired last. */
+	uint8_t ucActive;								/*< pdTRUE while the timer is in the active list. */
+	uint8_t ucStaticallyAllocated;					/*< pdTRUE if created by xHrTimerCreateStatic(), so not freed on delete. */
+
+} HrTimer_t;
+
+/* The active timers, nearest deadline first. */
+PRIVILEGED_DATA static HrTimer_t * volatile pxActiveTimers = NULL;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Takes a timer out of the active list if it is in it.  Returns pdTRUE if it
+ * was.  Must be called with interrupts masked.
+ */
+static BaseType_t prvRemoveTimer( HrTimer_t * const pxTimer );
+
+/*
+ * Sets the compare of the port to the nearest deadline, or cancels it if no
+ * timer is active.  Must be called with interrupts masked.
+ */
+static void prvSetCompare( void );
+
+/*
+ * Callback of the timers of vHrTimeOutStart() and vTaskDelayUs(): ends the
+ * wait of the task, pvTimerID.
+ */
+static BaseType_t prvTimeOutExpired( HrTimerHandle_t xTimer );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	HrTimerHandle_t xHrTimerCreate( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID )
+	{
+	HrTimer_t *pxTimer;
+
+		pxTimer = ( HrTimer_t * ) pvPortMalloc( sizeof( HrTimer_t ) );
+
+		if( pxTimer != NULL )
+		{
+			( void ) xHrTimerCreateStatic( pxCallbackFunction, pvTimerID, ( StaticHrTimer_t * ) pxTimer );
+			pxTimer->ucStaticallyAllocated = ( uint8_t ) pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( HrTimerHandle_t ) pxTimer;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+HrTimerHandle_t xHrTimerCreateStatic( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID, StaticHrTimer_t *pxTimerBuffer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) pxTimerBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+	configASSERT( pxCallbackFunction );
+	configASSERT( pxTimer );
+
+	/* The dummy structure in hr_timer.h must be the size of the real one. */
+	configASSERT( sizeof( StaticHrTimer_t ) == sizeof( HrTimer_t ) );
+
+	pxTimer->pxNext = NULL;
+	pxTimer->pxCallbackFunction = pxCallbackFunction;
+	pxTimer->pvTimerID = pvTimerID;
+	pxTimer->ulDeadline = 0UL;
+	pxTimer->ucActive = ( uint8_t ) pdFALSE;
+	pxTimer->ucStaticallyAllocated = ( uint8_t ) pdTRUE;
+
+	return ( HrTimerHandle_t ) pxTimer;
+}
+/*-----------------------------------------------------------*/
+
+void vHrTimerStart( HrTimerHandle_t xTimer, uint32_t ulDelayUs )
+{
+	configASSERT( ulDelayUs <= hrtimerCOUNTS_TO_US( 0x7FFFFFFFUL ) );
+
+	vHrTimerStartAt( xTimer, ulHrTimerGetTime() + hrtimerUS_TO_COUNTS( ulDelayUs ) );
+}
+/*-----------------------------------------------------------*/
+
+void vHrTimerStartAt( HrTimerHandle_t xTimer, uint32_t ulDeadline )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+HrTimer_t *pxPrevious;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		( void ) prvRemoveTimer( pxTimer );
+
+		pxTimer->ulDeadline = ulDeadline;
+		pxTimer->ucActive = ( uint8_t ) pdTRUE;
+
+		if( ( pxActiveTimers == NULL ) || ( ( int32_t ) ( ulDeadline - pxActiveTimers->ulDeadline ) < 0 ) )
+		{
+			/* The new nearest deadline. */
+			pxTimer->pxNext = pxActiveTimers;
+			pxActiveTimers = pxTimer;
+			prvSetCompare();
+		}
+		else
+		{
+			/* After the timers with the same deadline, they expire in the
+			order they were started. */
+			pxPrevious = pxActiveTimers;
+
+			while( ( pxPrevious->pxNext != NULL ) && ( ( int32_t ) ( ulDeadline - pxPrevious->pxNext->ulDeadline ) >= 0 ) )
+			{
+				pxPrevious = pxPrevious->pxNext;
+			}
+
+			pxTimer->pxNext = pxPrevious->pxNext;
+			pxPrevious->pxNext = pxTimer;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHrTimerStop( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xReturn;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xReturn = prvRemoveTimer( pxTimer );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHrTimerIsActive( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	return ( pxTimer->ucActive != ( uint8_t ) pdFALSE ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulHrTimerGetDeadline( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	return pxTimer->ulDeadline;
+}
+/*-----------------------------------------------------------*/
+
+void *pvHrTimerGetTimerID( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+
+	configASSERT( pxTimer );
+
+	return pxTimer->pvTimerID;
+}
+/*-----------------------------------------------------------*/
+
+void vHrTimerDelete( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+
+	( void ) xHrTimerStop( xTimer );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxTimer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		( void ) pxTimer;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+void vTaskDelayUs( uint32_t ulDelayUs )
+{
+HrTimeOut_t xDelay;
+uint32_t ulDeadline;
+
+	if( ulDelayUs <= ( uint32_t ) configHR_TIMER_SPIN_US )
+	{
+		/* Shorter than switching to another task and back. */
+		ulDeadline = ulHrTimerGetTime() + hrtimerUS_TO_COUNTS( ulDelayUs );
+
+		while( ( int32_t ) ( ulHrTimerGetTime() - ulDeadline ) < 0 )
+		{
+			/* Wait. */
+		}
+	}
+	else
+	{
+		/* The tick delay cannot end first, it is at least a tick longer, it
+		only bounds the delay should the compare interrupt not come. */
+		configASSERT( ( ulDelayUs / hrtimerUS_PER_TICK ) < ( uint32_t ) ( portMAX_DELAY - 2U ) );
+
+		vHrTimeOutStart( &xDelay, ulDelayUs );
+		vTaskDelay( ( TickType_t ) ( ulDelayUs / hrtimerUS_PER_TICK ) + ( TickType_t ) 2 );
+		( void ) xHrTimeOutStop( &xDelay );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHrTimeOutStart( HrTimeOut_t *pxTimeOut, uint32_t ulTimeoutUs )
+{
+HrTimerHandle_t xTimer;
+
+	configASSERT( pxTimeOut );
+
+	xTimer = xHrTimerCreateStatic( prvTimeOutExpired, ( void * ) xTaskGetCurrentTaskHandle(), pxTimeOut );
+	vHrTimerStart( xTimer, ulTimeoutUs );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHrTimeOutStop( HrTimeOut_t *pxTimeOut )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) pxTimeOut;
+BaseType_t xReturn;
+
+	configASSERT( pxTimer );
+	configASSERT( pxTimer->pvTimerID == ( void * ) xTaskGetCurrentTaskHandle() );
+
+	/* Once the timer is stopped it cannot set the flag again. */
+	( void ) xHrTimerStop( ( HrTimerHandle_t ) pxTimer );
+	xReturn = xTaskClearDelayAborted();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHrTimerProcessFromISR( void )
+{
+HrTimer_t *pxTimer;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* The time is read again after each callback, the callbacks take
+		time too and may start timers. */
+		while( ( pxActiveTimers != NULL ) && ( ( int32_t ) ( ulHrTimerGetTime() - pxActiveTimers->ulDeadline ) >= 0 ) )
+		{
+			pxTimer = pxActiveTimers;
+			pxActiveTimers = pxTimer->pxNext;
+			pxTimer->pxNext = NULL;
+			pxTimer->ucActive = ( uint8_t ) pdFALSE;
+
+			if( pxTimer->pxCallbackFunction( ( HrTimerHandle_t ) pxTimer ) != pdFALSE )
+			{
+				xHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		prvSetCompare();
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvRemoveTimer( HrTimer_t * const pxTimer )
+{
+HrTimer_t *pxPrevious;
+BaseType_t xReturn = pdFALSE;
+
+	if( pxTimer->ucActive != ( uint8_t ) pdFALSE )
+	{
+		if( pxActiveTimers == pxTimer )
+		{
+			/* The compare moves to the next deadline, it would only have
+			come early otherwise. */
+			pxActiveTimers = pxTimer->pxNext;
+			prvSetCompare();
+		}
+		else
+		{
+			pxPrevious = pxActiveTimers;
+
+			while( pxPrevious->pxNext != pxTimer )
+			{
+				configASSERT( pxPrevious->pxNext );
+				pxPrevious = pxPrevious->pxNext;
+			}
+
+			pxPrevious->pxNext = pxTimer->pxNext;
+		}
+
+		pxTimer->pxNext = NULL;
+		pxTimer->ucActive = ( uint8_t ) pdFALSE;
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetCompare( void )
+{
+	if( pxActiveTimers != NULL )
+	{
+		vPortHrTimerSetCompare( pxActiveTimers->ulDeadline );
+	}
+	else
+	{
+		vPortHrTimerClearCompare();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTimeOutExpired( HrTimerHandle_t xTimer )
+{
+HrTimer_t * const pxTimer = ( HrTimer_t * ) xTimer;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	if( xTaskAbortDelayFromISR( ( TaskHandle_t ) pxTimer->pvTimerID, &xHigherPriorityTaskWoken ) == pdFAIL )
+	{
+		/* A task suspended the scheduler, it will not keep it suspended for
+		long. */
+		vHrTimerStartAt( xTimer, ulHrTimerGetTime() + hrtimerRETRY_COUNTS );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+
+#endif /* configUSE_HR_TIMER */
+
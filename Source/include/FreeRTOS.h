@@ -321,6 +321,42 @@ extern "C" {
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#if( configUSE_TRACE_RECORDER == 1 )
+
+	#if( configUSE_TRACE_FACILITY != 1 )
+		#error configUSE_TRACE_RECORDER needs configUSE_TRACE_FACILITY, the object IDs are kept in the task, queue and event group numbers.
+	#endif
+
+	#ifndef configTRACE_RECORDER_GET_TIME
+		#error configTRACE_RECORDER_GET_TIME() must be defined to a free running 32 bit time base when configUSE_TRACE_RECORDER is 1.
+	#endif
+
+	#ifndef configTRACE_RECORDER_RECORDS
+		#define configTRACE_RECORDER_RECORDS 128
+	#endif
+
+	#ifndef configTRACE_RECORDER_OBJECTS
+		#define configTRACE_RECORDER_OBJECTS 16
+	#endif
+
+	#if( configTRACE_RECORDER_OBJECTS > 255 )
+		#error configTRACE_RECORDER_OBJECTS must be 255 or less, object IDs are recorded on 8 bits.
+	#endif
+
+	#ifndef configTRACE_RECORDER_NAME_LEN
+		#define configTRACE_RECORDER_NAME_LEN configMAX_TASK_NAME_LEN
+	#endif
+
+	/* Defines the trace macros used by the recorder, the others are removed
+	below. */
+	#include "trace_recorder.h"
+
+#endif /* configUSE_TRACE_RECORDER */
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -715,6 +751,50 @@ extern "C" {
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_ZERO_COPY_QUEUES
+	#define configUSE_ZERO_COPY_QUEUES 0
+#endif
+
+#ifndef configUSE_QUEUE_BATCH
+	#define configUSE_QUEUE_BATCH 0
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SLOT_BITS
+	#define configTIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#ifndef configUSE_DELAYED_TASK_BUCKETS
+	#define configUSE_DELAYED_TASK_BUCKETS 0
+#endif
+
+#ifndef configDELAYED_TASK_BUCKET_BITS
+	#define configDELAYED_TASK_BUCKET_BITS 5
+#endif
+
+#ifndef configUSE_EVENT_LIST_BUCKETS
+	#define configUSE_EVENT_LIST_BUCKETS 0
+#endif
+
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
+#if ( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_CEILING_MUTEXES needs configUSE_MUTEXES, a ceiling mutex is a mutex with a fixed priority for its holder.
+#endif
+
+#ifndef configUSE_EVENT_GROUP_BIT_INDEX
+	#define configUSE_EVENT_GROUP_BIT_INDEX 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_ISR
+	#define configUSE_EVENT_GROUP_DIRECT_ISR 0
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -763,10 +843,100 @@ extern "C" {
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
 
+#ifndef configHEAP_TLSF_SL_BITS
+	#define configHEAP_TLSF_SL_BITS 4
+#endif
+
+#ifndef configSUPPORT_STATIC_ALLOCATION
+	/* Defaults to 0 for backward compatibility. */
+	#define configSUPPORT_STATIC_ALLOCATION 0
+#endif
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+	/* Defaults to 1 for backward compatibility. */
+	#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#endif
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, no kernel object could be created.
+#endif
+
+#ifndef configUSE_HEAP_PROFILER
+	#define configUSE_HEAP_PROFILER 0
+#endif
+
+#if( configUSE_HEAP_PROFILER == 1 )
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+		#error configUSE_HEAP_PROFILER needs configSUPPORT_DYNAMIC_ALLOCATION, there is no heap to profile.
+	#endif
+
+	#ifndef configHEAP_PROFILER_GET_TIME
+		#error configHEAP_PROFILER_GET_TIME() must be defined to a free running 32 bit time base when configUSE_HEAP_PROFILER is 1.
+	#endif
+
+	#ifndef configHEAP_PROFILER_SITES
+		#define configHEAP_PROFILER_SITES 16
+	#endif
+
+	#ifndef configHEAP_PROFILER_BLOCKS
+		#define configHEAP_PROFILER_BLOCKS 32
+	#endif
+
+#endif /* configUSE_HEAP_PROFILER */
+
+#ifndef configUSE_CRITICAL_PROFILER
+	#define configUSE_CRITICAL_PROFILER 0
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+
+	#ifndef configCRITICAL_PROFILER_GET_TIME
+		#error configCRITICAL_PROFILER_GET_TIME() must be defined to a free running 32 bit time base when configUSE_CRITICAL_PROFILER is 1.
+	#endif
+
+	#ifndef configCRITICAL_PROFILER_SITES
+		#define configCRITICAL_PROFILER_SITES 8
+	#endif
+
+	#ifndef configCRITICAL_PROFILER_GET_CALLER
+		/* Used in vPortEnterCritical(), the caller is the code that entered
+		the critical section. */
+		#define configCRITICAL_PROFILER_GET_CALLER() ( ( uint32_t ) ( size_t ) __builtin_return_address( 0 ) )
+	#endif
+
+#endif /* configUSE_CRITICAL_PROFILER */
+
+#ifndef configUSE_HR_TIMER
+	#define configUSE_HR_TIMER 0
+#endif
+
+#if( configUSE_HR_TIMER == 1 )
+
+	#ifndef portHR_TIMER_COUNTS_PER_US
+		#error configUSE_HR_TIMER needs a port with a high resolution timer, one that defines portHR_TIMER_COUNTS_PER_US (see hr_timer.h).
+	#endif
+
+	#ifndef configHR_TIMER_SPIN_US
+		/* vTaskDelayUs() busy waits for delays up to this long instead of
+		blocking. */
+		#define configHR_TIMER_SPIN_US 20
+	#endif
+
+#endif /* configUSE_HR_TIMER */
+
 #ifndef configUSE_TASK_NOTIFICATIONS
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configUSE_OBJECT_NOTIFY_BITS
+	#define configUSE_OBJECT_NOTIFY_BITS 0
+#endif
+
+#if ( ( configUSE_OBJECT_NOTIFY_BITS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_OBJECT_NOTIFY_BITS needs configUSE_TASK_NOTIFICATIONS, the objects signal through the notification value of a task.
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -831,5 +1001,15 @@ point support. */
 }
 #endif
 
+#if( configUSE_HEAP_PROFILER == 1 )
+	/* Maps pvPortMalloc() and vPortFree() to the profiler. */
+	#include "heap_profiler.h"
+#endif
+
+#if( configUSE_CRITICAL_PROFILER == 1 )
+	/* Called by the port on critical section entry and exit. */
+	#include "critical_profiler.h"
+#endif
+
 #endif /* INC_FREERTOS_H */
 
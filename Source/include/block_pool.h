@@ -0,0 +1,293 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include block_pool.h"
+#endif
+
+#include "list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A block pool hands out blocks of one fixed size taken from a storage area
+ * given at creation, so blocks can be allocated and freed again, from tasks
+ * and from interrupts, without going through pvPortMalloc().  Allocating or
+ * freeing a block unlinks or links the head of a list of free blocks in a
+ * short critical section: the time does not depend on the number of blocks
+ * and the pool never fragments.
+ *
+ * A task can block until a block is freed.  Any number of tasks can wait on
+ * the same pool, the highest priority one gets the first block freed.
+ *
+ * Each pool counts the most blocks ever allocated at the same time and the
+ * allocations that failed, to size the pools from a running system.
+ *
+ * \defgroup BlockPool
+ */
+
+/**
+ * block_pool.h
+ *
+ * Type by which block pools are referenced.
+ *
+ * \defgroup BlockPoolHandle_t BlockPoolHandle_t
+ * \ingroup BlockPool
+ */
+typedef void * BlockPoolHandle_t;
+
+/*
+ * The control structure of a block pool created by xBlockPoolCreateStatic().
+ * Its content is private, only its size matters, it matches the structure
+ * used by block_pool.c.
+ */
+typedef struct xSTATIC_BLOCK_POOL
+{
+	void *pvDummy1[ 2 ];
+	size_t xDummy2;
+	UBaseType_t uxDummy3[ 4 ];
+	EventList_t xDummy4;
+	uint8_t ucDummy5;
+} StaticBlockPool_t;
+
+/*
+ * The size a pool gives to blocks of xBlockSize bytes: a free block holds a
+ * pointer to the next one and every block is aligned to portBYTE_ALIGNMENT.
+ */
+#define blockpoolBLOCK_SIZE( xBlockSize )	( ( ( ( size_t ) ( xBlockSize ) < sizeof( void * ) ? sizeof( void * ) : ( size_t ) ( xBlockSize ) ) + ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*
+ * The number of bytes of storage needed by xBlockPoolCreateStatic() for
+ * uxBlockCount blocks of xBlockSize bytes.
+ */
+#define blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount )	( blockpoolBLOCK_SIZE( xBlockSize ) * ( size_t ) ( uxBlockCount ) )
+
+/**
+ * block_pool.h
+ *<pre>
+ BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount );
+ </pre>
+ *
+ * Creates a block pool, the control structure and the blocks being allocated
+ * with one call to pvPortMalloc().
+ *
+ * @param xBlockSize The size of each block in bytes.
+ *
+ * @param uxBlockCount The number of blocks in the pool.
+ *
+ * @return The handle of the pool, or NULL if there was not enough heap.
+ *
+ * \defgroup xBlockPoolCreate xBlockPoolCreate
+ * \ingroup BlockPool
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * block_pool.h
+ *<pre>
+ BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize, UBaseType_t uxBlockCount, void *pvPoolStorage, StaticBlockPool_t *pxStaticBlockPool );
+ </pre>
+ *
+ * Creates a block pool in memory provided by the application, nothing is
+ * allocated from the heap, so it can be used with heap_1.c and the pool can
+ * be placed in a chosen section.
+ *
+ * @param pvPoolStorage The blocks, at least
+ * blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) bytes aligned to
+ * portBYTE_ALIGNMENT, an array of size_t for example.
+ *
+ * @param pxStaticBlockPool The control structure of the pool.
+ *
+ * @return The handle of the pool.
+ *
+ * Example usage:
+   <pre>
+ #define FRAME_SIZE     64
+ #define FRAMES         4
+
+ static size_t xFrameStorage[ blockpoolSTORAGE_SIZE( FRAME_SIZE, FRAMES ) / sizeof( size_t ) ];
+ static StaticBlockPool_t xFramePoolBuffer;
+ BlockPoolHandle_t xFramePool;
+
+	xFramePool = xBlockPoolCreateStatic( FRAME_SIZE, FRAMES, xFrameStorage, &xFramePoolBuffer );
+   </pre>
+ * \defgroup xBlockPoolCreateStatic xBlockPoolCreateStatic
+ * \ingroup BlockPool
+ */
+BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize, UBaseType_t uxBlockCount, void *pvPoolStorage, StaticBlockPool_t *pxStaticBlockPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ void *pvBlockPoolAlloc( BlockPoolHandle_t xBlockPool, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Allocates a block from a task.  If the pool is empty the task blocks for up
+ * to xTicksToWait until another task or an interrupt frees a block.
+ *
+ * @return The block, or NULL if none was freed in time.
+ *
+ * \defgroup pvBlockPoolAlloc pvBlockPoolAlloc
+ * \ingroup BlockPool
+ */
+void *pvBlockPoolAlloc( BlockPoolHandle_t xBlockPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ void *pvBlockPoolAllocFromISR( BlockPoolHandle_t xBlockPool );
+ </pre>
+ *
+ * Allocates a block from an interrupt.
+ *
+ * @return The block, or NULL if the pool is empty.
+ *
+ * \defgroup pvBlockPoolAllocFromISR pvBlockPoolAllocFromISR
+ * \ingroup BlockPool
+ */
+void *pvBlockPoolAllocFromISR( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ void vBlockPoolFree( BlockPoolHandle_t xBlockPool, void *pvBlock );
+ </pre>
+ *
+ * Gives a block back to the pool it was allocated from, from a task, and
+ * wakes the highest priority task waiting for a block if there is one.
+ *
+ * \defgroup vBlockPoolFree vBlockPoolFree
+ * \ingroup BlockPool
+ */
+void vBlockPoolFree( BlockPoolHandle_t xBlockPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ void vBlockPoolFreeFromISR( BlockPoolHandle_t xBlockPool, void *pvBlock, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * The version of vBlockPoolFree() that can be called from an interrupt.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if a task was woken that
+ * has a higher priority than the interrupted task, a context switch should
+ * then be requested before the interrupt exits.
+ *
+ * \defgroup vBlockPoolFreeFromISR vBlockPoolFreeFromISR
+ * \ingroup BlockPool
+ */
+void vBlockPoolFreeFromISR( BlockPoolHandle_t xBlockPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ UBaseType_t uxBlockPoolGetFreeBlocks( BlockPoolHandle_t xBlockPool );
+ UBaseType_t uxBlockPoolGetHighWaterMark( BlockPoolHandle_t xBlockPool );
+ UBaseType_t uxBlockPoolGetFailures( BlockPoolHandle_t xBlockPool );
+ </pre>
+ *
+ * The number of blocks that are free, the largest number of blocks that have
+ * been allocated at the same time since the pool was created, and the number
+ * of allocations that returned NULL.  Can be called from interrupts.
+ *
+ * \defgroup uxBlockPoolGetFreeBlocks uxBlockPoolGetFreeBlocks
+ * \ingroup BlockPool
+ */
+UBaseType_t uxBlockPoolGetFreeBlocks( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+UBaseType_t uxBlockPoolGetHighWaterMark( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+UBaseType_t uxBlockPoolGetFailures( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *<pre>
+ void vBlockPoolDelete( BlockPoolHandle_t xBlockPool );
+ </pre>
+ *
+ * Deletes a block pool that no task is blocked on.  The memory is freed if
+ * the pool was created by xBlockPoolCreate().
+ *
+ * \defgroup vBlockPoolDelete vBlockPoolDelete
+ * \ingroup BlockPool
+ */
+void vBlockPoolDelete( BlockPoolHandle_t xBlockPool ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOCK_POOL_H */
+
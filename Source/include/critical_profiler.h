@@ -0,0 +1,225 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef CRITICAL_PROFILER_H
+#define CRITICAL_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include critical_profiler.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The critical section profiler times how long interrupts stay masked by
+ * taskENTER_CRITICAL() / taskEXIT_CRITICAL().  It is compiled in when
+ * configUSE_CRITICAL_PROFILER is set to 1 in FreeRTOSConfig.h, the port then
+ * calls vCriticalProfilerEnter() when it enters an outermost critical section,
+ * once interrupts are masked, and vCriticalProfilerExit() when it leaves it,
+ * before they are unmasked again.  Nested sections are part of the outermost
+ * one.  Only the PIC24 and Posix ports make these calls.
+ *
+ * Each section is timed with configCRITICAL_PROFILER_GET_TIME() and charged
+ * to its caller, the return address of vPortEnterCritical() as given by
+ * configCRITICAL_PROFILER_GET_CALLER(), to be looked up in the map file.  It
+ * keeps the longest section with its caller, a histogram of the durations in
+ * powers of two, and for configCRITICAL_PROFILER_SITES callers the number of
+ * sections, their total and their longest one.  When the table is full a
+ * caller whose section is longer than the shortest worst case of the table
+ * takes its place, so the table ends up holding the worst offenders.
+ *
+ * A task that yields inside a critical section, as queue.c does when it
+ * unblocks a higher priority task, unmasks the interrupts when the next task
+ * runs: vTaskSwitchContext() calls vCriticalProfilerTaskSwitched(), which
+ * ends the section there.  The rest of it, once the task runs again, is not
+ * timed.
+ *
+ * The profiler runs with interrupts masked, its own bookkeeping is done after
+ * the end of the section is stamped and is not in the figures, but it does
+ * add to the time interrupts are masked.
+ *
+ * The profiler only collects, the application formats the report with the
+ * functions below.
+ *
+ * \defgroup CriticalProfiler
+ */
+
+/* Number of buckets of the duration histogram, bucket n counts the sections
+of ( 1 << n ) to ( 2 << n ) - 1 counts of configCRITICAL_PROFILER_GET_TIME(),
+bucket 0 also counts the sections of 0 counts. */
+#define criticalprofilerBUCKETS			( 32 )
+
+/*
+ * Counters of one caller, as returned by xCriticalProfilerGetSite().
+ */
+typedef struct xCRITICAL_PROFILER_SITE
+{
+	uint32_t ulCaller;				/*< Return address of the vPortEnterCritical() call. */
+	uint32_t ulCount;				/*< Sections entered from there. */
+	uint32_t ulMax;					/*< Longest of them. */
+	uint64_t ullTotal;				/*< Sum of their durations, the average is ullTotal / ulCount. */
+} CriticalProfilerSite_t;
+
+/*
+ * Global counters, as returned by vCriticalProfilerGetStats().  Durations in
+ * counts of configCRITICAL_PROFILER_GET_TIME().
+ */
+typedef struct xCRITICAL_PROFILER_STATS
+{
+	uint32_t ulCount;				/*< Sections timed. */
+	uint32_t ulMax;					/*< Longest section. */
+	uint32_t ulMaxCaller;			/*< Caller of the longest section. */
+	uint64_t ullTotal;				/*< Sum of the durations of all the sections. */
+	uint32_t ulCounts[ criticalprofilerBUCKETS ];	/*< Duration histogram. */
+	UBaseType_t uxSites;			/*< Entries used in the table of callers. */
+	uint32_t ulLostSections;		/*< Sections not counted in the table, their caller did not fit or was replaced. */
+	uint32_t ulSwitched;			/*< Sections ended by a context switch. */
+} CriticalProfilerStats_t;
+
+/**
+ * critical_profiler.h
+ *<pre>
+ void vCriticalProfilerEnter( uint32_t ulCaller );
+ void vCriticalProfilerExit( void );
+ void vCriticalProfilerTaskSwitched( void );
+ </pre>
+ *
+ * Called by the port and by vTaskSwitchContext(), with interrupts masked.
+ * Not meant to be called directly.
+ *
+ * \defgroup vCriticalProfilerEnter vCriticalProfilerEnter
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerEnter( uint32_t ulCaller ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerExit( void ) PRIVILEGED_FUNCTION;
+void vCriticalProfilerTaskSwitched( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ *<pre>
+ void vCriticalProfilerGetStats( CriticalProfilerStats_t *pxStats );
+ </pre>
+ *
+ * Copies the global counters and the histogram.
+ *
+ * \defgroup vCriticalProfilerGetStats vCriticalProfilerGetStats
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerGetStats( CriticalProfilerStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ *<pre>
+ BaseType_t xCriticalProfilerGetSite( UBaseType_t uxIndex, CriticalProfilerSite_t *pxSite );
+ </pre>
+ *
+ * Copies one entry of the table of callers.  The entries are in no
+ * particular order, and an entry can be given to another caller between two
+ * calls.
+ *
+ * @return pdTRUE if the entry exists, pdFALSE past the end of the table.
+ *
+ * Example usage:
+   <pre>
+ UBaseType_t ux;
+ CriticalProfilerSite_t xSite;
+
+	for( ux = 0; xCriticalProfilerGetSite( ux, &xSite ) != pdFALSE; ux++ )
+	{
+		printf( "%06lx max %lu\n", ( unsigned long ) xSite.ulCaller, ( unsigned long ) xSite.ulMax );
+	}
+   </pre>
+ * \defgroup xCriticalProfilerGetSite xCriticalProfilerGetSite
+ * \ingroup CriticalProfiler
+ */
+BaseType_t xCriticalProfilerGetSite( UBaseType_t uxIndex, CriticalProfilerSite_t *pxSite ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ *<pre>
+ void vCriticalProfilerReset( void );
+ </pre>
+ *
+ * Clears the counters, the histogram and the table of callers, to profile
+ * one phase of the application.
+ *
+ * \defgroup vCriticalProfilerReset vCriticalProfilerReset
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerReset( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRITICAL_PROFILER_H */
+
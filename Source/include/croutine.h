@@ -170,7 +170,9 @@ typedef struct corCoRoutineControlBlock
  * \defgroup xCoRoutineCreate xCoRoutineCreate
  * \ingroup Tasks
  */
-BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
+#endif
 
 
 /**
@@ -744,7 +746,7 @@ void vCoRoutineSchedule( void );
  * Removes the current co-routine from its ready list and places it in the
  * appropriate delayed list.
  */
-void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList );
+void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, EventList_t *pxEventList );
 
 /*
  * This function is intended for internal use by the queue implementation only.
@@ -753,7 +755,7 @@ void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList )
  * Removes the highest priority co-routine from the event list and places it in
  * the pending ready list.
  */
-BaseType_t xCoRoutineRemoveFromEventList( const List_t *pxEventList );
+BaseType_t xCoRoutineRemoveFromEventList( EventList_t *pxEventList );
 
 #ifdef __cplusplus
 }
@@ -131,6 +131,38 @@ typedef void * EventGroupHandle_t;
  */
 typedef TickType_t EventBits_t;
 
+/*
+ * The memory of an event group created by xEventGroupCreateStatic().  Its
+ * content is private, only its size matters, it matches the structure used by
+ * event_groups.c.  The top 8 bits of EventBits_t are reserved, so an event
+ * group has 8 or 24 bits, each with its own list of waiting tasks when
+ * configUSE_EVENT_GROUP_BIT_INDEX is 1.
+ */
+typedef struct xSTATIC_EVENT_GROUP
+{
+	TickType_t xDummy1;
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		List_t xDummy2[ ( sizeof( EventBits_t ) * 8 ) - 8 ];
+		TickType_t xDummy3[ ( sizeof( EventBits_t ) * 8 ) - 8 ];
+	#else
+		List_t xDummy2;
+	#endif
+
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		UBaseType_t uxDummy4;
+		TickType_t xDummy5[ 2 ];
+	#endif
+
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy6;
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy7;
+	#endif
+} StaticEventGroup_t;
+
 /**
  * event_groups.h
  *<pre>
@@ -173,7 +205,29 @@ typedef TickType_t EventBits_t;
  * \defgroup xEventGroupCreate xEventGroupCreate
  * \ingroup EventGroup
  */
-EventGroupHandle_t xEventGroupCreate( void ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	EventGroupHandle_t xEventGroupCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * event_groups.h
+ *<pre>
+ EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer );
+ </pre>
+ *
+ * The same as xEventGroupCreate(), but the event group is created in
+ * pxEventGroupBuffer, given by the application, instead of being allocated
+ * from the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return The handle of the event group, which cannot be NULL.
+ *
+ * \defgroup xEventGroupCreateStatic xEventGroupCreateStatic
+ * \ingroup EventGroup
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer ) PRIVILEGED_FUNCTION;
+#endif
 
 /**
  * event_groups.h
@@ -379,7 +433,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear ) xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL )
@@ -475,6 +529,14 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h the
+ * bits are instead set by the interrupt itself, with interrupts masked, and the
+ * function does not depend on the timer task.  If a task is accessing the
+ * event group at the time, the bits are set when it is done with it.  Setting
+ * configUSE_EVENT_GROUP_BIT_INDEX to 1 as well bounds the time interrupts are
+ * masked by the number of tasks waiting for the bits being set.  The same
+ * applies to xEventGroupClearBitsFromISR().
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -531,7 +593,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken ) xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken )
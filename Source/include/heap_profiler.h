@@ -0,0 +1,258 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef HEAP_PROFILER_H
+#define HEAP_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include heap_profiler.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The heap profiler sits between the callers of pvPortMalloc() / vPortFree()
+ * and whichever heap_n.c is linked.  It is compiled in when
+ * configUSE_HEAP_PROFILER is set to 1 in FreeRTOSConfig.h, FreeRTOS.h then
+ * includes this header and the calls made by the kernel and the application
+ * go through pvHeapProfilerMalloc() and vHeapProfilerFree() instead.  The
+ * heap_n.c files define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE so their own
+ * functions keep their names.
+ *
+ * For each call site, the file and line of the pvPortMalloc() call, it
+ * counts the allocations, the failures and the bytes requested, and the
+ * blocks and bytes still allocated.  It also keeps a histogram of the
+ * requested sizes in powers of two, the minimum, average and maximum time
+ * taken by pvPortMalloc() and vPortFree(), timed with
+ * configHEAP_PROFILER_GET_TIME(), and a table of the live blocks.
+ *
+ * The tables have a fixed size and take no memory from the heap:
+ * configHEAP_PROFILER_SITES call sites and configHEAP_PROFILER_BLOCKS live
+ * blocks.  What does not fit is counted in HeapProfilerStats_t, the totals
+ * stay right.  The tables are searched linearly with the scheduler
+ * suspended, outside the timed part of the call.
+ *
+ * The profiler only collects, the application formats the report with the
+ * functions below.
+ *
+ * \defgroup HeapProfiler
+ */
+
+/* Value of uxSite in a HeapProfilerBlock_t whose call site did not fit in
+the table of call sites. */
+#define heapprofilerNO_SITE				( ( UBaseType_t ) -1 )
+
+/* Number of buckets of the size histogram, bucket n counts the requests of
+( 1 << n ) to ( 2 << n ) - 1 bytes, bucket 0 also counts the requests of 0
+bytes. */
+#define heapprofilerSIZE_BUCKETS		( sizeof( size_t ) * 8 )
+
+/*
+ * Counters of one call site, as returned by xHeapProfilerGetSite().
+ */
+typedef struct xHEAP_PROFILER_SITE
+{
+	const char *pcFile;				/*< __FILE__ of the pvPortMalloc() call, as given to the compiler. */
+	uint16_t usLine;				/*< __LINE__ of the pvPortMalloc() call. */
+	uint32_t ulAllocations;			/*< Calls that returned a block. */
+	uint32_t ulFailures;			/*< Calls that returned NULL. */
+	uint32_t ulBytes;				/*< Bytes requested by the calls that returned a block. */
+	UBaseType_t uxLiveBlocks;		/*< Blocks allocated here that are not freed yet, among the blocks in the table. */
+	size_t xLiveBytes;				/*< Bytes of those blocks. */
+	size_t xMaxLiveBytes;			/*< Highest xLiveBytes has been. */
+} HeapProfilerSite_t;
+
+/*
+ * A live block, as returned by xHeapProfilerGetBlock().
+ */
+typedef struct xHEAP_PROFILER_BLOCK
+{
+	void *pvAddress;				/*< Block returned by pvPortMalloc(). */
+	size_t xSize;					/*< Bytes requested. */
+	TickType_t xTickAllocated;		/*< Tick count when it was allocated. */
+	UBaseType_t uxSite;				/*< Index of its call site, or heapprofilerNO_SITE. */
+} HeapProfilerBlock_t;
+
+/*
+ * Times taken by pvPortMalloc() or vPortFree(), in counts of
+ * configHEAP_PROFILER_GET_TIME().
+ */
+typedef struct xHEAP_PROFILER_TIMES
+{
+	uint32_t ulCount;
+	uint32_t ulMin;
+	uint32_t ulMax;
+	uint32_t ulTotal;				/*< Sum of the times, the average is ulTotal / ulCount. */
+} HeapProfilerTimes_t;
+
+/*
+ * Global counters, as returned by vHeapProfilerGetStats().
+ */
+typedef struct xHEAP_PROFILER_STATS
+{
+	HeapProfilerTimes_t xMallocTimes;
+	HeapProfilerTimes_t xFreeTimes;
+	uint32_t ulSizeCounts[ heapprofilerSIZE_BUCKETS ];	/*< Size histogram of all the requests, failed ones included. */
+	UBaseType_t uxSites;			/*< Entries used in the table of call sites. */
+	UBaseType_t uxLiveBlocks;		/*< Entries used in the table of live blocks. */
+	uint32_t ulLostSites;			/*< Calls made from a call site that did not fit in the table. */
+	UBaseType_t uxUntrackedBlocks;	/*< Live blocks that did not fit in the table. */
+	uint32_t ulUntrackedFrees;		/*< Frees of a block that was not in the table. */
+} HeapProfilerStats_t;
+
+/**
+ * heap_profiler.h
+ *<pre>
+ void *pvHeapProfilerMalloc( size_t xSize, const char *pcFile, uint16_t usLine );
+ void vHeapProfilerFree( void *pv );
+ </pre>
+ *
+ * What pvPortMalloc() and vPortFree() are mapped to outside the heap
+ * files.  Not meant to be called directly.
+ *
+ * \defgroup pvHeapProfilerMalloc pvHeapProfilerMalloc
+ * \ingroup HeapProfiler
+ */
+void *pvHeapProfilerMalloc( size_t xSize, const char *pcFile, uint16_t usLine ) PRIVILEGED_FUNCTION;
+void vHeapProfilerFree( void *pv ) PRIVILEGED_FUNCTION;
+
+/**
+ * heap_profiler.h
+ *<pre>
+ void vHeapProfilerGetStats( HeapProfilerStats_t *pxStats );
+ </pre>
+ *
+ * Copies the times, the size histogram and the table usage.
+ *
+ * \defgroup vHeapProfilerGetStats vHeapProfilerGetStats
+ * \ingroup HeapProfiler
+ */
+void vHeapProfilerGetStats( HeapProfilerStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * heap_profiler.h
+ *<pre>
+ BaseType_t xHeapProfilerGetSite( UBaseType_t uxIndex, HeapProfilerSite_t *pxSite );
+ BaseType_t xHeapProfilerGetBlock( UBaseType_t uxIndex, HeapProfilerBlock_t *pxBlock );
+ </pre>
+ *
+ * Copies one entry of the table of call sites or of live blocks, so a report
+ * can walk a table without a buffer as large as the table.  Call sites keep
+ * their index, live blocks move when a block is freed: a block dump taken
+ * while other tasks allocate or free is only a sample.
+ *
+ * @return pdTRUE if the entry exists, pdFALSE past the end of the table.
+ *
+ * Example usage:
+   <pre>
+ UBaseType_t ux;
+ HeapProfilerSite_t xSite;
+
+	for( ux = 0; xHeapProfilerGetSite( ux, &xSite ) != pdFALSE; ux++ )
+	{
+		printf( "%s:%u %lu bytes\n", xSite.pcFile, xSite.usLine, ( unsigned long ) xSite.xLiveBytes );
+	}
+   </pre>
+ * \defgroup xHeapProfilerGetSite xHeapProfilerGetSite
+ * \ingroup HeapProfiler
+ */
+BaseType_t xHeapProfilerGetSite( UBaseType_t uxIndex, HeapProfilerSite_t *pxSite ) PRIVILEGED_FUNCTION;
+BaseType_t xHeapProfilerGetBlock( UBaseType_t uxIndex, HeapProfilerBlock_t *pxBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * heap_profiler.h
+ *<pre>
+ void vHeapProfilerReset( void );
+ </pre>
+ *
+ * Clears the times, the size histogram and the call counts of the call
+ * sites, to profile one phase of the application.  The live blocks and the
+ * live counts of the call sites are kept.
+ *
+ * \defgroup vHeapProfilerReset vHeapProfilerReset
+ * \ingroup HeapProfiler
+ */
+void vHeapProfilerReset( void ) PRIVILEGED_FUNCTION;
+
+/* Route the heap calls of everything but the heap itself through the
+profiler. */
+#ifndef HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+	#define pvPortMalloc( xSize )	pvHeapProfilerMalloc( ( xSize ), __FILE__, ( uint16_t ) __LINE__ )
+	#define vPortFree( pv )			vHeapProfilerFree( ( pv ) )
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAP_PROFILER_H */
+
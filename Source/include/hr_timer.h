@@ -0,0 +1,414 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef HR_TIMER_H
+#define HR_TIMER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include hr_timer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The high resolution timer service gives delays, timeouts and one-shot
+ * callbacks to the microsecond, where the tick only gives whole ticks with up
+ * to a tick of jitter.  It is compiled in when configUSE_HR_TIMER is set to 1
+ * in FreeRTOSConfig.h, and needs a port with a spare hardware timer: the port
+ * counts the time in portHR_TIMER_COUNTS_PER_US counts per microsecond, and
+ * raises an interrupt when the count reaches the deadline it was given.
+ *
+ * Any number of timers share that one compare: the active ones are kept in
+ * deadline order and the compare is always set to the nearest deadline.  When
+ * it is reached the interrupt calls the callbacks of the timers that are due,
+ * in deadline order, then sets the compare to the next deadline.  A deadline
+ * already passed when the timer is started is served at once.
+ *
+ * The time is a 32 bit count that wraps, deadlines are compared by their
+ * difference, so a timer can be started for up to 2^31 counts, more than 17
+ * minutes with 2 counts per microsecond.
+ *
+ * vTaskDelayUs() delays the calling task, and vHrTimeOutStart() /
+ * xHrTimeOutStop() put a microsecond timeout around any blocking call: when
+ * the timeout expires the task is taken off the object it waits for (see
+ * xTaskAbortDelayFromISR()) and the call returns as if its own timeout had
+ * expired.
+ *
+ * \defgroup HrTimer
+ */
+
+/* Conversions between microseconds and counts of the time. */
+#define hrtimerUS_TO_COUNTS( ulUs )			( ( uint32_t ) ( ulUs ) * ( uint32_t ) portHR_TIMER_COUNTS_PER_US )
+#define hrtimerCOUNTS_TO_US( ulCounts )		( ( uint32_t ) ( ulCounts ) / ( uint32_t ) portHR_TIMER_COUNTS_PER_US )
+
+/**
+ * hr_timer.h
+ *
+ * Type by which high resolution timers are referenced.
+ *
+ * \defgroup HrTimerHandle_t HrTimerHandle_t
+ * \ingroup HrTimer
+ */
+typedef void * HrTimerHandle_t;
+
+/*
+ * Callback of a high resolution timer.  It runs in the compare interrupt, with
+ * interrupts masked up to configKERNEL_INTERRUPT_PRIORITY, so it can only use
+ * the FromISR API functions.  It returns pdTRUE if one of them woke a task
+ * with a priority above the running task (their xHigherPriorityTaskWoken),
+ * pdFALSE otherwise.  It can start its own timer again, with vHrTimerStartAt()
+ * from its last deadline for a period without drift.
+ */
+typedef BaseType_t (*HrTimerCallbackFunction_t)( HrTimerHandle_t xTimer );
+
+/*
+ * The control structure of a timer created by xHrTimerCreateStatic().  Its
+ * content is private, only its size matters, it matches the structure used by
+ * hr_timer.c.
+ */
+typedef struct xSTATIC_HR_TIMER
+{
+	void *pvDummy1[ 3 ];
+	uint32_t ulDummy2;
+	uint8_t ucDummy3[ 2 ];
+} StaticHrTimer_t;
+
+/*
+ * A microsecond timeout of vHrTimeOutStart(), a timer of its own.
+ */
+typedef StaticHrTimer_t HrTimeOut_t;
+
+/**
+ * hr_timer.h
+ *<pre>
+ HrTimerHandle_t xHrTimerCreate( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID );
+ </pre>
+ *
+ * Creates a one-shot high resolution timer in memory allocated with
+ * pvPortMalloc().  The timer does not run until it is started.
+ *
+ * @param pxCallbackFunction The function called when the timer expires.
+ *
+ * @param pvTimerID A value for the callback, see pvHrTimerGetTimerID().
+ *
+ * @return The handle of the timer, or NULL if there was not enough heap.
+ *
+ * \defgroup xHrTimerCreate xHrTimerCreate
+ * \ingroup HrTimer
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	HrTimerHandle_t xHrTimerCreate( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * hr_timer.h
+ *<pre>
+ HrTimerHandle_t xHrTimerCreateStatic( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID, StaticHrTimer_t *pxTimerBuffer );
+ </pre>
+ *
+ * Creates a one-shot high resolution timer in memory provided by the
+ * application, nothing is allocated from the heap.
+ *
+ * @param pxCallbackFunction The function called when the timer expires.
+ *
+ * @param pvTimerID A value for the callback, see pvHrTimerGetTimerID().
+ *
+ * @param pxTimerBuffer The control structure of the timer.
+ *
+ * @return The handle of the timer.
+ *
+ * Example usage, a step pulse of a dispense motor driver:
+   <pre>
+ static StaticHrTimer_t xStepTimerBuffer;
+ static HrTimerHandle_t xStepTimer;
+
+ static BaseType_t prvStepEnd( HrTimerHandle_t xTimer )
+ {
+	_LATD0 = 0;
+	return pdFALSE;
+ }
+
+	xStepTimer = xHrTimerCreateStatic( prvStepEnd, NULL, &xStepTimerBuffer );
+
+	// Later, a 40us step pulse.
+	_LATD0 = 1;
+	vHrTimerStart( xStepTimer, 40 );
+   </pre>
+ * \defgroup xHrTimerCreateStatic xHrTimerCreateStatic
+ * \ingroup HrTimer
+ */
+HrTimerHandle_t xHrTimerCreateStatic( HrTimerCallbackFunction_t pxCallbackFunction, void *pvTimerID, StaticHrTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ void vHrTimerStart( HrTimerHandle_t xTimer, uint32_t ulDelayUs );
+ </pre>
+ *
+ * Starts a timer to expire ulDelayUs microseconds from now, or starts it again
+ * if it is running.  Can be called from tasks, from the interrupts that can
+ * use the FromISR API functions and from the timer callbacks.
+ *
+ * \defgroup vHrTimerStart vHrTimerStart
+ * \ingroup HrTimer
+ */
+void vHrTimerStart( HrTimerHandle_t xTimer, uint32_t ulDelayUs ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ void vHrTimerStartAt( HrTimerHandle_t xTimer, uint32_t ulDeadline );
+ </pre>
+ *
+ * Starts a timer to expire when the time of ulHrTimerGetTime() reaches
+ * ulDeadline, at once if it has already passed.  Can be called from the same
+ * places as vHrTimerStart().
+ *
+ * \defgroup vHrTimerStartAt vHrTimerStartAt
+ * \ingroup HrTimer
+ */
+void vHrTimerStartAt( HrTimerHandle_t xTimer, uint32_t ulDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ BaseType_t xHrTimerStop( HrTimerHandle_t xTimer );
+ </pre>
+ *
+ * Stops a timer.  Can be called from the same places as vHrTimerStart().
+ *
+ * @return pdTRUE if the timer was running, pdFALSE if it had expired or was
+ * not started.
+ *
+ * \defgroup xHrTimerStop xHrTimerStop
+ * \ingroup HrTimer
+ */
+BaseType_t xHrTimerStop( HrTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ BaseType_t xHrTimerIsActive( HrTimerHandle_t xTimer );
+ </pre>
+ *
+ * @return pdTRUE if the timer is running, pdFALSE otherwise.
+ *
+ * \defgroup xHrTimerIsActive xHrTimerIsActive
+ * \ingroup HrTimer
+ */
+BaseType_t xHrTimerIsActive( HrTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ uint32_t ulHrTimerGetDeadline( HrTimerHandle_t xTimer );
+ </pre>
+ *
+ * @return The time the timer expires, or expired last.
+ *
+ * \defgroup ulHrTimerGetDeadline ulHrTimerGetDeadline
+ * \ingroup HrTimer
+ */
+uint32_t ulHrTimerGetDeadline( HrTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ void *pvHrTimerGetTimerID( HrTimerHandle_t xTimer );
+ </pre>
+ *
+ * @return The pvTimerID the timer was created with.
+ *
+ * \defgroup pvHrTimerGetTimerID pvHrTimerGetTimerID
+ * \ingroup HrTimer
+ */
+void *pvHrTimerGetTimerID( HrTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ void vHrTimerDelete( HrTimerHandle_t xTimer );
+ </pre>
+ *
+ * Stops and deletes a timer.  The memory is freed if the timer was created by
+ * xHrTimerCreate().
+ *
+ * \defgroup vHrTimerDelete vHrTimerDelete
+ * \ingroup HrTimer
+ */
+void vHrTimerDelete( HrTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ uint32_t ulHrTimerGetTime( void );
+ </pre>
+ *
+ * @return The time, in portHR_TIMER_COUNTS_PER_US counts per microsecond,
+ * wrapping at 2^32.  Can be called from tasks and interrupts.
+ *
+ * \defgroup ulHrTimerGetTime ulHrTimerGetTime
+ * \ingroup HrTimer
+ */
+#define ulHrTimerGetTime() ulPortHrTimerGetTime()
+
+/**
+ * hr_timer.h
+ *<pre>
+ void vTaskDelayUs( uint32_t ulDelayUs );
+ </pre>
+ *
+ * Delays the calling task for ulDelayUs microseconds.  Delays up to
+ * configHR_TIMER_SPIN_US (20us by default) are busy waits, shorter than a
+ * context switch and back, longer ones block the task until a high resolution
+ * timer ends the delay.  The task then runs as soon as its priority allows.
+ *
+ * \defgroup vTaskDelayUs vTaskDelayUs
+ * \ingroup HrTimer
+ */
+void vTaskDelayUs( uint32_t ulDelayUs ) PRIVILEGED_FUNCTION;
+
+/**
+ * hr_timer.h
+ *<pre>
+ void vHrTimeOutStart( HrTimeOut_t *pxTimeOut, uint32_t ulTimeoutUs );
+ BaseType_t xHrTimeOutStop( HrTimeOut_t *pxTimeOut );
+ </pre>
+ *
+ * Gives the blocking calls the calling task makes between the two a timeout
+ * of ulTimeoutUs microseconds from the vHrTimeOutStart() call.  When it
+ * expires a call blocked on a queue, semaphore, mutex, stream buffer, block
+ * pool, reader-writer lock, notification or vTaskDelay() returns as if its
+ * own block time had run out, and the later calls do not block.  The block
+ * time of the calls still applies, it can be portMAX_DELAY.  A task waiting
+ * on an event group only has its wait ended if it was blocked when the
+ * timeout expired.
+ *
+ * Both must be called by the same task, xHrTimeOutStop() before the timeout
+ * goes out of scope.  xHrTimeOutStop() returns pdTRUE if the timeout expired,
+ * pdFALSE otherwise.
+ *
+ * Example usage, the reply of a peripheral on the MDB bus:
+   <pre>
+ HrTimeOut_t xReplyTimeOut;
+ BaseType_t xReceived;
+ uint16_t usByte;
+
+	vHrTimeOutStart( &xReplyTimeOut, 5000 );
+	xReceived = xQueueReceive( xMdbRxQueue, &usByte, portMAX_DELAY );
+	( void ) xHrTimeOutStop( &xReplyTimeOut );
+
+	if( xReceived != pdPASS )
+	{
+		// No reply within 5ms.
+	}
+   </pre>
+ * \defgroup vHrTimeOutStart vHrTimeOutStart
+ * \ingroup HrTimer
+ */
+void vHrTimeOutStart( HrTimeOut_t *pxTimeOut, uint32_t ulTimeoutUs ) PRIVILEGED_FUNCTION;
+BaseType_t xHrTimeOutStop( HrTimeOut_t *pxTimeOut ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS CALLED BY THE
+ * COMPARE INTERRUPT OF THE PORT.
+ *
+ * Calls the callbacks of the timers that are due and sets the compare to the
+ * next deadline.  Returns pdTRUE if a context switch is required.
+ */
+BaseType_t xHrTimerProcessFromISR( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Provided by the port, used by hr_timer.c.  All can be called from tasks and
+ * from interrupts, with interrupts masked.
+ *
+ * ulPortHrTimerGetTime() returns the time in portHR_TIMER_COUNTS_PER_US counts
+ * per microsecond, wrapping at 2^32.  It runs from the start of the scheduler.
+ *
+ * vPortHrTimerSetCompare() makes the port call xHrTimerProcessFromISR() from
+ * its compare interrupt once the time reaches ulDeadline, soon if it has
+ * already passed.  The interrupt may come earlier, the port does not have to
+ * cover the whole 2^31 counts in one go: nothing is due then and the compare
+ * is set again.
+ *
+ * vPortHrTimerClearCompare() cancels that interrupt.
+ */
+uint32_t ulPortHrTimerGetTime( void ) PRIVILEGED_FUNCTION;
+void vPortHrTimerSetCompare( uint32_t ulDeadline ) PRIVILEGED_FUNCTION;
+void vPortHrTimerClearCompare( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HR_TIMER_H */
+
@@ -445,6 +445,70 @@ void vListInsertEnd( List_t * const pxList, ListItem_t * const pxNewListItem ) P
  */
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove ) PRIVILEGED_FUNCTION;
 
+/*
+ * Event lists hold the tasks (or co-routines) blocked on a queue or semaphore,
+ * the highest priority one being the first to be unblocked, and tasks of equal
+ * priority being unblocked in the order they blocked.
+ *
+ * By default an event list is a plain list sorted by item value, which makes
+ * the insertion O(n) in the number of waiting tasks.  With
+ * configUSE_EVENT_LIST_BUCKETS set to 1 it is instead one FIFO list per
+ * priority plus a bitmap of the priorities that have waiters, so inserting a
+ * task and finding the highest priority one are both O(1).  A waiter can
+ * still leave the list with uxListRemove() (time out, deletion...): the bit
+ * of its priority is then cleared the next time the bucket is found empty.
+ *
+ * The event list API must only be used with interrupts disabled, or with the
+ * scheduler suspended and the queue that owns the event list locked.
+ */
+#if( configUSE_EVENT_LIST_BUCKETS == 1 )
+
+	typedef struct xEVENT_LIST
+	{
+		UBaseType_t uxWaitingPriorities;				/*< Bit n is set when xBuckets[ n ] may hold a waiter. */
+		List_t xBuckets[ configMAX_PRIORITIES ];		/*< Waiters of each priority, in the order they were inserted. */
+	} EventList_t;
+
+	/*
+	 * Initialise an event list, must be called before the event list is used.
+	 */
+	void vEventListInitialise( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Insert a list item after all the items of the same or higher priority.
+	 * uxPriority must be lower than configMAX_PRIORITIES.
+	 */
+	void vEventListInsert( EventList_t * const pxEventList, ListItem_t * const pxNewListItem, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the item to be unblocked first, or NULL if the event list is
+	 * empty.  The item is not removed from the event list.
+	 */
+	ListItem_t * pxEventListGetHighest( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+	#define listEVENT_LIST_IS_EMPTY( pxEventList )					( ( pxEventListGetHighest( pxEventList ) == NULL ) ? pdTRUE : pdFALSE )
+	#define listGET_OWNER_OF_HIGHEST_EVENT_ENTRY( pxEventList )	( pxEventListGetHighest( pxEventList )->pvOwner )
+	#define listGET_HIGHEST_EVENT_ENTRY( pxEventList )				pxEventListGetHighest( pxEventList )
+
+	/* True if the item is in one of the buckets of the event list. */
+	#define listIS_CONTAINED_WITHIN_EVENT_LIST( pxEventList, pxListItem )														\
+		( ( BaseType_t ) ( ( ( List_t * ) ( pxListItem )->pvContainer >= &( ( pxEventList )->xBuckets[ 0 ] ) ) &&			\
+						   ( ( List_t * ) ( pxListItem )->pvContainer < &( ( pxEventList )->xBuckets[ configMAX_PRIORITIES ] ) ) ) )
+
+#else
+
+	typedef List_t EventList_t;
+
+	/* The item value of the inserted item is already its inverted priority. */
+	#define vEventListInitialise( pxEventList )										vListInitialise( pxEventList )
+	#define vEventListInsert( pxEventList, pxNewListItem, uxPriority )				vListInsert( ( pxEventList ), ( pxNewListItem ) )
+	#define listEVENT_LIST_IS_EMPTY( pxEventList )									listLIST_IS_EMPTY( pxEventList )
+	#define listGET_OWNER_OF_HIGHEST_EVENT_ENTRY( pxEventList )					listGET_OWNER_OF_HEAD_ENTRY( pxEventList )
+	#define listGET_HIGHEST_EVENT_ENTRY( pxEventList )								( listLIST_IS_EMPTY( pxEventList ) ? NULL : listGET_HEAD_ENTRY( pxEventList ) )
+	#define listIS_CONTAINED_WITHIN_EVENT_LIST( pxEventList, pxListItem )			listIS_CONTAINED_WITHIN( ( pxEventList ), ( pxListItem ) )
+
+#endif /* configUSE_EVENT_LIST_BUCKETS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -75,6 +75,8 @@
 	#error "include FreeRTOS.h" must appear in source files before "include queue.h"
 #endif
 
+#include "list.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -101,6 +103,54 @@ typedef void * QueueSetHandle_t;
  */
 typedef void * QueueSetMemberHandle_t;
 
+/*
+ * The memory of a queue created by xQueueCreateStatic(), or of a semaphore or
+ * mutex created by one of the xSemaphoreCreate...Static() macros.  Its content
+ * is private, only its size matters, it matches the structure used by
+ * queue.c.
+ */
+typedef struct xSTATIC_QUEUE
+{
+	void *pvDummy1[ 3 ];
+
+	union
+	{
+		void *pvDummy2;
+		UBaseType_t uxDummy2;
+	} u;
+
+	EventList_t xDummy3[ 2 ];
+	UBaseType_t uxDummy4[ 3 ];
+	BaseType_t xDummy5[ 2 ];
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy6;
+		uint8_t ucDummy7;
+	#endif
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+		void *pvDummy8;
+	#endif
+
+	#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+		void *pvDummy12;
+		uint32_t ulDummy13;
+	#endif
+
+	#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+		BaseType_t xDummy9[ 2 ];
+	#endif
+
+	#if ( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxDummy11;
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy10;
+	#endif
+} StaticQueue_t;
+typedef StaticQueue_t StaticSemaphore_t;
+
 /* For internal use only. */
 #define	queueSEND_TO_BACK		( ( BaseType_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( BaseType_t ) 1 )
@@ -170,7 +220,60 @@ typedef void * QueueSetMemberHandle_t;
  * \defgroup xQueueCreate xQueueCreate
  * \ingroup QueueManagement
  */
-#define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( uxQueueLength, uxItemSize, queueQUEUE_TYPE_BASE )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_BASE ) )
+#endif
+
+/**
+ * queue. h
+ * <pre>
+ QueueHandle_t xQueueCreateStatic(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize,
+							  uint8_t *pucQueueStorage,
+							  StaticQueue_t *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * Creates a new queue instance in memory given by the application, nothing
+ * is allocated from the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be
+ * set to 1 in FreeRTOSConfig.h.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param pucQueueStorage The storage area of the queue, at least
+ * ( uxQueueLength * uxItemSize ) bytes.  Must be NULL if uxItemSize is 0.
+ *
+ * @param pxQueueBuffer The structure that holds the state of the queue.
+ *
+ * @return The handle of the queue, which cannot be NULL as nothing is
+ * allocated.
+ *
+ * Example usage:
+   <pre>
+ #define QUEUE_LENGTH    10
+ #define ITEM_SIZE       sizeof( uint32_t )
+
+ static StaticQueue_t xQueueBuffer;
+ static uint8_t ucQueueStorage[ QUEUE_LENGTH * ITEM_SIZE ];
+
+ void vATask( void *pvParameters )
+ {
+ QueueHandle_t xQueue1;
+
+	xQueue1 = xQueueCreateStatic( QUEUE_LENGTH, ITEM_SIZE, ucQueueStorage, &xQueueBuffer );
+
+	// ... Rest of task code.
+ }
+ </pre>
+ * \defgroup xQueueCreateStatic xQueueCreateStatic
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer ) xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_BASE ) )
+#endif
 
 /**
  * queue. h
@@ -1459,6 +1562,125 @@ BaseType_t xQueueAltGenericReceive( QueueHandle_t xQueue, void * const pvBuffer,
 #define xQueueAltReceive( xQueue, pvBuffer, xTicksToWait ) xQueueAltGenericReceive( ( xQueue ), ( pvBuffer ), ( xTicksToWait ), pdFALSE )
 #define xQueueAltPeek( xQueue, pvBuffer, xTicksToWait ) xQueueAltGenericReceive( ( xQueue ), ( pvBuffer ), ( xTicksToWait ), pdTRUE )
 
+/*
+ * Zero copy access to a queue, available when configUSE_ZERO_COPY_QUEUES is
+ * set to 1 in FreeRTOSConfig.h.  Instead of copying an item in and out of the
+ * queue storage area, the functions below hand out a pointer to the slot the
+ * item occupies in the storage area:
+ *
+ *  + pvQueueAcquireWrite() returns the slot the next item is to be written to.
+ *    The item is built in place then posted with vQueueCommitWrite().  Until
+ *    it is committed the item is not visible to readers.
+ *
+ *  + pvQueueAcquireRead() returns the slot of the item at the front of the
+ *    queue.  The item is removed from the queue but its slot is not reused
+ *    until vQueueReleaseRead() is called.
+ *
+ * The acquire functions block in the same way as xQueueSend() and
+ * xQueueReceive(), and return NULL if no slot became available within
+ * xTicksToWait.  A queue has one write slot and one read slot that can be
+ * acquired at a time, a second writer (or reader) waits until the first one
+ * has committed (or released) its slot.  The slot must be committed or
+ * released by the task or interrupt that acquired it, before any other access
+ * to the queue by that task.
+ *
+ * Items written with vQueueCommitWrite() can be read with xQueueReceive().
+ * While a write slot is held xQueueSend() and its variants, from any task or
+ * interrupt, see the queue as full: they block or fail until the slot is
+ * committed, and uxQueueSpacesAvailable() returns 0.  A held read slot counts
+ * as occupied: xQueueSendToBack() needs one free slot besides it, while
+ * xQueueSendToFront() and xQueueOverwrite(), which would write to the held
+ * slot, and xQueueReceive() and xQueuePeek() block or fail until the slot is
+ * released.  A zero copy queue cannot be a member of a queue set.
+ *
+ * Example usage:
+ <pre>
+ Message_t *pxMessage;
+
+	pxMessage = ( Message_t * ) pvQueueAcquireWrite( xQueue, xBlockTime );
+	if( pxMessage != NULL )
+	{
+		pxMessage->ulValue = ulValue;
+		vQueueCommitWrite( xQueue );
+	}
+
+	...
+
+	pxMessage = ( Message_t * ) pvQueueAcquireRead( xQueue, portMAX_DELAY );
+	vProcess( pxMessage );
+	vQueueReleaseRead( xQueue );
+ </pre>
+ */
+void *pvQueueAcquireWrite( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vQueueCommitWrite( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+void *pvQueueAcquireRead( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vQueueReleaseRead( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Interrupt safe versions of the zero copy functions.  The acquire functions
+ * do not block, they return NULL if no slot is available.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if committing or releasing a slot
+ * unblocked a task of a higher priority than the interrupted task.
+ */
+void *pvQueueAcquireWriteFromISR( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+void vQueueCommitWriteFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void *pvQueueAcquireReadFromISR( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+void vQueueReleaseReadFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Batched access to a queue, available when configUSE_QUEUE_BATCH is set to 1
+ * in FreeRTOSConfig.h.  xQueueSend() and xQueueReceive() move one item per
+ * critical section and check the event lists for every item, the functions
+ * below move as many items as they can in one go:
+ *
+ *  + uxQueueSendMultiple() posts up to uxCount items from pvItems, an array of
+ *    items of the size the queue was created with, to the back of the queue.
+ *    As many items as there is space for are posted, the others are left for
+ *    the caller to post again.
+ *
+ *  + uxQueueReceiveMultiple() receives up to uxMaxCount items, as many as the
+ *    queue holds, into pvBuffer.
+ *
+ * Both block only while not a single item can be moved, in the same way as
+ * xQueueSend() and xQueueReceive(), and return the number of items moved, 0
+ * if none could be within xTicksToWait.  One waiting task is unblocked per
+ * item moved, so a single task waiting on the other side is unblocked once
+ * whatever the number of items.  Items posted with uxQueueSendMultiple() can
+ * be received with xQueueReceive() and the other way around.  uxCount and
+ * uxMaxCount must be at least 1: with nothing to move the call could only
+ * block as if the queue were full (or empty).
+ *
+ * The queue cannot be a semaphore, a mutex or a member of a queue set.  As
+ * xQueueSend() and xQueueReceive(), both count a slot held through the zero
+ * copy functions as occupied.
+ *
+ * Example usage, the UART RX interrupt passing the bytes it found in the FIFO:
+ <pre>
+ uint8_t ucFifo[ 4 ];
+ UBaseType_t uxBytes;
+ BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	uxBytes = uxReadFifo( ucFifo );
+	( void ) uxQueueSendMultipleFromISR( xRxQueue, ucFifo, uxBytes, &xHigherPriorityTaskWoken );
+	portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+
+	...
+
+	// In the task, everything received so far in one call.
+	uxBytes = uxQueueReceiveMultiple( xRxQueue, ucLine, sizeof( ucLine ), portMAX_DELAY );
+ </pre>
+ */
+UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Interrupt safe versions of the batched functions, which do not block.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if moving the items unblocked a
+ * task of a higher priority than the interrupted task.
+ */
+UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * The functions defined above are for passing data to and from tasks.  The
  * functions below are the equivalents for passing data to and from
@@ -1480,8 +1702,18 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use xSemaphoreCreateMutexWithCeiling() or
+ * xSemaphoreCreateMutexWithCeilingStatic() instead of calling these functions
+ * directly.
+ */
+QueueHandle_t xQueueCreateCeilingMutex( const uint8_t ucQueueType, const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCeilingMutexStatic( const uint8_t ucQueueType, const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Use xSemaphoreTakeMutexRecursive() or
  * xSemaphoreGiveMutexRecursive() instead of calling these functions directly.
@@ -1541,6 +1773,12 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION
  */
 QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 
+/*
+ * Generic version of the static queue creation function, which is in turn
+ * called by the static queue and semaphore creation macros.
+ */
+QueueHandle_t xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+
 /*
  * Queue sets provide a mechanism to allow a task to block (pend) on a read
  * operation from multiple queues or semaphores simultaneously.
@@ -1675,6 +1913,35 @@ QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, const Ti
  */
 QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
 
+/*
+ * Makes a queue or semaphore signal a task through its notification value
+ * rather than through a queue set: each time an item is posted to the queue,
+ * or the semaphore is given, ulBitsToSet are set in the notification value of
+ * the task, as xTaskNotify( pvTaskToNotify, ulBitsToSet, eSetBits ) would do.
+ * A task can then block on many queues, semaphores and other sources at once
+ * with xTaskNotifyWait(), each source with a bit of its own, without the
+ * container queue and the extra copy of every post that a queue set needs.
+ * configUSE_OBJECT_NOTIFY_BITS must be set to 1 in FreeRTOSConfig.h.
+ *
+ * The bits of a source may be set for several items, so on waking the task
+ * should receive from (or take) each source whose bit is set with a block time
+ * of 0 until it is empty.  Unlike a queue set, any task can still receive
+ * from the queue.  The bits are set at once if the queue already holds items.
+ *
+ * Stream buffers have vStreamBufferSetNotifyBits().  An interrupt or a timer
+ * callback can set a bit of its own with xTaskNotifyFromISR() or
+ * xTaskNotify() directly.
+ *
+ * @param xQueueOrSemaphore The queue or semaphore (cast to a
+ * QueueSetMemberHandle_t type).
+ *
+ * @param pvTaskToNotify The handle of the task to notify, NULL to stop the
+ * notifications.
+ *
+ * @param ulBitsToSet The bits to set in the notification value of the task.
+ */
+void vQueueSetNotifyBits( QueueSetMemberHandle_t xQueueOrSemaphore, void *pvTaskToNotify, const uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+
 /* Not public API functions. */
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue, BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
@@ -1682,6 +1949,17 @@ void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber ) PRI
 UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 uint8_t ucQueueGetQueueType( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only, by the priority inheritance code of tasks.c with
+ * interrupts disabled.  The priority of a task blocked on xMutex has changed to
+ * uxNewPriority: move its event list item to the position of that priority in
+ * the list of the tasks waiting for the mutex.  Returns the holder of the
+ * mutex, and sets *puxHighestWaitingPriority to the priority of the highest
+ * priority task waiting for it.  Returns NULL if the task is no longer waiting
+ * for the mutex.
+ */
+void *pvQueueRequeueMutexWaiter( QueueHandle_t xMutex, ListItem_t * const pxWaiterListItem, UBaseType_t uxNewPriority, UBaseType_t * const puxHighestWaitingPriority ) PRIVILEGED_FUNCTION;
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,280 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include rw_lock.h"
+#endif
+
+#include "list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A reader-writer lock protects data that is read far more often than it is
+ * written.  Any number of tasks can hold the lock for reading at the same
+ * time, a task that holds it for writing holds it alone.
+ *
+ * Writers have preference: once a writer waits for the lock, tasks that want
+ * to read it wait too, until no writer waits any more, so a steady flow of
+ * readers cannot keep a writer out.  The waiting writers get the lock one
+ * after the other, the highest priority one first, then all the waiting
+ * readers are let in at once, the highest priority one running first.
+ *
+ * A task that blocks on the lock while a writer holds it lends its priority to
+ * the writer, as a task blocked on a mutex does to the mutex holder
+ * (configUSE_MUTEXES).  Readers holding the lock do not inherit: a writer
+ * waits for as long as the lowest priority of them reads.
+ *
+ * The lock cannot be taken recursively: a task that holds it for reading and
+ * asks for it again waits behind any writer that waits for the task to give
+ * it back.  It cannot be used from interrupts.  It needs configUSE_MUTEXES or
+ * INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h.
+ *
+ * A task must not be deleted while it waits in xRWLockTakeWrite(), from the
+ * time it blocks until it has run again and the call has returned: the
+ * writer is counted as waiting until then, and a count left behind by a
+ * deleted task keeps every reader out for good (see xRWLockTakeWrite()).
+ *
+ * \defgroup RWLock
+ */
+
+/**
+ * rw_lock.h
+ *
+ * Type by which reader-writer locks are referenced.
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+typedef void * RWLockHandle_t;
+
+/*
+ * The control structure of a reader-writer lock created by
+ * xRWLockCreateStatic().  Its content is private, only its size matters, it
+ * matches the structure used by rw_lock.c.
+ */
+typedef struct xSTATIC_RW_LOCK
+{
+	void *pvDummy1;
+	UBaseType_t uxDummy2[ 2 ];
+	EventList_t xDummy3[ 2 ];
+	uint8_t ucDummy4;
+} StaticRWLock_t;
+
+/**
+ * rw_lock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreate( void );
+ </pre>
+ *
+ * Creates a reader-writer lock in memory allocated with pvPortMalloc().
+ *
+ * @return The handle of the lock, or NULL if there was not enough heap.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rw_lock.h
+ *<pre>
+ RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxStaticRWLock );
+ </pre>
+ *
+ * Creates a reader-writer lock in memory provided by the application, nothing
+ * is allocated from the heap.
+ *
+ * @param pxStaticRWLock The control structure of the lock.
+ *
+ * @return The handle of the lock.
+ *
+ * Example usage:
+   <pre>
+ static StaticRWLock_t xConfigLockBuffer;
+ RWLockHandle_t xConfigLock;
+
+	xConfigLock = xRWLockCreateStatic( &xConfigLockBuffer );
+   </pre>
+ * \defgroup xRWLockCreateStatic xRWLockCreateStatic
+ * \ingroup RWLock
+ */
+RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxStaticRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Takes the lock for reading.  The task blocks for up to xTicksToWait while a
+ * writer holds the lock or waits for it.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL if the time ran out.  A lock
+ * taken must be given back with vRWLockGiveRead().
+ *
+ * \defgroup xRWLockTakeRead xRWLockTakeRead
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ void vRWLockGiveRead( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Gives back a lock taken with xRWLockTakeRead().  The last reader to give it
+ * back lets the highest priority waiting writer in.
+ *
+ * \defgroup vRWLockGiveRead vRWLockGiveRead
+ * \ingroup RWLock
+ */
+void vRWLockGiveRead( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Takes the lock for writing.  The task blocks for up to xTicksToWait while
+ * other tasks hold the lock, for reading or writing.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL if the time ran out.  A lock
+ * taken must be given back with vRWLockGiveWrite() by the same task.
+ *
+ * A writer that blocks is counted as waiting until the call returns, the
+ * readers that come meanwhile wait for it, even once it has been woken and
+ * has not run yet.  The count is only taken back by the call itself, when the
+ * lock is taken or the time runs out (or the wait is aborted): the task must
+ * not be deleted while it is blocked in the call or woken and not yet
+ * returned from it, the readers would then wait forever and vRWLockDelete()
+ * would assert.
+ *
+ * \defgroup xRWLockTakeWrite xRWLockTakeWrite
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ void vRWLockGiveWrite( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Gives back a lock taken with xRWLockTakeWrite(), and lets in the next
+ * waiting writer, or else all the waiting readers.
+ *
+ * \defgroup vRWLockGiveWrite vRWLockGiveWrite
+ * \ingroup RWLock
+ */
+void vRWLockGiveWrite( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ UBaseType_t uxRWLockGetReaders( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * The number of tasks holding the lock for reading.
+ *
+ * \defgroup uxRWLockGetReaders uxRWLockGetReaders
+ * \ingroup RWLock
+ */
+UBaseType_t uxRWLockGetReaders( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ *<pre>
+ void vRWLockDelete( RWLockHandle_t xRWLock );
+ </pre>
+ *
+ * Deletes a reader-writer lock that no task holds or is blocked on.  The
+ * memory is freed if the lock was created by xRWLockCreate().
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLock
+ */
+void vRWLockDelete( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RW_LOCK_H */
+
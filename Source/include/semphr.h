@@ -128,14 +128,16 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup vSemaphoreCreateBinary vSemaphoreCreateBinary
  * \ingroup Semaphores
  */
-#define vSemaphoreCreateBinary( xSemaphore )																							\
-	{																																	\
-		( xSemaphore ) = xQueueGenericCreate( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_BINARY_SEMAPHORE );	\
-		if( ( xSemaphore ) != NULL )																									\
-		{																																\
-			( void ) xSemaphoreGive( ( xSemaphore ) );																					\
-		}																																\
-	}
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define vSemaphoreCreateBinary( xSemaphore )																							\
+		{																																	\
+			( xSemaphore ) = xQueueGenericCreate( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_BINARY_SEMAPHORE );	\
+			if( ( xSemaphore ) != NULL )																									\
+			{																																\
+				( void ) xSemaphoreGive( ( xSemaphore ) );																					\
+			}																																\
+		}
+#endif
 
 /**
  * semphr. h
@@ -182,7 +184,42 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup vSemaphoreCreateBinary vSemaphoreCreateBinary
  * \ingroup Semaphores
  */
-#define xSemaphoreCreateBinary() xQueueGenericCreate( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_BINARY_SEMAPHORE )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateBinary() xQueueGenericCreate( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_BINARY_SEMAPHORE )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateBinaryStatic( StaticSemaphore_t *pxSemaphoreBuffer )</pre>
+ *
+ * The same as xSemaphoreCreateBinary(), but the semaphore is created in
+ * pxSemaphoreBuffer, given by the application, instead of being allocated
+ * from the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @param pxSemaphoreBuffer The structure that holds the state of the
+ * semaphore.
+ *
+ * @return Handle to the created semaphore, which cannot be NULL.
+ *
+ * Example usage:
+ <pre>
+ static StaticSemaphore_t xSemaphoreBuffer;
+ SemaphoreHandle_t xSemaphore;
+
+ void vATask( void * pvParameters )
+ {
+    xSemaphore = xSemaphoreCreateBinaryStatic( &xSemaphoreBuffer );
+
+    // The semaphore can now be used, it must first be 'given'.
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateBinaryStatic xSemaphoreCreateBinaryStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateBinaryStatic( pxSemaphoreBuffer ) xQueueGenericCreateStatic( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, ( pxSemaphoreBuffer ), queueQUEUE_TYPE_BINARY_SEMAPHORE )
+#endif
 
 /**
  * semphr. h
@@ -690,7 +727,27 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup vSemaphoreCreateMutex vSemaphoreCreateMutex
  * \ingroup Semaphores
  */
-#define xSemaphoreCreateMutex() xQueueCreateMutex( queueQUEUE_TYPE_MUTEX )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateMutex() xQueueCreateMutex( queueQUEUE_TYPE_MUTEX )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexStatic( StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * The same as xSemaphoreCreateMutex(), but the mutex is created in
+ * pxMutexBuffer, given by the application, instead of being allocated from
+ * the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return Handle to the created mutex, which cannot be NULL.
+ *
+ * \defgroup xSemaphoreCreateMutexStatic xSemaphoreCreateMutexStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
+#endif
 
 
 /**
@@ -745,7 +802,88 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup vSemaphoreCreateMutex vSemaphoreCreateMutex
  * \ingroup Semaphores
  */
-#define xSemaphoreCreateRecursiveMutex() xQueueCreateMutex( queueQUEUE_TYPE_RECURSIVE_MUTEX )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateRecursiveMutex() xQueueCreateMutex( queueQUEUE_TYPE_RECURSIVE_MUTEX )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic( StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * The same as xSemaphoreCreateRecursiveMutex(), but the mutex is created in
+ * pxMutexBuffer, given by the application, instead of being allocated from
+ * the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return Handle to the created mutex, which cannot be NULL.
+ *
+ * \defgroup xSemaphoreCreateRecursiveMutexStatic xSemaphoreCreateRecursiveMutexStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateRecursiveMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_RECURSIVE_MUTEX, ( pxMutexBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexWithCeiling( UBaseType_t uxCeilingPriority )</pre>
+ *
+ * Creates a mutex that uses the immediate priority ceiling protocol instead
+ * of waiting for contention to apply priority inheritance.  A task that takes
+ * the mutex runs at uxCeilingPriority until it gives back the last mutex it
+ * holds, so the other tasks that take the mutex, which must all have a
+ * priority of uxCeilingPriority or below, cannot preempt it while it holds
+ * the mutex.  None of them ever blocks on the mutex, and there is no switch
+ * to the holder and back to raise its priority.
+ *
+ * A task that blocks while it holds the mutex still lets the other tasks
+ * run, and one that then tries to take the mutex blocks and is handled with
+ * priority inheritance like any other mutex.
+ *
+ * The mutex is otherwise used like the ones created with
+ * xSemaphoreCreateMutex(), with xSemaphoreTake() and xSemaphoreGive().  It
+ * cannot be used with the alternative API.  Requires
+ * configUSE_CEILING_MUTEXES to be set to 1 in FreeRTOSConfig.h.
+ *
+ * @param uxCeilingPriority The highest priority of the tasks that take the
+ * mutex.
+ *
+ * @return Handle to the created mutex, or NULL if there was not enough heap.
+ *
+ * Example usage:
+ <pre>
+ SemaphoreHandle_t xMutex;
+
+ void vSetup( void )
+ {
+    // The mutex is shared by tasks of priority 1 to 3.
+    xMutex = xSemaphoreCreateMutexWithCeiling( 3 );
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateMutexWithCeiling xSemaphoreCreateMutexWithCeiling
+ * \ingroup Semaphores
+ */
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	#define xSemaphoreCreateMutexWithCeiling( uxCeilingPriority ) xQueueCreateCeilingMutex( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexWithCeilingStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * The same as xSemaphoreCreateMutexWithCeiling(), but the mutex is created in
+ * pxMutexBuffer, given by the application, instead of being allocated from
+ * the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return Handle to the created mutex, which cannot be NULL.
+ *
+ * \defgroup xSemaphoreCreateMutexWithCeilingStatic xSemaphoreCreateMutexWithCeilingStatic
+ * \ingroup Semaphores
+ */
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	#define xSemaphoreCreateMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
 
 /**
  * semphr. h
@@ -808,7 +946,27 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup xSemaphoreCreateCounting xSemaphoreCreateCounting
  * \ingroup Semaphores
  */
-#define xSemaphoreCreateCounting( uxMaxCount, uxInitialCount ) xQueueCreateCountingSemaphore( ( uxMaxCount ), ( uxInitialCount ) )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateCounting( uxMaxCount, uxInitialCount ) xQueueCreateCountingSemaphore( ( uxMaxCount ), ( uxInitialCount ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCountingStatic( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount, StaticSemaphore_t *pxSemaphoreBuffer )</pre>
+ *
+ * The same as xSemaphoreCreateCounting(), but the semaphore is created in
+ * pxSemaphoreBuffer, given by the application, instead of being allocated
+ * from the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * @return Handle to the created semaphore, which cannot be NULL.
+ *
+ * \defgroup xSemaphoreCreateCountingStatic xSemaphoreCreateCountingStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateCountingStatic( uxMaxCount, uxInitialCount, pxSemaphoreBuffer ) xQueueCreateCountingSemaphoreStatic( ( uxMaxCount ), ( uxInitialCount ), ( pxSemaphoreBuffer ) )
+#endif
 
 /**
  * semphr. h
@@ -839,6 +997,23 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define xSemaphoreGetMutexHolder( xSemaphore ) xQueueGetMutexHolder( ( xSemaphore ) )
 
+/**
+ * semphr.h
+ * <pre>void vSemaphoreSetNotifyBits( SemaphoreHandle_t xSemaphore, TaskHandle_t xTaskToNotify, uint32_t ulBitsToSet );</pre>
+ *
+ * Sets ulBitsToSet in the notification value of xTaskToNotify each time the
+ * semaphore is given, so the task can wait for it and other sources together
+ * with xTaskNotifyWait().  The task then takes the semaphore with a block time
+ * of 0.  See vQueueSetNotifyBits() in queue.h.  configUSE_OBJECT_NOTIFY_BITS
+ * must be set to 1 in FreeRTOSConfig.h.
+ *
+ * \defgroup vSemaphoreSetNotifyBits vSemaphoreSetNotifyBits
+ * \ingroup Semaphores
+ */
+#if( configUSE_OBJECT_NOTIFY_BITS == 1 )
+	#define vSemaphoreSetNotifyBits( xSemaphore, xTaskToNotify, ulBitsToSet ) vQueueSetNotifyBits( ( QueueSetMemberHandle_t ) ( xSemaphore ), ( void * ) ( xTaskToNotify ), ( ulBitsToSet ) )
+#endif
+
 #endif /* SEMAPHORE_H */
 
 
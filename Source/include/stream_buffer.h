@@ -0,0 +1,346 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include stream_buffer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A stream buffer carries a stream of bytes from a single writer to a single
+ * reader, typically from an interrupt to a task.  Unlike a queue of bytes, any
+ * number of bytes is written or read in one call, and the data path takes no
+ * critical section: the writer only moves the head index and the reader only
+ * moves the tail index.
+ *
+ * The reader can block until data arrives and the writer until space is
+ * freed.  A blocked reader is only woken once the buffer holds at least the
+ * trigger level number of bytes, so a task can wait for a whole burst instead
+ * of being woken for every byte.
+ *
+ * Blocking uses the direct to task notification of the blocked task, so a task
+ * must not wait on a stream buffer while it also uses its notification for
+ * something else.  If there is more than one writer (or reader) the calls must
+ * be serialised by the application, for example by a mutex or by holding off
+ * the interrupt that writes.
+ *
+ * \defgroup StreamBuffer
+ */
+
+/**
+ * stream_buffer.h
+ *
+ * Type by which stream buffers are referenced.
+ *
+ * \defgroup StreamBufferHandle_t StreamBufferHandle_t
+ * \ingroup StreamBuffer
+ */
+typedef void * StreamBufferHandle_t;
+
+/*
+ * The control structure of a stream buffer created by
+ * xStreamBufferCreateStatic().  Its content is private, only its size matters,
+ * it matches the structure used by stream_buffer.c.
+ */
+typedef struct xSTATIC_STREAM_BUFFER
+{
+	size_t xDummy1[ 4 ];
+	void *pvDummy2[ 3 ];
+	#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+		void *pvDummy4;
+		uint32_t ulDummy5;
+	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy3;
+	#endif
+} StaticStreamBuffer_t;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+ </pre>
+ *
+ * Creates a stream buffer.  The storage is allocated with pvPortMalloc().
+ *
+ * @param xBufferSizeBytes The number of bytes the buffer can hold.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be in the buffer
+ * before a reader blocked on it is woken.  0 is taken as 1.
+ *
+ * @return The handle of the stream buffer, or NULL if there was not enough
+ * heap or the trigger level is larger than the buffer.
+ *
+ * \defgroup xStreamBufferCreate xStreamBufferCreate
+ * \ingroup StreamBuffer
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, uint8_t *pucStreamBufferStorage, StaticStreamBuffer_t *pxStaticStreamBuffer );
+ </pre>
+ *
+ * Creates a stream buffer in memory provided by the application, nothing is
+ * allocated from the heap.  Requires configSUPPORT_STATIC_ALLOCATION to be
+ * set to 1 in FreeRTOSConfig.h.
+ *
+ * @param pucStreamBufferStorage The storage area, which must be at least
+ * xBufferSizeBytes + 1 bytes: the buffer keeps one byte free to tell a full
+ * buffer from an empty one.
+ *
+ * @param pxStaticStreamBuffer The control structure of the buffer.
+ *
+ * The other parameters are those of xStreamBufferCreate().
+ *
+ * @return The handle of the stream buffer, or NULL if the trigger level is
+ * larger than the buffer.
+ *
+ * Example usage:
+   <pre>
+ #define RX_SIZE    64
+
+ static uint8_t ucRxStorage[ RX_SIZE + 1 ];
+ static StaticStreamBuffer_t xRxStreamBuffer;
+ StreamBufferHandle_t xRxStream;
+
+	xRxStream = xStreamBufferCreateStatic( RX_SIZE, 1, ucRxStorage, &xRxStreamBuffer );
+   </pre>
+ * \defgroup xStreamBufferCreateStatic xStreamBufferCreateStatic
+ * \ingroup StreamBuffer
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	StreamBufferHandle_t xStreamBufferCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, uint8_t *pucStreamBufferStorage, StaticStreamBuffer_t *pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Writes bytes to a stream buffer from a task.  If there is not enough space
+ * the task blocks for up to xTicksToWait until all the bytes fit, then writes
+ * as many as fit.
+ *
+ * @return The number of bytes written.
+ *
+ * \defgroup xStreamBufferSend xStreamBufferSend
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xStreamBufferSend().  Writes as many bytes as fit,
+ * never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the write woke a task of
+ * a higher priority than the interrupted task, in which case a context switch
+ * should be requested before the interrupt exits.
+ *
+ * @return The number of bytes written.
+ *
+ * \defgroup xStreamBufferSendFromISR xStreamBufferSendFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Reads up to xBufferLengthBytes bytes from a stream buffer from a task.  If
+ * the buffer is empty the task blocks for up to xTicksToWait until the trigger
+ * level is reached, then reads whatever is available.  A buffer that is not
+ * empty is read straight away, even below the trigger level.
+ *
+ * @return The number of bytes read, 0 if the call timed out.
+ *
+ * \defgroup xStreamBufferReceive xStreamBufferReceive
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xStreamBufferReceive(), never blocks.
+ *
+ * @return The number of bytes read.
+ *
+ * \defgroup xStreamBufferReceiveFromISR xStreamBufferReceiveFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer );
+ size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Return the number of bytes that can be read and written without blocking.
+ * The writer only ever sees the space grow under it and the reader the data,
+ * so the values remain valid for the side asking.
+ *
+ * \defgroup xStreamBufferBytesAvailable xStreamBufferBytesAvailable
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevelBytes );
+ </pre>
+ *
+ * Changes the trigger level of a stream buffer.  0 is taken as 1.
+ *
+ * @return pdFAIL if the trigger level is larger than the buffer, else pdPASS.
+ *
+ * \defgroup xStreamBufferSetTriggerLevel xStreamBufferSetTriggerLevel
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevelBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferSetNotifyBits( StreamBufferHandle_t xStreamBuffer, void *pvTaskToNotify, uint32_t ulBitsToSet );
+ </pre>
+ *
+ * Sets ulBitsToSet in the notification value of the task pvTaskToNotify each
+ * time a send leaves at least the trigger level in the buffer, so the task can
+ * wait for the buffer and other sources together with xTaskNotifyWait(), then
+ * receive with a block time of 0.  NULL stops the notifications.  See
+ * vQueueSetNotifyBits() in queue.h.  configUSE_OBJECT_NOTIFY_BITS must be set
+ * to 1 in FreeRTOSConfig.h.
+ *
+ * \defgroup vStreamBufferSetNotifyBits vStreamBufferSetNotifyBits
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferSetNotifyBits( StreamBufferHandle_t xStreamBuffer, void *pvTaskToNotify, uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Empties a stream buffer.  Not done, and pdFAIL returned, while a task is
+ * blocked on it.
+ *
+ * @return pdPASS if the buffer was emptied.
+ *
+ * \defgroup xStreamBufferReset xStreamBufferReset
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Deletes a stream buffer that no task is blocked on and frees its memory.
+ *
+ * \defgroup vStreamBufferDelete vStreamBufferDelete
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_BUFFER_H */
+
@@ -175,6 +175,59 @@ typedef struct xTASK_STATUS
 	uint16_t usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/*
+ * The memory of a task created by xTaskCreateStatic().  Its content is private,
+ * only its size matters: it matches the task control block of tasks.c, which
+ * checks it with configASSERT().
+ */
+typedef struct xSTATIC_TCB
+{
+	void				*pxDummy1;
+	#if ( portUSING_MPU_WRAPPERS == 1 )
+		xMPU_SETTINGS	xDummy2;
+		BaseType_t		xDummy3;
+	#endif
+	ListItem_t			xDummy4[ 2 ];
+	UBaseType_t			uxDummy5;
+	void				*pxDummy6;
+	uint8_t				ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( portSTACK_GROWTH > 0 )
+		void			*pxDummy8;
+	#endif
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		UBaseType_t		uxDummy9;
+	#endif
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t		uxDummy10[ 2 ];
+	#endif
+	#if ( configUSE_MUTEXES == 1 )
+		UBaseType_t		uxDummy11[ 2 ];
+		void			*pvDummy11;
+	#endif
+	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+		void			*pxDummy12;
+	#endif
+	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+		void			*pvDummy13[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+	#endif
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		uint32_t		ulDummy14;
+	#endif
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		struct	_reent	xDummy15;
+	#endif
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		uint32_t		ulDummy16;
+		eTaskState		eDummy17;	/* An enum, as the notification state. */
+	#endif
+	#if ( configUSE_HR_TIMER == 1 )
+		uint8_t			ucDummy19;
+	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t			ucDummy18;
+	#endif
+} StaticTask_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -342,7 +395,64 @@ is used in assert() statements. */
  * \defgroup xTaskCreate xTaskCreate
  * \ingroup Tasks
  */
-#define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ) )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ) )
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateStatic(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint16_t usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  StackType_t *puxStackBuffer,
+							  StaticTask_t *pxTaskBuffer
+						  );</pre>
+ *
+ * Only available when configSUPPORT_STATIC_ALLOCATION is set to 1.
+ *
+ * Create a new task as xTaskCreate() does, in memory provided by the
+ * application instead of memory taken from the FreeRTOS heap, so nothing is
+ * allocated and the RAM used by the task is known when the application is
+ * linked.
+ *
+ * @param puxStackBuffer An array of at least usStackDepth StackType_t, used
+ * as the stack of the task.
+ *
+ * @param pxTaskBuffer The memory that holds the task control block.
+ *
+ * The other parameters are those of xTaskCreate().
+ *
+ * @return The handle of the task.  The task can not fail to be created.
+ *
+ * When configSUPPORT_STATIC_ALLOCATION is set to 1 the application must also
+ * provide the memory of the idle task, see vApplicationGetIdleTaskMemory(),
+ * and, if configUSE_TIMERS is set to 1, of the timer service task, see
+ * vApplicationGetTimerTaskMemory() in timers.h.
+ *
+ * Example usage:
+   <pre>
+ #define STACK_SIZE	200
+
+ static StackType_t xStack[ STACK_SIZE ];
+ static StaticTask_t xTaskBuffer;
+
+ void vOtherFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 xHandle = xTaskCreateStatic( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, xStack, &xTaskBuffer );
+ }
+   </pre>
+ * \defgroup xTaskCreateStatic xTaskCreateStatic
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
 
 /**
  * task. h
@@ -411,7 +521,9 @@ TaskHandle_t xHandle;
  * \defgroup xTaskCreateRestricted xTaskCreateRestricted
  * \ingroup Tasks
  */
-#define xTaskCreateRestricted( x, pxCreatedTask ) xTaskGenericCreate( ((x)->pvTaskCode), ((x)->pcName), ((x)->usStackDepth), ((x)->pvParameters), ((x)->uxPriority), (pxCreatedTask), ((x)->puxStackBuffer), ((x)->xRegions) )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xTaskCreateRestricted( x, pxCreatedTask ) xTaskGenericCreate( ((x)->pvTaskCode), ((x)->pcName), ((x)->usStackDepth), ((x)->pvParameters), ((x)->uxPriority), (pxCreatedTask), ((x)->puxStackBuffer), ((x)->xRegions) )
+#endif
 
 /**
  * task. h
@@ -1299,6 +1411,8 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const
  * configUSE_TRACE_FACILITY and configUSE_STATS_FORMATTING_FUNCTIONS must
  * both be defined as 1 for this function to be available.  See the
  * configuration section of the FreeRTOS.org website for more information.
+ * The function allocates its working array from the heap, so it is also
+ * only available when configSUPPORT_DYNAMIC_ALLOCATION is 1.
  *
  * NOTE 1: This function will disable interrupts for its duration.  It is
  * not intended for normal application runtime use but as a debug aid.
@@ -1344,7 +1458,8 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  * <PRE>void vTaskGetRunTimeStats( char *pcWriteBuffer );</PRE>
  *
  * configGENERATE_RUN_TIME_STATS and configUSE_STATS_FORMATTING_FUNCTIONS
- * must both be defined as 1 for this function to be available.  The application
+ * must both be defined as 1 for this function to be available, as must
+ * configSUPPORT_DYNAMIC_ALLOCATION.  The application
  * must also then provide definitions for
  * portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() and portGET_RUN_TIME_COUNTER_VALUE()
  * to configure a peripheral timer/counter and return the timers current count
@@ -1880,7 +1995,7 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  * portTICK_PERIOD_MS can be used to convert kernel ticks into a real time
  * period.
  */
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnEventList( EventList_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*
@@ -1894,7 +2009,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
  * indefinitely, whereas vTaskPlaceOnEventList() does.
  *
  */
-void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, const TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList, const TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
@@ -1920,9 +2035,22 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, const TickType
  * @return pdTRUE if the task being removed has a higher priority than the task
  * making the call, otherwise pdFALSE.
  */
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
 BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION WITHIN AN ISR.
+ *
+ * The version of xTaskRemoveFromUnorderedEventList() used by
+ * xEventGroupSetBitsFromISR() when configUSE_EVENT_GROUP_DIRECT_ISR is 1.  The
+ * unblocked task is held in the pending ready list if the scheduler is
+ * suspended.
+ */
+BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -1961,6 +2089,21 @@ BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const
  */
 void vTaskMissedYield( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * HR_TIMER.C, ONLY AVAILABLE WHEN configUSE_HR_TIMER IS SET TO 1.
+ *
+ * xTaskAbortDelayFromISR() is called with interrupts masked when the
+ * microsecond delay or timeout of xTask expires.  A blocked task is made
+ * ready, and from then on every blocking call of the task times out at once
+ * without blocking, until the task calls xTaskClearDelayAborted(), which
+ * returns pdTRUE if that was the case.  xTaskAbortDelayFromISR() returns
+ * pdFAIL and does nothing while the scheduler is suspended, a task may then be
+ * walking the event list xTask is on: the caller has to try again later.
+ */
+BaseType_t xTaskAbortDelayFromISR( TaskHandle_t xTask, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskClearDelayAborted( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Returns the scheduler state as taskSCHEDULER_RUNNING,
  * taskSCHEDULER_NOT_STARTED or taskSCHEDULER_SUSPENDED.
@@ -1969,9 +2112,29 @@ BaseType_t xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Raises the priority of the mutex holder to that of the calling task should
- * the mutex holder have a priority less than the calling task.
+ * the mutex holder have a priority less than the calling task, and records
+ * pvMutex as the mutex the calling task is about to block on.  If the holder
+ * is itself blocked on a mutex the priority is passed on to the holder of that
+ * mutex, and so on along the chain.
+ */
+void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder, void * const pvMutex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task timed out waiting for a mutex.  Lowers the
+ * priority of the mutex holder, and of the tasks further along the chain, to
+ * what the tasks still waiting need, uxHighestPriorityWaitingTask being the
+ * priority of the highest priority task still waiting for the mutex (or the
+ * ceiling of a ceiling mutex, if higher).
  */
-void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task takes a ceiling mutex.  Raises the priority of
+ * the calling task to uxCeilingPriority if it is lower.  The priority goes
+ * back to the base priority when the task gives back the last mutex it holds,
+ * as after priority inheritance.
+ */
+void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
 
 /*
  * Set the priority of a task back to its proper priority in the case that it
@@ -1981,10 +2144,20 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
 
 /*
  * Generic version of the task creation function which is in turn called by the
- * xTaskCreate() and xTaskCreateRestricted() macros.
+ * xTaskCreate() and xTaskCreateRestricted() macros.  Only available when
+ * configSUPPORT_DYNAMIC_ALLOCATION is set to 1, the TCB being allocated.
  */
 BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/*
+ * Only used when configSUPPORT_STATIC_ALLOCATION is set to 1, and then
+ * provided by the application: passes out the memory of the idle task, created
+ * by vTaskStartScheduler(), as given to xTaskCreateStatic().
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );
+#endif
+
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
  */
@@ -128,6 +128,25 @@ typedef void (*TimerCallbackFunction_t)( TimerHandle_t xTimer );
  */
 typedef void (*PendedFunction_t)( void *, uint32_t );
 
+/*
+ * The memory of a timer created by xTimerCreateStatic().  Its content is
+ * private, only its size matters, it matches the structure used by timers.c.
+ */
+typedef struct xSTATIC_TIMER
+{
+	void				*pvDummy1;
+	ListItem_t			xDummy2;
+	TickType_t			xDummy3;
+	UBaseType_t			uxDummy4;
+	void				*pvDummy5[ 2 ];
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t		uxDummy6;
+	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t			ucDummy7;
+	#endif
+} StaticTimer_t;
+
 /**
  * TimerHandle_t xTimerCreate( 	const char * const pcTimerName,
  * 								TickType_t xTimerPeriodInTicks,
@@ -257,7 +276,30 @@ typedef void (*PendedFunction_t)( void *, uint32_t );
  * }
  * @endverbatim
  */
-TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
+
+/**
+ * TimerHandle_t xTimerCreateStatic( const char * const pcTimerName,
+ * 									 TickType_t xTimerPeriodInTicks,
+ * 									 UBaseType_t uxAutoReload,
+ * 									 void * pvTimerID,
+ * 									 TimerCallbackFunction_t pxCallbackFunction,
+ * 									 StaticTimer_t *pxTimerBuffer );
+ *
+ * The same as xTimerCreate(), but the timer is created in pxTimerBuffer,
+ * given by the application, instead of being allocated from the heap.
+ * Requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h.
+ *
+ * @param pxTimerBuffer The structure that holds the state of the timer.  It
+ * must remain valid until the timer is deleted.
+ *
+ * @return The handle of the timer, or NULL if xTimerPeriodInTicks is 0.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
 
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
@@ -1130,6 +1172,18 @@ BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend, void *pvPar
  */
 const char * pcTimerGetTimerName( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/*
+ * When configSUPPORT_STATIC_ALLOCATION is 1 the timer service task and its
+ * command queue are not allocated from the heap.  The queue is kept inside
+ * timers.c, the application provides the TCB and the stack of the task by
+ * defining this function, which is called once when the scheduler starts.
+ * *pusTimerTaskStackSize is set to configTIMER_TASK_STACK_DEPTH before the
+ * call.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize );
+#endif
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
@@ -0,0 +1,144 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TRACE_EVENTS_H
+#define TRACE_EVENTS_H
+
+/*
+ * Event and object codes of the records of the trace recorder
+ * (trace_recorder.h).  This file does not depend on any other header, host
+ * tools decoding a captured trace include it too.  Codes are never reused,
+ * new events get new numbers.
+ *
+ * A record is 8 bytes: a 32 bit time stamp, the event code, the ID of the
+ * object concerned and a 16 bit parameter.  The object IDs are given by the
+ * recorder when the objects are created, ID 0 stands for an object that was
+ * created while the object table was full.
+ */
+
+/* Object types, as given in the object table.  The queue types follow the
+ucQueueType values of queue.h: traceobjectQUEUE + queueQUEUE_TYPE_MUTEX is
+traceobjectMUTEX, and so on. */
+#define traceobjectTASK						( 1 )
+#define traceobjectQUEUE					( 2 )
+#define traceobjectMUTEX					( 3 )
+#define traceobjectCOUNTING_SEMAPHORE		( 4 )
+#define traceobjectBINARY_SEMAPHORE			( 5 )
+#define traceobjectRECURSIVE_MUTEX			( 6 )
+#define traceobjectEVENT_GROUP				( 7 )
+#define traceobjectMARK						( 8 )	/*< Named by the application for its own marks. */
+
+/* Task events.  The object is the task, the parameter its priority unless
+stated otherwise. */
+#define traceeventTASK_SWITCHED_IN			( 1 )
+#define traceeventTASK_READY				( 2 )	/*< Moved to the ready list. */
+#define traceeventTASK_DELAY				( 3 )	/*< Running task blocked by vTaskDelay() or vTaskDelayUntil(). */
+#define traceeventTASK_SUSPEND				( 4 )
+#define traceeventTASK_RESUME				( 5 )
+#define traceeventTASK_PRIORITY_SET			( 6 )	/*< Parameter: the new priority. */
+#define traceeventTASK_PRIORITY_INHERIT		( 7 )	/*< Object: the mutex holder, parameter: the priority it inherits. */
+#define traceeventTASK_PRIORITY_DISINHERIT	( 8 )	/*< Object: the mutex holder, parameter: the priority it returns to. */
+#define traceeventTASK_DELETE				( 9 )
+
+/* Queue and semaphore events.  The object is the queue, the parameter the
+number of items it held before the operation. */
+#define traceeventQUEUE_SEND				( 16 )
+#define traceeventQUEUE_SEND_FAILED			( 17 )
+#define traceeventQUEUE_RECEIVE				( 18 )
+#define traceeventQUEUE_RECEIVE_FAILED		( 19 )
+#define traceeventQUEUE_PEEK				( 20 )
+#define traceeventQUEUE_BLOCK_ON_SEND		( 21 )	/*< Running task blocked, the queue is full. */
+#define traceeventQUEUE_BLOCK_ON_RECEIVE	( 22 )	/*< Running task blocked, the queue is empty. */
+#define traceeventQUEUE_SEND_FROM_ISR		( 23 )
+#define traceeventQUEUE_SEND_FROM_ISR_FAILED	( 24 )
+#define traceeventQUEUE_RECEIVE_FROM_ISR	( 25 )
+#define traceeventQUEUE_RECEIVE_FROM_ISR_FAILED	( 26 )
+
+/* Task notification events.  The object is the task notified, or the
+running task for the wait events, the parameter is 0. */
+#define traceeventNOTIFY					( 32 )
+#define traceeventNOTIFY_FROM_ISR			( 33 )
+#define traceeventNOTIFY_WAIT_BLOCK			( 34 )	/*< Running task blocked waiting for a notification. */
+#define traceeventNOTIFY_WAIT				( 35 )	/*< Running task returns from the wait, notified or not. */
+
+/* Event group events.  The object is the event group, the parameter the low
+16 bits of the bits set or waited for. */
+#define traceeventEVENT_GROUP_SET			( 40 )
+#define traceeventEVENT_GROUP_SET_FROM_ISR	( 41 )
+#define traceeventEVENT_GROUP_WAIT_BLOCK	( 42 )	/*< Running task blocked waiting for the bits. */
+#define traceeventEVENT_GROUP_WAIT_END		( 43 )	/*< Running task returns from the wait, the parameter is 1 on timeout. */
+
+/* Application marks.  The object is a traceobjectMARK, the parameter is
+given by the application. */
+#define traceeventMARK_BEGIN				( 48 )	/*< Start of an interval. */
+#define traceeventMARK_END					( 49 )	/*< End of the interval started by the last traceeventMARK_BEGIN of the same object. */
+#define traceeventMARK						( 50 )	/*< Single point in time. */
+
+#endif /* TRACE_EVENTS_H */
+
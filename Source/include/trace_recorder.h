@@ -0,0 +1,333 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include trace_recorder.h"
+#endif
+
+#include "trace_events.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The trace recorder keeps the last configTRACE_RECORDER_RECORDS kernel
+ * events in a ring buffer in RAM, to see afterwards which task ran when, what
+ * it waited for and what woke it up.  It is compiled in when
+ * configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h, it then defines
+ * the trace macros of FreeRTOS.h, and needs configUSE_TRACE_FACILITY.
+ *
+ * A record is 8 bytes: a time stamp read with configTRACE_RECORDER_GET_TIME(),
+ * the event code, the ID of the task, queue or event group concerned and a
+ * 16 bit parameter, see trace_events.h.  Objects are given an ID from 1 when
+ * they are created, stored in their uxTaskNumber, uxQueueNumber or
+ * uxEventGroupNumber, and their name is kept in a table of
+ * configTRACE_RECORDER_OBJECTS entries.  Queues are named when they are added
+ * to the queue registry.  IDs are not given back when an object is deleted,
+ * objects created once the table is full get ID 0.
+ *
+ * Events are recorded with interrupts masked, the oldest record being
+ * overwritten when the buffer is full.  The tick interrupt is not recorded,
+ * it would fill the buffer.  The application can add its own marks, for
+ * example around a transaction, with vTraceRecorderMarkBegin() and
+ * vTraceRecorderMarkEnd().
+ *
+ * The recorder only collects, the application reads the records and the
+ * object table with the functions below to send them to a host.
+ *
+ * \defgroup TraceRecorder
+ */
+
+/*
+ * One record of the ring buffer.
+ */
+typedef struct xTRACE_RECORDER_RECORD
+{
+	uint32_t ulTimeStamp;			/*< configTRACE_RECORDER_GET_TIME() when the event was recorded. */
+	uint8_t ucEvent;				/*< traceeventXXX code. */
+	uint8_t ucObject;				/*< ID of the object concerned, 0 if unknown. */
+	uint16_t usParam;				/*< Depends on the event. */
+} TraceRecorderRecord_t;
+
+/*
+ * One entry of the object table.
+ */
+typedef struct xTRACE_RECORDER_OBJECT
+{
+	char cName[ configTRACE_RECORDER_NAME_LEN ];	/*< Copy of the name, not terminated if it fills the array, empty if the object has no name. */
+	uint8_t ucType;					/*< traceobjectXXX type. */
+} TraceRecorderObject_t;
+
+/*
+ * State of the recorder, as returned by vTraceRecorderGetInfo().
+ */
+typedef struct xTRACE_RECORDER_INFO
+{
+	UBaseType_t uxRecords;			/*< Records held in the buffer. */
+	uint32_t ulWritten;				/*< Records written since the buffer was last cleared, the oldest ulWritten - uxRecords were overwritten. */
+	UBaseType_t uxObjects;			/*< Entries used in the object table, the IDs go from 1 to uxObjects. */
+	UBaseType_t uxLostObjects;		/*< Objects created while the table was full. */
+	BaseType_t xRecording;			/*< pdFALSE while stopped by vTraceRecorderStop(). */
+} TraceRecorderInfo_t;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderEvent( uint8_t ucEvent, UBaseType_t uxObject, UBaseType_t uxParam );
+ </pre>
+ *
+ * Adds a record to the buffer.  Called by the trace macros, from tasks and
+ * from interrupts, and by the mark macros below.
+ *
+ * \defgroup vTraceRecorderEvent vTraceRecorderEvent
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderEvent( uint8_t ucEvent, UBaseType_t uxObject, UBaseType_t uxParam ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ UBaseType_t uxTraceRecorderAddObject( uint8_t ucType, const char *pcName );
+ </pre>
+ *
+ * Adds an object to the object table.  Called by the trace macros when a task,
+ * a queue or an event group is created, and by the application to name its
+ * marks.
+ *
+ * @param ucType traceobjectXXX type of the object.
+ *
+ * @param pcName Name of the object, copied, or NULL.
+ *
+ * @return The ID of the object, or 0 if the table is full.
+ *
+ * Example usage:
+   <pre>
+ static UBaseType_t uxVendMark;
+
+	uxVendMark = uxTraceRecorderAddObject( traceobjectMARK, "vend" );
+
+	vTraceRecorderMarkBegin( uxVendMark, ucSlot );
+	...
+	vTraceRecorderMarkEnd( uxVendMark, ucSlot );
+   </pre>
+ * \defgroup uxTraceRecorderAddObject uxTraceRecorderAddObject
+ * \ingroup TraceRecorder
+ */
+UBaseType_t uxTraceRecorderAddObject( uint8_t ucType, const char *pcName ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderSetObjectName( UBaseType_t uxObject, const char *pcName );
+ </pre>
+ *
+ * Names an object already in the table, called when a queue is added to the
+ * queue registry.
+ *
+ * \defgroup vTraceRecorderSetObjectName vTraceRecorderSetObjectName
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderSetObjectName( UBaseType_t uxObject, const char *pcName ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderMarkBegin( UBaseType_t uxMark, UBaseType_t uxParam );
+ void vTraceRecorderMarkEnd( UBaseType_t uxMark, UBaseType_t uxParam );
+ void vTraceRecorderMark( UBaseType_t uxMark, UBaseType_t uxParam );
+ </pre>
+ *
+ * Record the start or the end of an interval, or a single point in time, of
+ * an object named with uxTraceRecorderAddObject().  Can be called from tasks
+ * and from interrupts.
+ *
+ * \defgroup vTraceRecorderMark vTraceRecorderMark
+ * \ingroup TraceRecorder
+ */
+#define vTraceRecorderMarkBegin( uxMark, uxParam )	vTraceRecorderEvent( traceeventMARK_BEGIN, ( uxMark ), ( uxParam ) )
+#define vTraceRecorderMarkEnd( uxMark, uxParam )	vTraceRecorderEvent( traceeventMARK_END, ( uxMark ), ( uxParam ) )
+#define vTraceRecorderMark( uxMark, uxParam )		vTraceRecorderEvent( traceeventMARK, ( uxMark ), ( uxParam ) )
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderStart( void );
+ void vTraceRecorderStop( void );
+ void vTraceRecorderClear( void );
+ </pre>
+ *
+ * The recorder starts recording at power up.  vTraceRecorderStop() freezes
+ * the buffer, for example while it is read or once a fault is detected, until
+ * vTraceRecorderStart() is called.  vTraceRecorderClear() empties the buffer,
+ * the object table is kept.
+ *
+ * \defgroup vTraceRecorderStart vTraceRecorderStart
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderClear( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderGetInfo( TraceRecorderInfo_t *pxInfo );
+ BaseType_t xTraceRecorderGetRecord( UBaseType_t uxIndex, TraceRecorderRecord_t *pxRecord );
+ BaseType_t xTraceRecorderGetObject( UBaseType_t uxObject, TraceRecorderObject_t *pxObject );
+ </pre>
+ *
+ * Read the state of the recorder, one record, 0 being the oldest one held,
+ * and one entry of the object table by ID.  The recorder should be stopped
+ * while the records are read, each new record moves the oldest one.
+ *
+ * @return pdTRUE if the record or the object exists, else pdFALSE.
+ *
+ * Example usage:
+   <pre>
+ TraceRecorderInfo_t xInfo;
+ TraceRecorderRecord_t xRecord;
+ UBaseType_t ux;
+
+	vTraceRecorderStop();
+	vTraceRecorderGetInfo( &xInfo );
+
+	for( ux = 0; xTraceRecorderGetRecord( ux, &xRecord ) != pdFALSE; ux++ )
+	{
+		vSendToHost( &xRecord, sizeof( xRecord ) );
+	}
+
+	vTraceRecorderStart();
+   </pre>
+ * \defgroup vTraceRecorderGetInfo vTraceRecorderGetInfo
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderGetInfo( TraceRecorderInfo_t *pxInfo ) PRIVILEGED_FUNCTION;
+BaseType_t xTraceRecorderGetRecord( UBaseType_t uxIndex, TraceRecorderRecord_t *pxRecord ) PRIVILEGED_FUNCTION;
+BaseType_t xTraceRecorderGetObject( UBaseType_t uxObject, TraceRecorderObject_t *pxObject ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+ * Trace macros of FreeRTOS.h.  They are expanded in tasks.c, queue.c and
+ * event_groups.c, where the kernel structures are known.  The notification
+ * macros use the pxTCB variable of the functions they are called from.
+ *----------------------------------------------------------*/
+
+#define traceTASK_CREATE( pxNewTCB )						( pxNewTCB )->uxTaskNumber = uxTraceRecorderAddObject( traceobjectTASK, ( pxNewTCB )->pcTaskName )
+#define traceTASK_DELETE( pxTCB )							vTraceRecorderEvent( traceeventTASK_DELETE, ( pxTCB )->uxTaskNumber, ( pxTCB )->uxPriority )
+#define traceTASK_SWITCHED_IN()								vTraceRecorderEvent( traceeventTASK_SWITCHED_IN, pxCurrentTCB->uxTaskNumber, pxCurrentTCB->uxPriority )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )				vTraceRecorderEvent( traceeventTASK_READY, ( pxTCB )->uxTaskNumber, ( pxTCB )->uxPriority )
+#define traceTASK_DELAY()									vTraceRecorderEvent( traceeventTASK_DELAY, pxCurrentTCB->uxTaskNumber, pxCurrentTCB->uxPriority )
+#define traceTASK_DELAY_UNTIL()								vTraceRecorderEvent( traceeventTASK_DELAY, pxCurrentTCB->uxTaskNumber, pxCurrentTCB->uxPriority )
+#define traceTASK_SUSPEND( pxTCB )							vTraceRecorderEvent( traceeventTASK_SUSPEND, ( pxTCB )->uxTaskNumber, ( pxTCB )->uxPriority )
+#define traceTASK_RESUME( pxTCB )							vTraceRecorderEvent( traceeventTASK_RESUME, ( pxTCB )->uxTaskNumber, ( pxTCB )->uxPriority )
+#define traceTASK_RESUME_FROM_ISR( pxTCB )					vTraceRecorderEvent( traceeventTASK_RESUME, ( pxTCB )->uxTaskNumber, ( pxTCB )->uxPriority )
+#define traceTASK_PRIORITY_SET( pxTCB, uxNewPriority )		vTraceRecorderEvent( traceeventTASK_PRIORITY_SET, ( pxTCB )->uxTaskNumber, ( uxNewPriority ) )
+#define traceTASK_PRIORITY_INHERIT( pxTCB, uxPriority )		vTraceRecorderEvent( traceeventTASK_PRIORITY_INHERIT, ( pxTCB )->uxTaskNumber, ( uxPriority ) )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriority )	vTraceRecorderEvent( traceeventTASK_PRIORITY_DISINHERIT, ( pxTCB )->uxTaskNumber, ( uxPriority ) )
+
+#define traceQUEUE_CREATE( pxNewQueue )						( pxNewQueue )->uxQueueNumber = uxTraceRecorderAddObject( ( uint8_t ) ( traceobjectQUEUE + ( pxNewQueue )->ucQueueType ), NULL )
+#define traceCREATE_MUTEX( pxNewQueue )						traceQUEUE_CREATE( pxNewQueue )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )		vTraceRecorderSetObjectName( ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber, ( pcQueueName ) )
+#define traceQUEUE_SEND( pxQueue )							vTraceRecorderEvent( traceeventQUEUE_SEND, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FAILED( pxQueue )					vTraceRecorderEvent( traceeventQUEUE_SEND_FAILED, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE( pxQueue )						vTraceRecorderEvent( traceeventQUEUE_RECEIVE, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )				vTraceRecorderEvent( traceeventQUEUE_RECEIVE_FAILED, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK( pxQueue )							vTraceRecorderEvent( traceeventQUEUE_PEEK, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )				vTraceRecorderEvent( traceeventQUEUE_BLOCK_ON_SEND, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )			vTraceRecorderEvent( traceeventQUEUE_BLOCK_ON_RECEIVE, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )					vTraceRecorderEvent( traceeventQUEUE_SEND_FROM_ISR, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )			vTraceRecorderEvent( traceeventQUEUE_SEND_FROM_ISR_FAILED, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )				vTraceRecorderEvent( traceeventQUEUE_RECEIVE_FROM_ISR, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )		vTraceRecorderEvent( traceeventQUEUE_RECEIVE_FROM_ISR_FAILED, ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+
+#define traceTASK_NOTIFY()									vTraceRecorderEvent( traceeventNOTIFY, pxTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_FROM_ISR()							vTraceRecorderEvent( traceeventNOTIFY_FROM_ISR, pxTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()					vTraceRecorderEvent( traceeventNOTIFY_FROM_ISR, pxTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_TAKE_BLOCK()						vTraceRecorderEvent( traceeventNOTIFY_WAIT_BLOCK, pxCurrentTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_WAIT_BLOCK()						vTraceRecorderEvent( traceeventNOTIFY_WAIT_BLOCK, pxCurrentTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_TAKE()								vTraceRecorderEvent( traceeventNOTIFY_WAIT, pxCurrentTCB->uxTaskNumber, 0 )
+#define traceTASK_NOTIFY_WAIT()								vTraceRecorderEvent( traceeventNOTIFY_WAIT, pxCurrentTCB->uxTaskNumber, 0 )
+
+#define traceEVENT_GROUP_CREATE( pxEventBits )				( pxEventBits )->uxEventGroupNumber = uxTraceRecorderAddObject( traceobjectEVENT_GROUP, NULL )
+#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )			vTraceRecorderEvent( traceeventEVENT_GROUP_SET, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( uxBitsToSet ) )
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )	vTraceRecorderEvent( traceeventEVENT_GROUP_SET_FROM_ISR, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( uxBitsToSet ) )
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )	vTraceRecorderEvent( traceeventEVENT_GROUP_WAIT_BLOCK, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( uxBitsToWaitFor ) )
+#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )	vTraceRecorderEvent( traceeventEVENT_GROUP_WAIT_BLOCK, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( uxBitsToWaitFor ) )
+#define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred )	vTraceRecorderEvent( traceeventEVENT_GROUP_WAIT_END, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( xTimeoutOccurred ) )
+#define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred )	vTraceRecorderEvent( traceeventEVENT_GROUP_WAIT_END, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber, ( xTimeoutOccurred ) )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
+
@@ -238,3 +238,74 @@ List_t * const pxList = ( List_t * ) pxItemToRemove->pvContainer;
 }
 /*-----------------------------------------------------------*/
 
+
+#if( configUSE_EVENT_LIST_BUCKETS == 1 )
+
+	void vEventListInitialise( EventList_t * const pxEventList )
+	{
+	UBaseType_t uxPriority;
+
+		pxEventList->uxWaitingPriorities = ( UBaseType_t ) 0U;
+
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+		{
+			vListInitialise( &( pxEventList->xBuckets[ uxPriority ] ) );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vEventListInsert( EventList_t * const pxEventList, ListItem_t * const pxNewListItem, UBaseType_t uxPriority )
+	{
+		configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		/* The index of a bucket is never moved by listGET_OWNER_OF_NEXT_ENTRY()
+		so it stays on the end marker, and vListInsertEnd() places the item at
+		the back of the bucket. */
+		vListInsertEnd( &( pxEventList->xBuckets[ uxPriority ] ), pxNewListItem );
+		pxEventList->uxWaitingPriorities |= ( ( UBaseType_t ) 1U ) << uxPriority;
+	}
+	/*-----------------------------------------------------------*/
+
+	ListItem_t * pxEventListGetHighest( EventList_t * const pxEventList )
+	{
+	UBaseType_t uxTopPriority;
+	List_t *pxBucket;
+	ListItem_t *pxHighest = NULL;
+
+		while( ( pxHighest == NULL ) && ( pxEventList->uxWaitingPriorities != ( UBaseType_t ) 0U ) )
+		{
+			#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+			{
+				portGET_HIGHEST_PRIORITY( uxTopPriority, pxEventList->uxWaitingPriorities );
+			}
+			#else
+			{
+				uxTopPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+
+				while( ( pxEventList->uxWaitingPriorities & ( ( ( UBaseType_t ) 1U ) << uxTopPriority ) ) == ( UBaseType_t ) 0U )
+				{
+					--uxTopPriority;
+				}
+			}
+			#endif
+
+			pxBucket = &( pxEventList->xBuckets[ uxTopPriority ] );
+
+			if( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+			{
+				pxHighest = pxBucket->xListEnd.pxNext;
+			}
+			else
+			{
+				/* The waiters of this priority have all left the bucket with
+				uxListRemove() since the bit was set. */
+				pxEventList->uxWaitingPriorities &= ~( ( ( UBaseType_t ) 1U ) << uxTopPriority );
+			}
+		}
+
+		return pxHighest;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EVENT_LIST_BUCKETS */
+
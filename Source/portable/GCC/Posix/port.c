@@ -0,0 +1,1106 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX (Linux)
+ * simulator.
+ *
+ * Every task runs in its own pthread.  A task thread only executes while its
+ * task is in the Running state, all the other task threads are held on a
+ * semaphore.  Context switches requested by a task are performed by that task
+ * thread, which releases the thread of the next task then waits on its own
+ * semaphore.
+ *
+ * Interrupts are simulated the same way as in the MSVC-MingW port: numbered
+ * handlers executed by a dedicated thread (the thread that started the
+ * scheduler).  Before running a handler that thread sends portSIG_INTERRUPT to
+ * the running task thread and waits until that thread has stopped at a point
+ * where interrupts are enabled.  The handler then has exclusive access to the
+ * kernel, as it would on a single core target.
+ *
+ * Host library calls that take locks (stdio, malloc, pthread_create...) must
+ * be made with interrupts disabled when called from a task, otherwise the task
+ * can be held while owning the lock.
+ *
+ * In virtual time (vPortSetVirtualTime()) the tick is raised as soon as the
+ * idle task is switched in.  The interrupt thread then keeps the idle task
+ * held and processes ticks back to back until one of them makes another task
+ * ready, so blocked periods cost no host time while the tick hook still sees
+ * every tick.  A task that does not block (a busy wait) gets a tick each time
+ * it has used portBUSY_WAIT_NSEC_PER_TICK of CPU time.
+ *
+ * The high resolution timer of hr_timer.c (configUSE_HR_TIMER) counts
+ * microseconds from the start of the scheduler.  Its compare is one more
+ * simulated interrupt, raised when the host clock reaches the deadline, the
+ * interrupt thread waking up for whichever of the tick and the deadline comes
+ * first.  In virtual time the time is kept in microseconds with the tick, it
+ * goes straight to the deadline when the deadline comes before the next tick.
+ *----------------------------------------------------------*/
+
+#define _GNU_SOURCE
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if( configUSE_HR_TIMER == 1 )
+	#include "hr_timer.h"
+#endif
+
+#define portMAX_INTERRUPTS				( ( uint32_t ) sizeof( uint32_t ) * 8UL ) /* The number of bits in an uint32_t. */
+#define portSIG_INTERRUPT				SIGUSR1
+#define portNSEC_PER_TICK				( 1000000000L / configTICK_RATE_HZ )
+#define portUSEC_PER_TICK				( 1000000L / configTICK_RATE_HZ )
+
+/* Ticks that can be late before the simulated timer stops trying to catch up
+(the host was suspended in a debugger for example). */
+#define portMAX_LATE_TICKS				( 100L )
+
+/* In virtual time, CPU time a task that does not block uses per tick.  Much
+shorter than a tick so busy waits are cheap, much longer than the time a task
+normally runs between two blocking calls so only busy waits get ticks. */
+#ifndef portBUSY_WAIT_NSEC_PER_TICK
+	#define portBUSY_WAIT_NSEC_PER_TICK	( 100000L )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The stack of each task only holds an xThreadState structure, the thread has
+a stack of its own. */
+typedef struct
+{
+	/* Thread that executes the task. */
+	pthread_t xThread;
+
+	/* Posted to let the thread run. */
+	sem_t xResume;
+
+	/* Task function and its parameter. */
+	TaskFunction_t pxCode;
+	void *pvParameters;
+
+	/* Set when the thread has ended itself (task that deleted itself). */
+	volatile BaseType_t xClosed;
+
+	/* Set to make a held thread end (task deleted by another task). */
+	volatile BaseType_t xDying;
+
+} xThreadState;
+
+/*
+ * Entry point of every task thread.
+ */
+static void *prvThreadStart( void *pvParameters );
+
+/*
+ * Holds the calling thread until its task is selected to run again.
+ */
+static void prvSuspendSelf( xThreadState *pxThreadState );
+
+/*
+ * Stops the calling task thread if the interrupt thread is waiting for it and
+ * interrupts are enabled.  Called each time interrupts become enabled and from
+ * the portSIG_INTERRUPT handler.
+ */
+static void prvInterruptPoint( void );
+static void prvInterruptSignalHandler( int iSignal );
+
+/*
+ * Called by the interrupt thread, returns once the running task is stopped.
+ */
+static void prvHoldRunningTask( void );
+
+/*
+ * Waits for simulated interrupts and the simulated tick, and runs the
+ * handlers.  Only returns when the scheduler is ended.
+ */
+static void prvProcessSimulatedInterrupts( void );
+
+/*
+ * Records which thread is released to run.  In virtual time, switching in the
+ * idle task makes the next tick due, switching in another task restarts its
+ * busy wait count.
+ */
+static void prvSetRunningThread( xThreadState *pxThreadState );
+
+/*
+ * Adds a number of nanoseconds to a time.
+ */
+static void prvAddTime( struct timespec *pxTime, long lNsec );
+
+/*
+ * Virtual time only.  Returns pdTRUE when the running task has used
+ * portBUSY_WAIT_NSEC_PER_TICK of CPU time since it was switched in or got its
+ * last tick.  CPU time rather than host time, so a run does not depend on the
+ * load of the host.  Called with xInterruptMutex held.
+ */
+static BaseType_t prvBusyTaskTick( void );
+
+/*
+ * Interrupt handlers used by the kernel itself.
+ */
+static uint32_t prvProcessYieldInterrupt( void );
+static uint32_t prvProcessTickInterrupt( void );
+
+#if( configUSE_HR_TIMER == 1 )
+
+	/*
+	 * Handler of the compare interrupt of the high resolution timer.
+	 */
+	static uint32_t prvProcessHrTimerInterrupt( void );
+
+	/*
+	 * Time of the high resolution timer, in microseconds since the scheduler
+	 * started.
+	 */
+	static uint64_t prvHrTimerNow( void );
+
+	/*
+	 * Called by the interrupt thread with xInterruptMutex held.  Raises the
+	 * compare interrupt if the deadline has been reached, and in real time
+	 * moves *pxWakeTime back to the deadline if it comes first.
+	 */
+	static void prvCheckHrTimer( struct timespec *pxWakeTime );
+
+	/*
+	 * Called by the interrupt thread with xInterruptMutex held, in virtual
+	 * time, when the time has to go on: goes to the deadline of the high
+	 * resolution timer if it comes before the next tick, to the next tick
+	 * otherwise, and raises the interrupt of the one reached.
+	 */
+	static void prvAdvanceVirtualTime( void );
+
+#endif /* configUSE_HR_TIMER */
+
+/*-----------------------------------------------------------*/
+
+/* Simulated interrupts waiting to be processed, one bit per interrupt.
+Protected by xInterruptMutex. */
+static uint32_t ulPendingInterrupts = 0UL;
+static pthread_mutex_t xInterruptMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xInterruptCond;
+
+/* Handlers for all the simulated interrupts. */
+static uint32_t (*ulIsrHandler[ portMAX_INTERRUPTS ])( void ) = { 0 };
+
+/* Thread of the task in the Running state.  Changed by a task thread that
+yields (with xRunningMutex held) or by the interrupt thread while the running
+task is held. */
+static xThreadState *pxRunningThread = NULL;
+static pthread_mutex_t xRunningMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Set by the interrupt thread when it waits for the running task to stop, the
+running task answers by posting xInterruptAck. */
+static int iInterruptRequest = 0;
+static sem_t xInterruptAck;
+
+/* Per thread, so per task, interrupt state.  A thread starts with interrupts
+disabled, they get enabled when its task first runs. */
+static __thread xThreadState *pxThisThread = NULL;
+static __thread volatile BaseType_t xInterruptsDisabled = pdTRUE;
+static __thread UBaseType_t uxCriticalNesting = 0;
+
+/* Only used by the interrupt thread. */
+static __thread BaseType_t xInIsr = pdFALSE;
+static BaseType_t xSwitchRequired = pdFALSE;
+
+/* Used to ensure nothing is processed during the startup sequence. */
+static BaseType_t xPortRunning = pdFALSE;
+static volatile BaseType_t xEndScheduler = pdFALSE;
+
+/* Virtual time, see vPortSetVirtualTime().  xIdleRunning is set when the idle
+task is switched in, xTaskSwitched on every switch.  Both are protected by
+xInterruptMutex. */
+static BaseType_t xVirtualTime = pdFALSE;
+static xThreadState *pxIdleThread = NULL;
+static BaseType_t xIdleRunning = pdFALSE;
+static BaseType_t xTaskSwitched = pdFALSE;
+
+#if( configUSE_HR_TIMER == 1 )
+
+	/* The high resolution time starts with the scheduler, at xHrTimerEpoch on
+	the host clock or at 0 in virtual time, ullVirtualTime being then the time
+	itself.  ullHrTimerCompare is the deadline, when xHrTimerArmed is set.  All
+	are protected by xInterruptMutex, ullVirtualTime is also read by the tasks
+	without it. */
+	static struct timespec xHrTimerEpoch;
+	static uint64_t ullVirtualTime = 0;
+	static uint64_t ullHrTimerCompare = 0;
+	static BaseType_t xHrTimerArmed = pdFALSE;
+
+#endif /* configUSE_HR_TIMER */
+
+/* Pointer to the TCB of the currently executing task. */
+extern void *pxCurrentTCB;
+
+/* The first member of a TCB is the top of stack, which points to the
+xThreadState of the task. */
+#define prvGetThreadState( pvTCB ) ( ( xThreadState * ) *( ( size_t * ) ( pvTCB ) ) )
+
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+xThreadState *pxThreadState;
+int iResult;
+
+	/* In this simulated case a stack is not initialised, but instead a thread
+	is created that will execute the task being created.  The xThreadState
+	object is placed at the top of the stack that was created for the task. */
+	pxThreadState = ( xThreadState * ) ( ( ( size_t ) ( pxTopOfStack + 1 ) - sizeof( xThreadState ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+	memset( pxThreadState, 0, sizeof( xThreadState ) );
+	pxThreadState->pxCode = pxCode;
+	pxThreadState->pvParameters = pvParameters;
+	sem_init( &( pxThreadState->xResume ), 0, 0 );
+
+	/* pthread_create() takes library locks, the calling task must not be
+	held while it owns one of them. */
+	portENTER_CRITICAL();
+	iResult = pthread_create( &( pxThreadState->xThread ), NULL, prvThreadStart, pxThreadState );
+	portEXIT_CRITICAL();
+
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	return ( StackType_t * ) pxThreadState;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadStart( void *pvParameters )
+{
+xThreadState *pxThreadState = ( xThreadState * ) pvParameters;
+sigset_t xSignals;
+
+	pxThisThread = pxThreadState;
+
+	/* The interrupt signal is only ever sent to task threads. */
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portSIG_INTERRUPT );
+	pthread_sigmask( SIG_UNBLOCK, &xSignals, NULL );
+
+	/* Wait until the task is selected to run for the first time. */
+	prvSuspendSelf( pxThreadState );
+	vPortEnableInterrupts();
+
+	pxThreadState->pxCode( pxThreadState->pvParameters );
+
+	/* Tasks must not return from their implementing function. */
+	configASSERT( pdFALSE );
+
+	#if( INCLUDE_vTaskDelete == 1 )
+	{
+		vTaskDelete( NULL );
+	}
+	#else
+	{
+		fprintf( stderr, "FreeRTOS: a task returned from its implementing function\n" );
+		abort();
+	}
+	#endif
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( xThreadState *pxThreadState )
+{
+	while( sem_wait( &( pxThreadState->xResume ) ) != 0 )
+	{
+		/* Interrupted by portSIG_INTERRUPT, keep waiting. */
+	}
+
+	if( pxThreadState->xDying != pdFALSE )
+	{
+		/* The task was deleted by another task, vPortDeleteThread() is waiting
+		for this thread to end. */
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptPoint( void )
+{
+xThreadState *pxThreadState = pxThisThread;
+
+	while( ( xInterruptsDisabled == pdFALSE ) &&
+		   ( pxThreadState != NULL ) &&
+		   ( __atomic_load_n( &pxRunningThread, __ATOMIC_SEQ_CST ) == pxThreadState ) &&
+		   ( __atomic_exchange_n( &iInterruptRequest, 0, __ATOMIC_SEQ_CST ) != 0 ) )
+	{
+		/* Let the interrupt thread run the handlers, then wait until this task
+		is selected to run again.  That may be straight away if the handlers
+		did not cause a context switch.  Interrupts are seen as disabled while
+		the thread is held so a later request is only answered once the task
+		really runs again. */
+		xInterruptsDisabled = pdTRUE;
+		__atomic_signal_fence( __ATOMIC_SEQ_CST );
+		sem_post( &xInterruptAck );
+		prvSuspendSelf( pxThreadState );
+		__atomic_signal_fence( __ATOMIC_SEQ_CST );
+		xInterruptsDisabled = pdFALSE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptSignalHandler( int iSignal )
+{
+int iSavedErrno = errno;
+
+	( void ) iSignal;
+
+	/* If interrupts are disabled the request is served by prvInterruptPoint()
+	once they are enabled again, as on the target. */
+	prvInterruptPoint();
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHoldRunningTask( void )
+{
+	pthread_mutex_lock( &xRunningMutex );
+	{
+		__atomic_store_n( &iInterruptRequest, 1, __ATOMIC_SEQ_CST );
+		pthread_kill( pxRunningThread->xThread, portSIG_INTERRUPT );
+	}
+	pthread_mutex_unlock( &xRunningMutex );
+
+	/* If the task was yielding, the request is answered by the next task
+	instead. */
+	while( sem_wait( &xInterruptAck ) != 0 )
+	{
+		/* Keep waiting. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+pthread_condattr_t xCondAttr;
+sigset_t xSignals;
+xThreadState *pxThreadState;
+
+	/* Install the interrupt handlers used by the scheduler itself. */
+	vPortSetInterruptHandler( portINTERRUPT_YIELD, prvProcessYieldInterrupt );
+	vPortSetInterruptHandler( portINTERRUPT_TICK, prvProcessTickInterrupt );
+
+	#if( configUSE_HR_TIMER == 1 )
+	{
+		vPortSetInterruptHandler( portINTERRUPT_HR_TIMER, prvProcessHrTimerInterrupt );
+		clock_gettime( CLOCK_MONOTONIC, &xHrTimerEpoch );
+	}
+	#endif
+
+	/* The simulated tick is timed against the monotonic clock. */
+	pthread_condattr_init( &xCondAttr );
+	pthread_condattr_setclock( &xCondAttr, CLOCK_MONOTONIC );
+	pthread_cond_init( &xInterruptCond, &xCondAttr );
+	pthread_condattr_destroy( &xCondAttr );
+
+	sem_init( &xInterruptAck, 0, 0 );
+
+	/* This thread becomes the interrupt thread, it never receives the
+	interrupt signal itself. */
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portSIG_INTERRUPT );
+	pthread_sigmask( SIG_BLOCK, &xSignals, NULL );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvInterruptSignalHandler;
+	sigemptyset( &xAction.sa_mask );
+	xAction.sa_flags = SA_RESTART;
+	sigaction( portSIG_INTERRUPT, &xAction, NULL );
+
+	xPortRunning = pdTRUE;
+
+	#if( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	{
+		pxIdleThread = prvGetThreadState( xTaskGetIdleTaskHandle() );
+	}
+	#endif
+
+	/* Start the highest priority task. */
+	pxThreadState = prvGetThreadState( pxCurrentTCB );
+	__atomic_store_n( &pxRunningThread, pxThreadState, __ATOMIC_SEQ_CST );
+	prvSetRunningThread( pxThreadState );
+	sem_post( &( pxThreadState->xResume ) );
+
+	/* Handle all simulated interrupts - including simulated ticks - until
+	the scheduler is ended. */
+	prvProcessSimulatedInterrupts();
+
+	xPortRunning = pdFALSE;
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvProcessYieldInterrupt( void )
+{
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvProcessTickInterrupt( void )
+{
+uint32_t ulSwitchRequired;
+
+	/* Process the tick itself. */
+	configASSERT( xPortRunning );
+	ulSwitchRequired = ( uint32_t ) xTaskIncrementTick();
+
+	return ulSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessSimulatedInterrupts( void )
+{
+struct timespec xNextTick, xNow, xWakeTime;
+uint32_t ulInterrupts, i;
+xThreadState *pxThreadState;
+BaseType_t xTaskHeld = pdFALSE;
+long lLate;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNextTick );
+
+	for( ;; )
+	{
+		pthread_mutex_lock( &xInterruptMutex );
+		{
+			for( ;; )
+			{
+				clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+				if( xVirtualTime != pdFALSE )
+				{
+					/* The next tick is due now if every task is blocked, or if
+					the running task does not block (a busy wait). */
+					#if( configUSE_HR_TIMER == 1 )
+					{
+						/* Or the deadline of the high resolution timer, if
+						it comes first.  Once it is reached the time does not
+						go on before it has been served. */
+						prvCheckHrTimer( NULL );
+
+						if( ( ( ulPendingInterrupts & ( 1UL << portINTERRUPT_HR_TIMER ) ) == 0UL ) &&
+							( ( xIdleRunning != pdFALSE ) || ( prvBusyTaskTick() != pdFALSE ) ) )
+						{
+							prvAdvanceVirtualTime();
+						}
+					}
+					#else
+					{
+						if( ( xIdleRunning != pdFALSE ) || ( prvBusyTaskTick() != pdFALSE ) )
+						{
+							ulPendingInterrupts |= ( 1UL << portINTERRUPT_TICK );
+						}
+					}
+					#endif /* configUSE_HR_TIMER */
+
+					/* Check the running task again a little later. */
+					xNextTick = xNow;
+					prvAddTime( &xNextTick, portBUSY_WAIT_NSEC_PER_TICK );
+				}
+				else
+				{
+					/* Has the simulated timer expired? */
+					lLate = ( xNow.tv_sec - xNextTick.tv_sec ) * 1000000000L + ( xNow.tv_nsec - xNextTick.tv_nsec );
+
+					if( lLate >= 0 )
+					{
+						ulPendingInterrupts |= ( 1UL << portINTERRUPT_TICK );
+
+						if( lLate > portMAX_LATE_TICKS * portNSEC_PER_TICK )
+						{
+							xNextTick = xNow;
+						}
+
+						prvAddTime( &xNextTick, portNSEC_PER_TICK );
+					}
+				}
+
+				xWakeTime = xNextTick;
+
+				#if( configUSE_HR_TIMER == 1 )
+				{
+					if( xVirtualTime == pdFALSE )
+					{
+						prvCheckHrTimer( &xWakeTime );
+					}
+				}
+				#endif
+
+				if( ( ulPendingInterrupts != 0UL ) || ( xEndScheduler != pdFALSE ) )
+				{
+					break;
+				}
+
+				pthread_cond_timedwait( &xInterruptCond, &xInterruptMutex, &xWakeTime );
+			}
+
+			ulInterrupts = ulPendingInterrupts;
+			ulPendingInterrupts = 0UL;
+		}
+		pthread_mutex_unlock( &xInterruptMutex );
+
+		if( xEndScheduler != pdFALSE )
+		{
+			break;
+		}
+
+		/* The handlers must not run while a task executes. */
+		if( xTaskHeld == pdFALSE )
+		{
+			prvHoldRunningTask();
+			xTaskHeld = pdTRUE;
+		}
+
+		if( xEndScheduler != pdFALSE )
+		{
+			break;
+		}
+
+		xInIsr = pdTRUE;
+		xSwitchRequired = pdFALSE;
+
+		for( i = 0; i < portMAX_INTERRUPTS; i++ )
+		{
+			if( ( ( ulInterrupts & ( 1UL << i ) ) != 0UL ) && ( ulIsrHandler[ i ] != NULL ) )
+			{
+				if( ulIsrHandler[ i ]() != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+			}
+		}
+
+		xInIsr = pdFALSE;
+
+		if( xEndScheduler != pdFALSE )
+		{
+			break;
+		}
+
+		if( xSwitchRequired != pdFALSE )
+		{
+			/* Select the next task to run. */
+			vTaskSwitchContext();
+		}
+
+		pxThreadState = prvGetThreadState( pxCurrentTCB );
+		prvSetRunningThread( pxThreadState );
+
+		/* In virtual time the idle task stays held while the ticks that find
+		every task blocked are processed, it is only released when another
+		task has to run. */
+		if( ( xVirtualTime == pdFALSE ) || ( pxThreadState != pxIdleThread ) )
+		{
+			/* Release the task now in the Running state. */
+			__atomic_store_n( &pxRunningThread, pxThreadState, __ATOMIC_SEQ_CST );
+			sem_post( &( pxThreadState->xResume ) );
+			xTaskHeld = pdFALSE;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HR_TIMER == 1 )
+
+	static uint32_t prvProcessHrTimerInterrupt( void )
+	{
+		return ( uint32_t ) xHrTimerProcessFromISR();
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvHrTimerNow( void )
+	{
+	struct timespec xNow;
+	long long llNsec;
+	uint64_t ullReturn;
+
+		if( xVirtualTime != pdFALSE )
+		{
+			ullReturn = __atomic_load_n( &ullVirtualTime, __ATOMIC_SEQ_CST );
+		}
+		else
+		{
+			clock_gettime( CLOCK_MONOTONIC, &xNow );
+			llNsec = ( long long ) ( xNow.tv_sec - xHrTimerEpoch.tv_sec ) * 1000000000LL + ( xNow.tv_nsec - xHrTimerEpoch.tv_nsec );
+			ullReturn = ( uint64_t ) ( llNsec / 1000LL );
+		}
+
+		return ullReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvCheckHrTimer( struct timespec *pxWakeTime )
+	{
+	struct timespec xDeadline;
+	long long llNsec;
+
+		if( xHrTimerArmed != pdFALSE )
+		{
+			if( prvHrTimerNow() >= ullHrTimerCompare )
+			{
+				ulPendingInterrupts |= ( 1UL << portINTERRUPT_HR_TIMER );
+				xHrTimerArmed = pdFALSE;
+			}
+			else if( pxWakeTime != NULL )
+			{
+				/* Host time of the deadline. */
+				xDeadline = xHrTimerEpoch;
+				llNsec = ( long long ) ullHrTimerCompare * 1000LL + xDeadline.tv_nsec;
+				xDeadline.tv_sec += ( time_t ) ( llNsec / 1000000000LL );
+				xDeadline.tv_nsec = ( long ) ( llNsec % 1000000000LL );
+
+				if( ( xDeadline.tv_sec < pxWakeTime->tv_sec ) ||
+					( ( xDeadline.tv_sec == pxWakeTime->tv_sec ) && ( xDeadline.tv_nsec < pxWakeTime->tv_nsec ) ) )
+				{
+					*pxWakeTime = xDeadline;
+				}
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvAdvanceVirtualTime( void )
+	{
+	uint64_t ullNextTick;
+
+		ullNextTick = ( ( ullVirtualTime / portUSEC_PER_TICK ) + 1ULL ) * portUSEC_PER_TICK;
+
+		if( ( xHrTimerArmed != pdFALSE ) && ( ullHrTimerCompare < ullNextTick ) )
+		{
+			__atomic_store_n( &ullVirtualTime, ullHrTimerCompare, __ATOMIC_SEQ_CST );
+			ulPendingInterrupts |= ( 1UL << portINTERRUPT_HR_TIMER );
+			xHrTimerArmed = pdFALSE;
+		}
+		else
+		{
+			__atomic_store_n( &ullVirtualTime, ullNextTick, __ATOMIC_SEQ_CST );
+			ulPendingInterrupts |= ( 1UL << portINTERRUPT_TICK );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulPortHrTimerGetTime( void )
+	{
+		return ( uint32_t ) prvHrTimerNow();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHrTimerSetCompare( uint32_t ulDeadline )
+	{
+	uint64_t ullNow;
+	int32_t lDelta;
+
+		/* Called with interrupts masked, the task cannot be held while it
+		owns the mutex. */
+		pthread_mutex_lock( &xInterruptMutex );
+		{
+			ullNow = prvHrTimerNow();
+			lDelta = ( int32_t ) ( ulDeadline - ( uint32_t ) ullNow );
+
+			if( lDelta < 0 )
+			{
+				lDelta = 0;
+			}
+
+			ullHrTimerCompare = ullNow + ( uint64_t ) lDelta;
+			xHrTimerArmed = pdTRUE;
+			pthread_cond_signal( &xInterruptCond );
+		}
+		pthread_mutex_unlock( &xInterruptMutex );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHrTimerClearCompare( void )
+	{
+		pthread_mutex_lock( &xInterruptMutex );
+		{
+			xHrTimerArmed = pdFALSE;
+		}
+		pthread_mutex_unlock( &xInterruptMutex );
+	}
+
+#endif /* configUSE_HR_TIMER */
+/*-----------------------------------------------------------*/
+
+static void prvAddTime( struct timespec *pxTime, long lNsec )
+{
+	pxTime->tv_nsec += lNsec;
+	if( pxTime->tv_nsec >= 1000000000L )
+	{
+		pxTime->tv_nsec -= 1000000000L;
+		pxTime->tv_sec++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvBusyTaskTick( void )
+{
+static long long llStartTime = 0;
+xThreadState *pxThreadState;
+struct timespec xCpuTime;
+clockid_t xClock;
+long long llCpuTime;
+BaseType_t xReturn = pdFALSE;
+
+	pxThreadState = __atomic_load_n( &pxRunningThread, __ATOMIC_SEQ_CST );
+
+	if( pthread_getcpuclockid( pxThreadState->xThread, &xClock ) != 0 )
+	{
+		return pdFALSE;
+	}
+
+	clock_gettime( xClock, &xCpuTime );
+	llCpuTime = ( long long ) xCpuTime.tv_sec * 1000000000LL + xCpuTime.tv_nsec;
+
+	if( xTaskSwitched != pdFALSE )
+	{
+		xTaskSwitched = pdFALSE;
+		llStartTime = llCpuTime;
+	}
+	else if( llCpuTime - llStartTime >= portBUSY_WAIT_NSEC_PER_TICK )
+	{
+		llStartTime = llCpuTime;
+		xReturn = pdTRUE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetRunningThread( xThreadState *pxThreadState )
+{
+	if( xVirtualTime != pdFALSE )
+	{
+		pthread_mutex_lock( &xInterruptMutex );
+		{
+			xIdleRunning = ( pxThreadState == pxIdleThread ) ? pdTRUE : pdFALSE;
+			xTaskSwitched = pdTRUE;
+			pthread_cond_signal( &xInterruptCond );
+		}
+		pthread_mutex_unlock( &xInterruptMutex );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+xThreadState *pxThreadState = pxThisThread, *pxNextThreadState;
+BaseType_t xWasDisabled;
+
+	if( pxThreadState == NULL )
+	{
+		/* Called from a simulated interrupt handler, switch when it returns. */
+		if( xInIsr != pdFALSE )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+
+		return;
+	}
+
+	/* Yields are performed even within a critical section, the interrupt
+	state belongs to the task and is restored when it runs again. */
+	xWasDisabled = xInterruptsDisabled;
+	xInterruptsDisabled = pdTRUE;
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+	pthread_mutex_lock( &xRunningMutex );
+	vTaskSwitchContext();
+	pxNextThreadState = prvGetThreadState( pxCurrentTCB );
+
+	if( pxNextThreadState != pxThreadState )
+	{
+		__atomic_store_n( &pxRunningThread, pxNextThreadState, __ATOMIC_SEQ_CST );
+		prvSetRunningThread( pxNextThreadState );
+		sem_post( &( pxNextThreadState->xResume ) );
+		pthread_mutex_unlock( &xRunningMutex );
+
+		prvSuspendSelf( pxThreadState );
+	}
+	else
+	{
+		pthread_mutex_unlock( &xRunningMutex );
+	}
+
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+	xInterruptsDisabled = xWasDisabled;
+
+	if( xWasDisabled == pdFALSE )
+	{
+		prvInterruptPoint();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	xSwitchRequired = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortInIsr( void )
+{
+	return xInIsr;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDeleteThread( void *pvTaskToDelete )
+{
+xThreadState *pxThreadState;
+
+	/* Find the thread being deleted. */
+	pxThreadState = prvGetThreadState( pvTaskToDelete );
+
+	/* The thread is held in prvSuspendSelf() unless it ended itself in
+	vPortCloseRunningThread(). */
+	if( pxThreadState->xClosed == pdFALSE )
+	{
+		pxThreadState->xDying = pdTRUE;
+		sem_post( &( pxThreadState->xResume ) );
+	}
+
+	/* The stack holding the thread state is freed on return. */
+	portENTER_CRITICAL();
+	pthread_join( pxThreadState->xThread, NULL );
+	portEXIT_CRITICAL();
+
+	sem_destroy( &( pxThreadState->xResume ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortCloseRunningThread( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+xThreadState *pxThreadState, *pxNextThreadState;
+
+	( void ) pxPendYield;
+
+	pxThreadState = prvGetThreadState( pvTaskToDelete );
+
+	/* The task is no longer in any list, switch to the next task and end this
+	thread instead of waiting to be selected again. */
+	xInterruptsDisabled = pdTRUE;
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+	pthread_mutex_lock( &xRunningMutex );
+	vTaskSwitchContext();
+	pxNextThreadState = prvGetThreadState( pxCurrentTCB );
+	pxThreadState->xClosed = pdTRUE;
+	__atomic_store_n( &pxRunningThread, pxNextThreadState, __ATOMIC_SEQ_CST );
+	prvSetRunningThread( pxNextThreadState );
+	sem_post( &( pxNextThreadState->xResume ) );
+	pthread_mutex_unlock( &xRunningMutex );
+
+	pthread_exit( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	pthread_mutex_lock( &xInterruptMutex );
+	xEndScheduler = pdTRUE;
+	pthread_cond_signal( &xInterruptCond );
+	pthread_mutex_unlock( &xInterruptMutex );
+
+	if( pxThisThread != NULL )
+	{
+		/* The interrupt thread may be waiting for this task to stop, it will
+		see xEndScheduler set and return from xPortStartScheduler(). */
+		sem_post( &xInterruptAck );
+
+		/* This thread never runs again. */
+		for( ;; )
+		{
+			sem_wait( &( pxThisThread->xResume ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+	if( ulInterruptNumber < portMAX_INTERRUPTS )
+	{
+		pthread_mutex_lock( &xInterruptMutex );
+		ulPendingInterrupts |= ( 1UL << ulInterruptNumber );
+		pthread_cond_signal( &xInterruptCond );
+		pthread_mutex_unlock( &xInterruptMutex );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+	void vPortSetVirtualTime( BaseType_t xEnable )
+	{
+		configASSERT( xPortRunning == pdFALSE );
+		xVirtualTime = xEnable;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t (*pvHandler)( void ) )
+{
+	if( ulInterruptNumber < portMAX_INTERRUPTS )
+	{
+		pthread_mutex_lock( &xInterruptMutex );
+		ulIsrHandler[ ulInterruptNumber ] = pvHandler;
+		pthread_mutex_unlock( &xInterruptMutex );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	xInterruptsDisabled = pdTRUE;
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+	xInterruptsDisabled = pdFALSE;
+
+	/* Serve an interrupt that became pending while they were disabled. */
+	prvInterruptPoint();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+UBaseType_t uxWasDisabled;
+
+	uxWasDisabled = ( UBaseType_t ) xInterruptsDisabled;
+	vPortDisableInterrupts();
+
+	return uxWasDisabled;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxWasDisabled )
+{
+	if( uxWasDisabled == ( UBaseType_t ) pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+	{
+		if( uxCriticalNesting == 1 )
+		{
+			vCriticalProfilerEnter( configCRITICAL_PROFILER_GET_CALLER() );
+		}
+	}
+	#endif /* configUSE_CRITICAL_PROFILER */
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	if( uxCriticalNesting > 0 )
+	{
+		uxCriticalNesting--;
+
+		if( uxCriticalNesting == 0 )
+		{
+			#if( configUSE_CRITICAL_PROFILER == 1 )
+			{
+				vCriticalProfilerExit();
+			}
+			#endif /* configUSE_CRITICAL_PROFILER */
+
+			vPortEnableInterrupts();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
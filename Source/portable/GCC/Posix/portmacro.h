@@ -0,0 +1,246 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions for the POSIX (Linux) simulator.
+ *
+ * Each task runs in its own pthread, only the thread of the task in the
+ * Running state is ever allowed to execute.  Interrupts are simulated in the
+ * same way as the MSVC-MingW port: numbered handlers executed by a dedicated
+ * interrupt thread while the running task is held.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	size_t
+#define portBASE_TYPE	long
+#define portPOINTER_SIZE_TYPE size_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+#endif
+
+/* Reads of a 16 or 32-bit tick count are atomic on every POSIX host. */
+#define portTICK_TYPE_IS_ATOMIC 1
+/*-----------------------------------------------------------*/
+
+/* Hardware specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			8
+#define portNOP()					__asm volatile( "" )
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  Disabling interrupts holds off the simulated
+interrupt thread until they are enabled again, the same way the IPL does on
+the target.  The nesting count is kept per thread, so per task. */
+void vPortDisableInterrupts( void );
+void vPortEnableInterrupts( void );
+void vPortEnterCritical( void );
+void vPortExitCritical( void );
+
+#define portDISABLE_INTERRUPTS()	vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()		vPortEnableInterrupts()
+#define portENTER_CRITICAL()		vPortEnterCritical()
+#define portEXIT_CRITICAL()			vPortExitCritical()
+
+/* Masking that can be nested, from tasks and simulated interrupts: returns
+whether interrupts were already disabled, they are only enabled again if they
+were not. */
+UBaseType_t uxPortSetInterruptMask( void );
+void vPortClearInterruptMask( UBaseType_t uxWasDisabled );
+
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vPortClearInterruptMask( x )
+/*-----------------------------------------------------------*/
+
+/* Task utilities.  portYIELD() may also be called from a simulated interrupt
+handler (as the PIC24 ISRs of the application do), in which case the switch is
+performed when the handler returns. */
+void vPortYield( void );
+void vPortYieldFromISR( void );
+
+#define portYIELD()					vPortYield()
+#define portYIELD_FROM_ISR( x )		if( ( x ) != pdFALSE ) vPortYieldFromISR()
+#define portEND_SWITCHING_ISR( x )	portYIELD_FROM_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Thread clean up when a task is deleted. */
+void vPortCloseRunningThread( void *pvTaskToDelete, volatile BaseType_t *pxPendYield );
+void vPortDeleteThread( void *pvTaskToDelete );
+#define portCLEAN_UP_TCB( pxTCB )	vPortDeleteThread( pxTCB )
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield ) vPortCloseRunningThread( ( pvTaskToDelete ), ( pxPendYield ) )
+/*-----------------------------------------------------------*/
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+	/* Check the configuration. */
+	#if( configMAX_PRIORITIES > 32 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#endif
+
+	/* Store/clear the ready priorities in a bit map. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - ( uint32_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) )
+
+#endif /* taskRECORD_READY_PRIORITY */
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+#define portINTERRUPT_YIELD				( 0UL )
+#define portINTERRUPT_TICK				( 1UL )
+#define portINTERRUPT_HR_TIMER			( 2UL )
+
+/* First interrupt number free for the application. */
+#define portFIRST_APP_INTERRUPT			( 3UL )
+
+/* The time of hr_timer.c is in microseconds, from the host monotonic clock or
+in virtual time (see vPortSetVirtualTime()). */
+#define portHR_TIMER_COUNTS_PER_US		( 1UL )
+
+/*
+ * Raise a simulated interrupt.  Each bit of a 32-bit mask represents one
+ * interrupt, the first three being used for the Yield, Tick and high
+ * resolution timer (configUSE_HR_TIMER) interrupts.  Can
+ * be called from a task, from a simulated interrupt handler or from any other
+ * host thread (a thread reading a pty for example).
+ */
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber );
+
+/*
+ * Install a handler to be called by the simulated interrupt thread.  The
+ * number must be at least portFIRST_APP_INTERRUPT and lower than 32.
+ *
+ * Handlers run while no task executes.  They may only use the FromISR API and
+ * must return a non-zero value if a context switch is required (or call
+ * portYIELD_FROM_ISR()).
+ */
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t (*pvHandler)( void ) );
+
+/* Returns pdTRUE when called from a simulated interrupt handler. */
+BaseType_t xPortInIsr( void );
+
+#if( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+	/*
+	 * Selects virtual time before the scheduler is started.  The tick is then
+	 * no longer timed by the host clock: it is raised as soon as the idle task
+	 * runs, so the tick count goes straight to the next unblock time when
+	 * every task is blocked, and a run only depends on its inputs.  Tasks
+	 * execute in zero virtual time, except a task that does not block (a busy
+	 * wait), which gets a tick each time it has used
+	 * portBUSY_WAIT_NSEC_PER_TICK (100us by default) of CPU time.
+	 *
+	 * The time of hr_timer.c (configUSE_HR_TIMER) goes on to the nearest
+	 * deadline when it comes before the next tick, so a high resolution
+	 * timer expires exactly on time.  Between two deadlines or ticks it stands
+	 * still: a busy wait on it, as vTaskDelayUs() does for short delays, lasts
+	 * until the next tick.
+	 */
+	void vPortSetVirtualTime( BaseType_t xEnable );
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
@@ -81,6 +81,10 @@
 #include "FreeRTOS.h"
 #include "task.h"
 
+#if( configUSE_HR_TIMER == 1 )
+	#include "hr_timer.h"
+#endif
+
 /* Hardware specifics. */
 #define portBIT_SET 1
 #define portTIMER_PRESCALE 8
@@ -104,6 +108,41 @@ not provided their own. */
 /* Records the nesting depth of calls to portENTER_CRITICAL(). */
 UBaseType_t uxCriticalNesting = 0xef;
 
+#if( configUSE_HR_TIMER == 1 )
+
+	/* Shortest period given to Timer4 for a deadline, in counts: it has to
+	be longer than the time taken to program it, a match already passed is
+	only seen after TMR4 wraps. */
+	#define portHR_TIMER_MIN_COUNTS		( 8L )
+
+	/* The time of hr_timer.c up to the last restart of TMR4.  The time is
+	ulHrTimerBase + TMR4, plus PR4 + 1 while a match is pending, as TMR4 went
+	back to 0 on the match. */
+	static volatile uint32_t ulHrTimerBase = 0;
+
+#endif /* configUSE_HR_TIMER */
+
+#if defined( __dsPIC30F__ ) || defined( __dsPIC33F__ )
+
+	/* 1 = only tasks that call portTASK_USES_DSP() have the accumulators and
+	DO loop registers saved as part of their context.  2 = every task has them
+	saved, which is the behaviour of previous versions of the port. */
+	#ifndef configUSE_TASK_DSP_SUPPORT
+		#define configUSE_TASK_DSP_SUPPORT 2
+	#endif
+
+	#if( configUSE_TASK_DSP_SUPPORT != 1 ) && ( configUSE_TASK_DSP_SUPPORT != 2 )
+		#error configUSE_TASK_DSP_SUPPORT must be set to 1 or 2
+	#endif
+
+	/* Set to pdTRUE if the running task has a DSP context.  Saved on and
+	restored from the task stack with the rest of the context, it must be in
+	near memory as the context switch code accesses it with PUSH, POP and
+	CP0. */
+	volatile UBaseType_t uxPortTaskUsesDSP __attribute__(( near )) = pdFALSE;
+
+#endif /* defined( __dsPIC30F__ ) || defined( __dsPIC33F__ ) */
+
 #if configKERNEL_INTERRUPT_PRIORITY != 1
 	#error If configKERNEL_INTERRUPT_PRIORITY is not 1 then the #32 in the following macros needs changing to equal the portINTERRUPT_BITS value, which is ( configKERNEL_INTERRUPT_PRIORITY << 5 )
 #endif
@@ -161,6 +200,9 @@ UBaseType_t uxCriticalNesting = 0xef;
 						"MOV	W0, _uxCriticalNesting	\n"																\
 						"POP	PSVPAG					\n"																\
 						"POP	CORCON					\n"																\
+						"POP	_uxPortTaskUsesDSP		\n"	/* Restore the DSP flag for the task... */					\
+						"CP0	_uxPortTaskUsesDSP		\n"	/* ...and only unstack the DSP registers if it is set. */	\
+						"BRA	Z, 1f					\n"																\
 						"POP	DOENDH					\n"																\
 						"POP	DOENDL					\n"																\
 						"POP	DOSTARTH				\n"																\
@@ -172,6 +214,7 @@ UBaseType_t uxCriticalNesting = 0xef;
 						"POP	ACCAU					\n"																\
 						"POP	ACCAH					\n"																\
 						"POP	ACCAL					\n"																\
+						"1:								\n"																\
 						"POP	TBLPAG					\n"																\
 						"POP	RCOUNT					\n"	/* Restore the registers from the stack. */					\
 						"POP	W14						\n"																\
@@ -198,6 +241,21 @@ UBaseType_t uxCriticalNesting = 0xef;
  */
 void vApplicationSetupTickTimerInterrupt( void );
 
+#if( configUSE_HR_TIMER == 1 )
+
+	/*
+	 * Start Timer4, the time and compare of hr_timer.c.
+	 */
+	static void prvSetupHrTimer( void );
+
+	/*
+	 * Adds the counts of TMR4 to ulHrTimerBase and restarts TMR4 from 0, for
+	 * a new period to be set.  Must be called with interrupts masked.
+	 */
+	static void prvRestartHrTimer( void );
+
+#endif /* configUSE_HR_TIMER */
+
 /*
  * See header file for description.
  */
@@ -224,22 +282,25 @@ const StackType_t xInitialStack[] =
 	0xeeee, /* W14 */
 	0xcdce, /* RCOUNT */
 	0xabac, /* TBLPAG */
+};
 
-	/* dsPIC specific registers. */
-	#ifdef MPLAB_DSPIC_PORT
-		0x0202, /* ACCAL */
-		0x0303, /* ACCAH */
-		0x0404, /* ACCAU */
-		0x0505, /* ACCBL */
-		0x0606, /* ACCBH */
-		0x0707, /* ACCBU */
-		0x0808, /* DCOUNT */
-		0x090a, /* DOSTARTL */
-		0x1010, /* DOSTARTH */
-		0x1110, /* DOENDL */
-		0x1212, /* DOENDH */
-	#endif
+/* dsPIC specific registers, only stacked for tasks that use the DSP. */
+#if( defined( __dsPIC30F__ ) || defined( __dsPIC33F__ ) ) && ( configUSE_TASK_DSP_SUPPORT == 2 )
+const StackType_t xInitialDSPStack[] =
+{
+	0x0202, /* ACCAL */
+	0x0303, /* ACCAH */
+	0x0404, /* ACCAU */
+	0x0505, /* ACCBL */
+	0x0606, /* ACCBH */
+	0x0707, /* ACCBU */
+	0x0808, /* DCOUNT */
+	0x090a, /* DOSTARTL */
+	0x1010, /* DOSTARTH */
+	0x1110, /* DOENDL */
+	0x1212, /* DOENDH */
 };
+#endif
 
 	/* Setup the stack as if a yield had occurred.
 
@@ -268,6 +329,29 @@ const StackType_t xInitialStack[] =
 		pxTopOfStack++;
 	}
 
+	#if defined( __dsPIC30F__ ) || defined( __dsPIC33F__ )
+	{
+		/* The DSP registers followed by the flag that says whether they are on
+		the stack. */
+		#if( configUSE_TASK_DSP_SUPPORT == 2 )
+		{
+			for( i = 0; i < ( sizeof( xInitialDSPStack ) / sizeof( StackType_t ) ); i++ )
+			{
+				*pxTopOfStack = xInitialDSPStack[ i ];
+				pxTopOfStack++;
+			}
+
+			*pxTopOfStack = ( StackType_t ) pdTRUE;
+		}
+		#else
+		{
+			*pxTopOfStack = ( StackType_t ) pdFALSE;
+		}
+		#endif /* configUSE_TASK_DSP_SUPPORT */
+		pxTopOfStack++;
+	}
+	#endif /* defined( __dsPIC30F__ ) || defined( __dsPIC33F__ ) */
+
 	*pxTopOfStack = CORCON;
 	pxTopOfStack++;
 
@@ -294,6 +378,12 @@ BaseType_t xPortStartScheduler( void )
 	/* Setup a timer for the tick ISR. */
 	vApplicationSetupTickTimerInterrupt();
 
+	#if( configUSE_HR_TIMER == 1 )
+	{
+		prvSetupHrTimer();
+	}
+	#endif
+
 	/* Restore the context of the first task to run. */
 	portRESTORE_CONTEXT();
 
@@ -348,6 +438,17 @@ void vPortEnterCritical( void )
 {
 	portDISABLE_INTERRUPTS();
 	uxCriticalNesting++;
+
+	#if( configUSE_CRITICAL_PROFILER == 1 )
+	{
+		/* uxCriticalNesting is not 1 before the scheduler starts, the
+		sections of main() are not timed. */
+		if( uxCriticalNesting == 1 )
+		{
+			vCriticalProfilerEnter( configCRITICAL_PROFILER_GET_CALLER() );
+		}
+	}
+	#endif /* configUSE_CRITICAL_PROFILER */
 }
 /*-----------------------------------------------------------*/
 
@@ -357,11 +458,56 @@ void vPortExitCritical( void )
 	uxCriticalNesting--;
 	if( uxCriticalNesting == 0 )
 	{
+		#if( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			vCriticalProfilerExit();
+		}
+		#endif /* configUSE_CRITICAL_PROFILER */
+
 		portENABLE_INTERRUPTS();
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if defined( __dsPIC30F__ ) || defined( __dsPIC33F__ )
+
+	void vPortTaskUsesDSP( void )
+	{
+		/* The DSP registers currently hold whatever the previous DSP task left
+		in them, they are part of the context of the calling task from the
+		next context switch on. */
+		uxPortTaskUsesDSP = pdTRUE;
+	}
+
+#endif /* defined( __dsPIC30F__ ) || defined( __dsPIC33F__ ) */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+UBaseType_t uxSavedIpl;
+
+	uxSavedIpl = ( UBaseType_t ) SRbits.IPL;
+
+	if( uxSavedIpl < configKERNEL_INTERRUPT_PRIORITY )
+	{
+		portDISABLE_INTERRUPTS();
+	}
+
+	return uxSavedIpl;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxSavedIpl )
+{
+	/* Interrupts running at or above the kernel priority never had their IPL
+	changed. */
+	if( uxSavedIpl < configKERNEL_INTERRUPT_PRIORITY )
+	{
+		SET_CPU_IPL( uxSavedIpl );
+	}
+}
+/*-----------------------------------------------------------*/
+
 void __attribute__((__interrupt__, auto_psv)) configTICK_INTERRUPT_HANDLER( void )
 {
 	/* Clear the timer interrupt. */
@@ -372,4 +518,135 @@ void __attribute__((__interrupt__, auto_psv)) configTICK_INTERRUPT_HANDLER( void
 		portYIELD();
 	}
 }
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HR_TIMER == 1 )
+
+	/*
+	 * Timer4 has no compare register of its own, its period register PR4 is
+	 * used as the compare: TMR4 restarts from 0 with the period of the next
+	 * deadline each time the deadline changes, its counts being added to
+	 * ulHrTimerBase.  The restart clears the prescaler, so each one loses
+	 * less than a count (0.5us), deadlines that change often make the time
+	 * run a little slow against the tick.  With no deadline the period is
+	 * the whole 16 bits, the interrupt then comes every 32ms and finds
+	 * nothing due.
+	 */
+	static void prvSetupHrTimer( void )
+	{
+		T4CON = 0;
+		TMR4 = 0;
+		PR4 = 0xffff;
+
+		/* Same priority as the tick, the callbacks use the FromISR API. */
+		IPC6bits.T4IP = configKERNEL_INTERRUPT_PRIORITY;
+		IFS1bits.T4IF = 0;
+		IEC1bits.T4IE = 1;
+
+		/* Prescale of 8. */
+		T4CONbits.TCKPS0 = 1;
+		T4CONbits.TCKPS1 = 0;
+
+		T4CONbits.TON = 1;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRestartHrTimer( void )
+	{
+	uint16_t usCount;
+
+		usCount = TMR4;
+
+		if( IFS1bits.T4IF != 0 )
+		{
+			/* The match came and has not been served, the interrupt is not
+			needed any more: the period is counted here. */
+			ulHrTimerBase += ( uint32_t ) PR4 + 1UL;
+			usCount = TMR4;
+		}
+
+		TMR4 = 0;
+
+		/* A match between the flag test and the restart only loses the count
+		of the wrap. */
+		IFS1bits.T4IF = 0;
+		ulHrTimerBase += usCount;
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulPortHrTimerGetTime( void )
+	{
+	UBaseType_t uxSavedIpl;
+	uint32_t ulTime;
+
+		uxSavedIpl = uxPortSetInterruptMask();
+		{
+			ulTime = ulHrTimerBase + TMR4;
+
+			if( IFS1bits.T4IF != 0 )
+			{
+				/* TMR4 is read again after the flag, a match between the two
+				reads is then counted. */
+				ulTime = ulHrTimerBase + ( uint32_t ) PR4 + 1UL + TMR4;
+			}
+		}
+		vPortClearInterruptMask( uxSavedIpl );
+
+		return ulTime;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHrTimerSetCompare( uint32_t ulDeadline )
+	{
+	UBaseType_t uxSavedIpl;
+	int32_t lDelta;
+
+		uxSavedIpl = uxPortSetInterruptMask();
+		{
+			prvRestartHrTimer();
+
+			/* TMR4 is 0 at ulHrTimerBase.  A deadline more than 16 bits away
+			is reached in several periods. */
+			lDelta = ( int32_t ) ( ulDeadline - ulHrTimerBase );
+
+			if( lDelta < portHR_TIMER_MIN_COUNTS )
+			{
+				lDelta = portHR_TIMER_MIN_COUNTS;
+			}
+			else if( lDelta > 0x10000L )
+			{
+				lDelta = 0x10000L;
+			}
+
+			PR4 = ( uint16_t ) ( lDelta - 1L );
+		}
+		vPortClearInterruptMask( uxSavedIpl );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHrTimerClearCompare( void )
+	{
+	UBaseType_t uxSavedIpl;
+
+		uxSavedIpl = uxPortSetInterruptMask();
+		{
+			prvRestartHrTimer();
+			PR4 = 0xffff;
+		}
+		vPortClearInterruptMask( uxSavedIpl );
+	}
+	/*-----------------------------------------------------------*/
+
+	void __attribute__((__interrupt__, auto_psv)) _T4Interrupt( void )
+	{
+		/* TMR4 went back to 0 on the match. */
+		IFS1bits.T4IF = 0;
+		ulHrTimerBase += ( uint32_t ) PR4 + 1UL;
+
+		if( xHrTimerProcessFromISR() != pdFALSE )
+		{
+			portYIELD();
+		}
+	}
 
+#endif /* configUSE_HR_TIMER */
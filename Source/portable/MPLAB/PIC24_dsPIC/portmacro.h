@@ -110,6 +110,10 @@ typedef unsigned short UBaseType_t;
 #define portBYTE_ALIGNMENT			2
 #define portSTACK_GROWTH			1
 #define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+
+/* Timer4 counts the time of hr_timer.c (configUSE_HR_TIMER) with a prescale of
+8, 2 counts per microsecond at 16 MHz. */
+#define portHR_TIMER_COUNTS_PER_US	( configCPU_CLOCK_HZ / 8000000UL )
 /*-----------------------------------------------------------*/
 
 /* Critical section management. */
@@ -122,12 +126,63 @@ extern void vPortEnterCritical( void );
 extern void vPortExitCritical( void );
 #define portENTER_CRITICAL()		vPortEnterCritical()
 #define portEXIT_CRITICAL()			vPortExitCritical()
+
+/* Masking that can be nested, from tasks and interrupts: the IPL is only
+raised if it is below configKERNEL_INTERRUPT_PRIORITY and is restored to the
+value it had. */
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxSavedIpl );
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vPortClearInterruptMask( x )
 /*-----------------------------------------------------------*/
 
 /* Task utilities. */
 extern void vPortYield( void );
 #define portYIELD()				asm volatile ( "CALL _vPortYield			\n"		\
 												"NOP					  " );
+
+/* On dsPIC parts built with configUSE_TASK_DSP_SUPPORT set to 1 a task must
+call portTASK_USES_DSP() before it first uses the accumulators or DO loops
+to have them saved as part of its context.  PIC24 parts have no DSP engine. */
+#if defined( __dsPIC30F__ ) || defined( __dsPIC33F__ )
+	extern void vPortTaskUsesDSP( void );
+	#define portTASK_USES_DSP()		vPortTaskUsesDSP()
+#else
+	#define portTASK_USES_DSP()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+	/* Check the configuration.  The ready priorities are kept in a 16-bit
+	UBaseType_t. */
+	#if( configMAX_PRIORITIES > 16 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 16.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#endif
+
+	/* Store/clear the ready priorities in a bit map. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( ( UBaseType_t ) 1 << ( uxPriority ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( ( UBaseType_t ) 1 << ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	/* FF1L numbers the bits from 1 for the MSb to 16 for the LSb, so the
+	highest set bit n is returned as 16 - n.  The idle task is always ready,
+	the map is never 0. */
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )								\
+	{																									\
+	UBaseType_t uxFirstOneFromLeft;																		\
+																										\
+		asm volatile ( "FF1L %1, %0" : "=r" ( uxFirstOneFromLeft ) : "r" ( uxReadyPriorities ) : "cc" );	\
+		uxTopPriority = ( UBaseType_t ) 16 - uxFirstOneFromLeft;										\
+	}
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
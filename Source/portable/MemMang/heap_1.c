@@ -82,11 +82,20 @@ all the API functions to use the MPU wrappers.  That should only be done when
 task.h is included from an application file. */
 #define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Defining HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE prevents FreeRTOS.h from
+mapping pvPortMalloc() and vPortFree() to the heap profiler, which is only
+done for the callers of the heap (see heap_profiler.h). */
+#define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+
 #include "FreeRTOS.h"
 #include "task.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Nothing is allocated from the heap when only static allocation is used, the
+heap array is then left out and any call to pvPortMalloc() fails to link. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define configADJUSTED_HEAP_SIZE	( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
 
@@ -170,5 +179,4 @@ size_t xPortGetFreeHeapSize( void )
 	return ( configADJUSTED_HEAP_SIZE - xNextFreeByte );
 }
 
-
-
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
@@ -83,11 +83,20 @@ all the API functions to use the MPU wrappers.  That should only be done when
 task.h is included from an application file. */
 #define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Defining HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE prevents FreeRTOS.h from
+mapping pvPortMalloc() and vPortFree() to the heap profiler, which is only
+done for the callers of the heap (see heap_profiler.h). */
+#define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+
 #include "FreeRTOS.h"
 #include "task.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Nothing is allocated from the heap when only static allocation is used, the
+heap array is then left out and any call to pvPortMalloc() fails to link. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define configADJUSTED_HEAP_SIZE	( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
 
@@ -117,6 +126,11 @@ static BlockLink_t xStart, xEnd;
 /* Keeps track of the number of free bytes remaining, but says nothing about
 fragmentation. */
 static size_t xFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+static size_t xMinimumEverFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+
+/* Counts of the successful calls, for vPortGetHeapStats(). */
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
 
 /* STATIC FUNCTIONS ARE DEFINED AS MACROS TO MINIMIZE THE FUNCTION CALL DEPTH. */
 
@@ -217,6 +231,13 @@ void *pvReturn = NULL;
 				}
 
 				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+
+				xNumberOfSuccessfulAllocations++;
 			}
 		}
 
@@ -258,6 +279,7 @@ BlockLink_t *pxLink;
 			/* Add this block to the list of free blocks. */
 			prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 			xFreeBytesRemaining += pxLink->xBlockSize;
+			xNumberOfSuccessfulFrees++;
 			traceFREE( pv, pxLink->xBlockSize );
 		}
 		( void ) xTaskResumeAll();
@@ -271,6 +293,39 @@ size_t xPortGetFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+size_t xBlocks = 0;
+
+	vTaskSuspendAll();
+	{
+		/* The list is ordered by size: the smallest block comes first and the
+		largest one last, just before xEnd. */
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = 0;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = 0;
+
+		for( pxBlock = xStart.pxNextFreeBlock; pxBlock != &xEnd; pxBlock = pxBlock->pxNextFreeBlock )
+		{
+			if( xBlocks == 0 )
+			{
+				pxHeapStats->xSizeOfSmallestFreeBlockInBytes = pxBlock->xBlockSize;
+			}
+
+			pxHeapStats->xSizeOfLargestFreeBlockInBytes = pxBlock->xBlockSize;
+			xBlocks++;
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
 	/* This just exists to keep the linker quiet. */
@@ -301,3 +356,5 @@ uint8_t *pucAlignedHeap;
 	pxFirstFreeBlock->pxNextFreeBlock = &xEnd;
 }
 /*-----------------------------------------------------------*/
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
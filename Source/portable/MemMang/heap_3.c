@@ -86,11 +86,20 @@ all the API functions to use the MPU wrappers.  That should only be done when
 task.h is included from an application file. */
 #define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Defining HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE prevents FreeRTOS.h from
+mapping pvPortMalloc() and vPortFree() to the heap profiler, which is only
+done for the callers of the heap (see heap_profiler.h). */
+#define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+
 #include "FreeRTOS.h"
 #include "task.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* Nothing is allocated from the heap when only static allocation is used, the
+heap array is then left out and any call to pvPortMalloc() fails to link. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
@@ -131,5 +140,4 @@ void vPortFree( void *pv )
 	}
 }
 
-
-
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
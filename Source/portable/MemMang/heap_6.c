@@ -0,0 +1,737 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that executes in
+ * bounded, constant time: a two level segregated fit (TLSF) allocator.
+ *
+ * Free blocks are kept in one list per size class.  The first level splits
+ * the sizes in powers of two, the second level splits each power of two into
+ * ( 1 << configHEAP_TLSF_SL_BITS ) classes of equal width, and a bitmap per
+ * level records which classes hold free blocks.  pvPortMalloc() rounds the
+ * wanted size up to the next class, so that every block of the first non empty
+ * class at or above it is large enough, finds that class with two bit scans
+ * and splits the block.  vPortFree() combines (coalescences) the block with
+ * its free neighbours in memory, found through the size and the back link
+ * held in the block header, then inserts it at the head of its class.  Neither
+ * function walks a list, so their execution time does not depend on the
+ * number of blocks in the heap, unlike heap_2.c, heap_4.c and heap_5.c.
+ *
+ * The bit scans use portGET_HIGHEST_PRIORITY() when the port provides it
+ * (configUSE_PORT_OPTIMISED_TASK_SELECTION set to 1), so the bitmaps and block
+ * sizes must fit in a UBaseType_t.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of
+ * http://www.FreeRTOS.org for more information.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Defining HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE prevents FreeRTOS.h from
+mapping pvPortMalloc() and vPortFree() to the heap profiler, which is only
+done for the callers of the heap (see heap_profiler.h). */
+#define HEAP_PROFILER_INCLUDED_FROM_HEAP_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Nothing is allocated from the heap when only static allocation is used, the
+heap array is then left out and any call to pvPortMalloc() fails to link. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Floor of the base 2 logarithm of a constant of up to 32 bits, used to size
+the tables of size classes at compile time. */
+#define heapLOG2_2( x )			( ( ( ( x ) & 0x2UL ) != 0UL ) ? 1 : 0 )
+#define heapLOG2_4( x )			( ( ( ( x ) & 0xCUL ) != 0UL ) ? ( 2 + heapLOG2_2( ( x ) >> 2 ) ) : heapLOG2_2( x ) )
+#define heapLOG2_8( x )			( ( ( ( x ) & 0xF0UL ) != 0UL ) ? ( 4 + heapLOG2_4( ( x ) >> 4 ) ) : heapLOG2_4( x ) )
+#define heapLOG2_16( x )		( ( ( ( x ) & 0xFF00UL ) != 0UL ) ? ( 8 + heapLOG2_8( ( x ) >> 8 ) ) : heapLOG2_8( x ) )
+#define heapLOG2( x )			( ( ( ( ( unsigned long ) ( x ) ) & 0xFFFF0000UL ) != 0UL ) ? ( 16 + heapLOG2_16( ( ( unsigned long ) ( x ) ) >> 16 ) ) : heapLOG2_16( ( unsigned long ) ( x ) ) )
+
+/* The size classes.  Blocks smaller than heapSMALL_BLOCK_SIZE all go in the
+first first level class, one second level class per multiple of the
+alignment.  Each following first level class covers the sizes from
+2^( heapFL_SHIFT + fl - 1 ) to twice that. */
+#define heapSL_INDEX_COUNT		( ( UBaseType_t ) 1 << configHEAP_TLSF_SL_BITS )
+#define heapALIGNMENT_BITS		heapLOG2( portBYTE_ALIGNMENT )
+#define heapFL_SHIFT			( configHEAP_TLSF_SL_BITS + heapALIGNMENT_BITS )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_SHIFT )
+#define heapFL_INDEX_COUNT		( heapLOG2( configTOTAL_HEAP_SIZE ) - heapFL_SHIFT + 2 )
+
+/* Gets set in the xBlockSize member of a BlockLink_t structure when the block
+belongs to the application.  When the bit is clear the block is still part of
+the free heap space. */
+#define heapBLOCK_ALLOCATED_BIT	( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Define the header placed at the start of every block, free or allocated.
+The two free list links are only used while the block is free, they are part
+of the memory returned to the application otherwise. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxPrevPhysBlock;	/*<< The block just below this one in memory, NULL for the first block. */
+	size_t xBlockSize;						/*<< The size of the block, header included. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block of the same size class. */
+	struct A_BLOCK_LINK *pxPrevFreeBlock;	/*<< The previous free block of the same size class. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the first and second level indexes of the class holding blocks of
+ * xBlockSize bytes.
+ */
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Removes and returns a free block of at least xWantedSize bytes, taken from
+ * the first non empty class at or above the class following xWantedSize.
+ * Returns NULL if there is none.
+ */
+static BlockLink_t *prvTakeFreeBlock( size_t xWantedSize );
+
+/*
+ * Inserts a free block at the head of the list of its class, or removes it
+ * from that list.
+ */
+static void prvInsertFreeBlock( BlockLink_t *pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock );
+
+/*
+ * Index of the highest set bit of a non zero value.
+ */
+static UBaseType_t prvHighestBit( size_t xValue );
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* The header kept by allocated blocks, the part of BlockLink_t before the free
+list links, correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small: a free block has to hold the whole
+BlockLink_t structure. */
+static const size_t xMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The heads of the free lists of each class, and the bitmaps of the non empty
+classes: bit fl of uxFLBitmap is set when uxSLBitmap[ fl ] is not 0, bit sl
+of uxSLBitmap[ fl ] when pxFreeLists[ fl ][ sl ] is not empty. */
+static BlockLink_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static UBaseType_t uxSLBitmap[ heapFL_INDEX_COUNT ];
+static UBaseType_t uxFLBitmap = ( UBaseType_t ) 0;
+
+/* Marks the end of the heap, an allocated block of size 0 that stops the
+combining of the last block. */
+static BlockLink_t *pxEnd = NULL;
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation, see vPortGetHeapStats(). */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfFreeBlocks = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the lists of free blocks. */
+		if( pxEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Check the requested block size is not so large that the top bit is
+		set.  The top bit of the block size member of the BlockLink_t structure
+		is used to determine who owns the block - the application or the
+		kernel, so it must be free. */
+		if( ( xWantedSize > 0 ) && ( ( xWantedSize & heapBLOCK_ALLOCATED_BIT ) == 0 ) )
+		{
+			/* The wanted size is increased so it can contain the block header
+			in addition to the requested amount of bytes, and so that blocks
+			are always aligned to the required number of bytes. */
+			xWantedSize += xHeapStructSize;
+
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+				configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize < xMinimumBlockSize )
+			{
+				xWantedSize = xMinimumBlockSize;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize <= xFreeBytesRemaining )
+			{
+				pxBlock = prvTakeFreeBlock( xWantedSize );
+
+				if( pxBlock != NULL )
+				{
+					/* If the block is larger than required it can be split
+					into two, the end of the block going back to the free
+					lists. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+					{
+						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+						configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxNewBlockLink->pxPrevPhysBlock = pxBlock;
+						( ( BlockLink_t * ) ( ( ( uint8_t * ) pxNewBlockLink ) + pxNewBlockLink->xBlockSize ) )->pxPrevPhysBlock = pxNewBlockLink;
+						pxBlock->xBlockSize = xWantedSize;
+
+						prvInsertFreeBlock( pxNewBlockLink );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The block is being returned - it is allocated and owned
+					by the application.  Return the memory space that follows
+					the block header. */
+					pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+					xNumberOfSuccessfulAllocations++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a block header immediately before
+		it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+
+		if( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				xNumberOfSuccessfulFrees++;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* Combine the block with the block above it if that one is
+				free.  The end marker is never free. */
+				pxNeighbour = ( void * ) ( puc + pxLink->xBlockSize );
+
+				if( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Then with the block below it if that one is free. */
+				pxNeighbour = pxLink->pxPrevPhysBlock;
+
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block that now follows has to link back to the result. */
+				( ( BlockLink_t * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize ) )->pxPrevPhysBlock = pxLink;
+
+				prvInsertFreeBlock( pxLink );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+UBaseType_t uxFL, uxSL;
+size_t xMaxSize = 0, xMinSize = 0;
+
+	vTaskSuspendAll();
+	{
+		if( uxFLBitmap != ( UBaseType_t ) 0 )
+		{
+			/* The largest free block is in the highest non empty class, but
+			the blocks of a class are not sorted, so its list is walked. */
+			uxFL = prvHighestBit( uxFLBitmap );
+			uxSL = prvHighestBit( uxSLBitmap[ uxFL ] );
+
+			for( pxBlock = pxFreeLists[ uxFL ][ uxSL ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize > xMaxSize )
+				{
+					xMaxSize = pxBlock->xBlockSize;
+				}
+			}
+
+			/* Likewise for the smallest one in the lowest non empty class. */
+			uxFL = prvHighestBit( uxFLBitmap & ( ~uxFLBitmap + ( UBaseType_t ) 1 ) );
+			uxSL = prvHighestBit( uxSLBitmap[ uxFL ] & ( ~uxSLBitmap[ uxFL ] + ( UBaseType_t ) 1 ) );
+			xMinSize = pxFreeLists[ uxFL ][ uxSL ]->xBlockSize;
+
+			for( pxBlock = pxFreeLists[ uxFL ][ uxSL ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize < xMinSize )
+				{
+					xMinSize = pxBlock->xBlockSize;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHighestBit( size_t xValue )
+{
+UBaseType_t uxBit;
+
+	#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+	{
+		portGET_HIGHEST_PRIORITY( uxBit, ( UBaseType_t ) xValue );
+	}
+	#else
+	{
+	UBaseType_t uxShift;
+
+		/* Binary search, as many steps whatever the value. */
+		uxBit = ( UBaseType_t ) 0;
+
+		for( uxShift = ( UBaseType_t ) ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) >> 1 ); uxShift != ( UBaseType_t ) 0; uxShift >>= 1 )
+		{
+			if( ( xValue >> uxShift ) != ( size_t ) 0 )
+			{
+				xValue >>= uxShift;
+				uxBit += uxShift;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif
+
+	return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+UBaseType_t uxFL;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		*puxFL = ( UBaseType_t ) 0;
+		*puxSL = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_BITS );
+	}
+	else
+	{
+		/* The second level index is given by the configHEAP_TLSF_SL_BITS bits
+		that follow the highest set bit. */
+		uxFL = prvHighestBit( xBlockSize );
+		*puxSL = ( UBaseType_t ) ( xBlockSize >> ( uxFL - ( UBaseType_t ) configHEAP_TLSF_SL_BITS ) ) ^ heapSL_INDEX_COUNT;
+		*puxFL = uxFL - ( UBaseType_t ) ( heapFL_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvTakeFreeBlock( size_t xWantedSize )
+{
+BlockLink_t *pxBlock = NULL;
+UBaseType_t uxFL, uxSL, uxMap;
+
+	/* Round the size up to the start of the next class, so that any block of
+	the class found is large enough. */
+	if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xWantedSize += ( ( size_t ) 1 << ( prvHighestBit( xWantedSize ) - ( UBaseType_t ) configHEAP_TLSF_SL_BITS ) ) - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMapBlockSize( xWantedSize, &uxFL, &uxSL );
+
+	if( uxFL < ( UBaseType_t ) heapFL_INDEX_COUNT )
+	{
+		/* First look for a class at or above uxSL in the same first level
+		class, then for the lowest class of a higher first level class.  The
+		lowest set bit of a map is isolated by ( uxMap & -uxMap ). */
+		uxMap = uxSLBitmap[ uxFL ] & ~( ( ( UBaseType_t ) 1 << uxSL ) - ( UBaseType_t ) 1 );
+
+		if( uxMap == ( UBaseType_t ) 0 )
+		{
+			uxMap = uxFLBitmap & ~( ( ( UBaseType_t ) 2 << uxFL ) - ( UBaseType_t ) 1 );
+
+			if( uxMap != ( UBaseType_t ) 0 )
+			{
+				uxFL = prvHighestBit( uxMap & ( ~uxMap + ( UBaseType_t ) 1 ) );
+				uxMap = uxSLBitmap[ uxFL ];
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxMap != ( UBaseType_t ) 0 )
+		{
+			uxSL = prvHighestBit( uxMap & ( ~uxMap + ( UBaseType_t ) 1 ) );
+			pxBlock = pxFreeLists[ uxFL ][ uxSL ];
+			configASSERT( pxBlock != NULL );
+			prvRemoveFreeBlock( pxBlock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* Larger than any block the heap can hold. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFL, &uxSL );
+
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxFreeLists[ uxFL ][ uxSL ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFL ][ uxSL ] = pxBlock;
+	uxFLBitmap |= ( UBaseType_t ) 1 << uxFL;
+	uxSLBitmap[ uxFL ] |= ( UBaseType_t ) 1 << uxSL;
+	xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+
+	prvMapBlockSize( pxBlock->xBlockSize, &uxFL, &uxSL );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list. */
+		pxFreeLists[ uxFL ][ uxSL ] = pxBlock->pxNextFreeBlock;
+
+		if( pxFreeLists[ uxFL ][ uxSL ] == NULL )
+		{
+			uxSLBitmap[ uxFL ] &= ~( ( UBaseType_t ) 1 << uxSL );
+
+			if( uxSLBitmap[ uxFL ] == ( UBaseType_t ) 0 )
+			{
+				uxFLBitmap &= ~( ( UBaseType_t ) 1 << uxFL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+BlockLink_t *pxFirstFreeBlock;
+uint8_t *pucAlignedHeap;
+size_t uxAddress;
+size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+	/* The size classes and block sizes must fit in the bitmaps. */
+	configASSERT( heapFL_INDEX_COUNT <= ( sizeof( UBaseType_t ) * heapBITS_PER_BYTE ) );
+	configASSERT( heapSL_INDEX_COUNT <= ( sizeof( UBaseType_t ) * heapBITS_PER_BYTE ) );
+	configASSERT( ( size_t ) ( ( UBaseType_t ) configTOTAL_HEAP_SIZE ) == ( size_t ) configTOTAL_HEAP_SIZE );
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	uxAddress = ( size_t ) ucHeap;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - 1 );
+		uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= uxAddress - ( size_t ) ucHeap;
+	}
+
+	pucAlignedHeap = ( uint8_t * ) uxAddress;
+
+	/* pxEnd is used to mark the end of the heap, it is inserted at the end of
+	the heap space and never freed. */
+	uxAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
+	uxAddress -= xHeapStructSize;
+	uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxEnd = ( void * ) uxAddress;
+
+	/* To start with there is a single free block that is sized to take up the
+	entire heap space, minus the space taken by pxEnd. */
+	pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+	pxFirstFreeBlock->xBlockSize = uxAddress - ( size_t ) pxFirstFreeBlock;
+	pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+
+	pxEnd->xBlockSize = heapBLOCK_ALLOCATED_BIT;
+	pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+
+	prvInsertFreeBlock( pxFirstFreeBlock );
+
+	/* Only one block exists - and it covers the entire usable heap space. */
+	xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+	xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
@@ -114,6 +114,17 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+/* The slots handed out by pvQueueAcquireWrite() and pvQueueAcquireRead() are
+pcWriteTo and u.pcReadFrom, where the copy functions would write the next item
+(or read the next item, or write an item sent to the front). */
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+	#define prvIsWriteSlotHeld( pxQueue )	( ( pxQueue )->xWriteSlotTaken != pdFALSE )
+	#define prvIsReadSlotHeld( pxQueue )	( ( pxQueue )->xReadSlotTaken != pdFALSE )
+#else
+	#define prvIsWriteSlotHeld( pxQueue )	( pdFALSE )
+	#define prvIsReadSlotHeld( pxQueue )	( pdFALSE )
+#endif
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -139,8 +150,8 @@ typedef struct QueueDefinition
 		UBaseType_t uxRecursiveCallCount;/*< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
 	} u;
 
-	List_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
-	List_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
+	EventList_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
+	EventList_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
 
 	volatile UBaseType_t uxMessagesWaiting;/*< The number of items currently in the queue. */
 	UBaseType_t uxLength;			/*< The length of the queue defined as the number of items it will hold, not the number of bytes. */
@@ -158,6 +169,24 @@ typedef struct QueueDefinition
 		struct QueueDefinition *pxQueueSetContainer;
 	#endif
 
+	#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+		void * volatile pvNotifyTask;	/*< Task that gets ulNotifyBits set in its notification value each time an item is posted, NULL if none. */
+		volatile uint32_t ulNotifyBits;
+	#endif
+
+	#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+		volatile BaseType_t xWriteSlotTaken;	/*< pdTRUE while the slot returned by pvQueueAcquireWrite() has not been committed. */
+		volatile BaseType_t xReadSlotTaken;		/*< pdTRUE while the slot returned by pvQueueAcquireRead() has not been released.  It is not counted in uxMessagesWaiting but cannot be written to. */
+	#endif
+
+	#if ( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;	/*< The priority a task runs at while it holds the mutex, tskIDLE_PRIORITY for a mutex that only uses priority inheritance. */
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated;	/*< Set to pdTRUE if the memory of the queue was given by the application, so it is not freed if the queue is deleted. */
+	#endif
+
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -211,11 +240,21 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if there is any space in a queue for
+ * an item sent to xCopyPosition.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if an item can be copied to xCopyPosition in the queue, or
+ * out of the queue, now.  A slot held through the zero copy functions counts
+ * as occupied.  Must be called from a critical section, or with the
+ * interrupt mask set.
+ */
+static BaseType_t prvCanCopyToQueue( const Queue_t *pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+static BaseType_t prvCanCopyFromQueue( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -228,6 +267,29 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called after a queue has been created, statically or dynamically, to set
+ * up its members.
+ */
+static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, const uint8_t ucQueueType, Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MUTEXES == 1 )
+	/*
+	 * Returns the priority of the highest priority task waiting for a mutex,
+	 * or tskIDLE_PRIORITY if no task is waiting.  Must be called with
+	 * interrupts disabled.
+	 */
+	static UBaseType_t prvGetHighestMutexWaiterPriority( Queue_t * const pxMutex ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_MUTEXES == 1 )
+	/*
+	 * Called after a mutex has been created, statically or dynamically, to
+	 * set up its members and give it for the first time.
+	 */
+	static void prvInitialiseMutex( Queue_t *pxNewQueue, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -236,6 +298,78 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+	/*
+	 * Sets the bits chosen by vQueueSetNotifyBits() in the notification value
+	 * of the chosen task, if any, after an item was posted to the queue.  From
+	 * an ISR returns pdTRUE if the task has a priority above the interrupted
+	 * task, from a task the kernel yields itself and pdFALSE is returned.  Must
+	 * be called from a critical section, or with the interrupt mask set if
+	 * xFromISR is pdTRUE.
+	 */
+	static BaseType_t prvNotifyTaskOfPost( const Queue_t * const pxQueue, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+	/*
+	 * Returns pdTRUE if the write (or read) slot of a queue can be acquired.
+	 */
+	static BaseType_t prvIsSlotAvailable( const Queue_t *pxQueue, const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Marks the write (or read) slot as taken and returns it, or returns NULL
+	 * if it is not available.  Must be called from a critical section.
+	 */
+	static void *prvTakeSlot( Queue_t * const pxQueue, const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Blocking part of pvQueueAcquireWrite() and pvQueueAcquireRead(), the
+	 * same as xQueueGenericSend() and xQueueGenericReceive().
+	 */
+	static void *prvAcquireSlot( Queue_t * const pxQueue, TickType_t xTicksToWait, const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Commits the write slot (or releases the read slot) and unblocks the
+	 * tasks that can now access the queue.  Returns pdTRUE if one of them has
+	 * a priority above the calling task.  Must be called from a critical
+	 * section, or with the interrupt mask set if xFromISR is pdTRUE.
+	 */
+	static BaseType_t prvReturnSlot( Queue_t * const pxQueue, const BaseType_t xForWrite, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes the highest priority task from an event list of the queue.  From
+	 * an ISR the event list is left alone if the queue is locked, the lock
+	 * count is incremented instead.
+	 */
+	static BaseType_t prvWakeWaitingTask( EventList_t * const pxEventList, volatile BaseType_t * const pxLock, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+	/*
+	 * Copies up to uxCount items to the back of the queue, as many as there is
+	 * space for, with at most two calls to memcpy().  Returns the number of
+	 * items copied.  Must be called from a critical section, or with the
+	 * interrupt mask set.
+	 */
+	static UBaseType_t prvCopyItemsToQueue( Queue_t * const pxQueue, const uint8_t *pucItems, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Copies up to uxMaxCount items out of the queue, the same way.  Returns
+	 * the number of items copied.
+	 */
+	static UBaseType_t prvCopyItemsFromQueue( Queue_t * const pxQueue, uint8_t *pucBuffer, const UBaseType_t uxMaxCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes up to uxCount tasks from an event list of the queue, one per
+	 * item moved, the highest priority ones first.  A single waiting task is
+	 * unblocked once however many items were moved.  From an ISR the event
+	 * list is left alone if the queue is locked, the lock count is increased
+	 * by uxCount instead.  Returns pdTRUE if one of the tasks has a priority
+	 * above the calling task.
+	 */
+	static BaseType_t prvWakeWaitingTasks( EventList_t * const pxEventList, volatile BaseType_t * const pxLock, UBaseType_t uxCount, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -272,6 +406,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		pxQueue->xRxLock = queueUNLOCKED;
 		pxQueue->xTxLock = queueUNLOCKED;
 
+		#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+		{
+			pxQueue->xWriteSlotTaken = pdFALSE;
+			pxQueue->xReadSlotTaken = pdFALSE;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -279,7 +420,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			will still be empty.  If there are tasks blocked waiting to write to
 			the queue, then one should be unblocked as after this function exits
 			it will be possible to write to it. */
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
 				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) == pdTRUE )
 				{
@@ -298,8 +439,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		else
 		{
 			/* Ensure the event queues start in the correct state. */
-			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+			vEventListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+			vEventListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
 		}
 	}
 	taskEXIT_CRITICAL();
@@ -310,144 +451,306 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
-QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType )
-{
-Queue_t *pxNewQueue;
-size_t xQueueSizeInBytes;
-QueueHandle_t xReturn = NULL;
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	/* Remove compiler warnings about unused parameters should
-	configUSE_TRACE_FACILITY not be set to 1. */
-	( void ) ucQueueType;
+	QueueHandle_t xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType )
+	{
+	Queue_t *pxNewQueue;
 
-	configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( pxStaticQueue != NULL );
 
-	if( uxItemSize == ( UBaseType_t ) 0 )
-	{
-		/* There is not going to be a queue storage area. */
-		xQueueSizeInBytes = ( size_t ) 0;
-	}
-	else
-	{
-		/* The queue is one byte longer than asked for to make wrap checking
-		easier/faster. */
-		xQueueSizeInBytes = ( size_t ) ( uxQueueLength * uxItemSize ) + ( size_t ) 1; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		/* There must be a storage area if, and only if, the items have a
+		size. */
+		configASSERT( !( ( pucQueueStorage != NULL ) && ( uxItemSize == 0 ) ) );
+		configASSERT( !( ( pucQueueStorage == NULL ) && ( uxItemSize != 0 ) ) );
+
+		/* The dummy structure in queue.h must be the size of the real queue
+		structure. */
+		configASSERT( sizeof( StaticQueue_t ) == sizeof( Queue_t ) );
+
+		pxNewQueue = ( Queue_t * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			/* The queue must not be freed if it is deleted. */
+			pxNewQueue->ucStaticallyAllocated = pdTRUE;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+		prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, ucQueueType, pxNewQueue );
+
+		return pxNewQueue;
 	}
 
-	/* Allocate the new queue structure and storage area. */
-	pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	if( pxNewQueue != NULL )
+	QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType )
 	{
+	Queue_t *pxNewQueue;
+	size_t xQueueSizeInBytes;
+	uint8_t *pucQueueStorage;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+
 		if( uxItemSize == ( UBaseType_t ) 0 )
 		{
-			/* No RAM was allocated for the queue storage area, but PC head
-			cannot be set to NULL because NULL is used as a key to say the queue
-			is used as a mutex.  Therefore just set pcHead to point to the queue
-			as a benign value that is known to be within the memory map. */
-			pxNewQueue->pcHead = ( int8_t * ) pxNewQueue;
+			/* There is not going to be a queue storage area. */
+			xQueueSizeInBytes = ( size_t ) 0;
 		}
 		else
 		{
-			/* Jump past the queue structure to find the location of the queue
-			storage area. */
-			pxNewQueue->pcHead = ( ( int8_t * ) pxNewQueue ) + sizeof( Queue_t );
+			/* The queue is one byte longer than asked for to make wrap checking
+			easier/faster. */
+			xQueueSizeInBytes = ( size_t ) ( uxQueueLength * uxItemSize ) + ( size_t ) 1; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 		}
 
-		/* Initialise the queue members as described above where the queue type
-		is defined. */
-		pxNewQueue->uxLength = uxQueueLength;
-		pxNewQueue->uxItemSize = uxItemSize;
-		( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
+		/* Allocate the new queue structure and storage area. */
+		pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
 
-		#if ( configUSE_TRACE_FACILITY == 1 )
+		if( pxNewQueue != NULL )
 		{
-			pxNewQueue->ucQueueType = ucQueueType;
-		}
-		#endif /* configUSE_TRACE_FACILITY */
+			if( uxItemSize == ( UBaseType_t ) 0 )
+			{
+				pucQueueStorage = NULL;
+			}
+			else
+			{
+				/* Jump past the queue structure to find the location of the
+				queue storage area. */
+				pucQueueStorage = ( ( uint8_t * ) pxNewQueue ) + sizeof( Queue_t );
+			}
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* The queue can be freed if it is deleted. */
+				pxNewQueue->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-		#if( configUSE_QUEUE_SETS == 1 )
+			prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, ucQueueType, pxNewQueue );
+		}
+		else
 		{
-			pxNewQueue->pxQueueSetContainer = NULL;
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif /* configUSE_QUEUE_SETS */
 
-		traceQUEUE_CREATE( pxNewQueue );
-		xReturn = pxNewQueue;
+		configASSERT( pxNewQueue );
+
+		return pxNewQueue;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, const uint8_t ucQueueType, Queue_t *pxNewQueue )
+{
+	/* Remove compiler warnings about unused parameters should
+	configUSE_TRACE_FACILITY not be set to 1. */
+	( void ) ucQueueType;
+
+	if( uxItemSize == ( UBaseType_t ) 0 )
+	{
+		/* No RAM was allocated for the queue storage area, but PC head cannot
+		be set to NULL because NULL is used as a key to say the queue is used
+		as a mutex.  Therefore just set pcHead to point to the queue as a
+		benign value that is known to be within the memory map. */
+		pxNewQueue->pcHead = ( int8_t * ) pxNewQueue;
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		pxNewQueue->pcHead = ( int8_t * ) pucQueueStorage;
 	}
 
-	configASSERT( xReturn );
+	/* Initialise the queue members as described above where the queue type
+	is defined. */
+	pxNewQueue->uxLength = uxQueueLength;
+	pxNewQueue->uxItemSize = uxItemSize;
+	( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
-	return xReturn;
+	#if ( configUSE_TRACE_FACILITY == 1 )
+	{
+		pxNewQueue->ucQueueType = ucQueueType;
+	}
+	#endif /* configUSE_TRACE_FACILITY */
+
+	#if( configUSE_QUEUE_SETS == 1 )
+	{
+		pxNewQueue->pxQueueSetContainer = NULL;
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	#if( configUSE_OBJECT_NOTIFY_BITS == 1 )
+	{
+		pxNewQueue->pvNotifyTask = NULL;
+		pxNewQueue->ulNotifyBits = ( uint32_t ) 0;
+	}
+	#endif
+
+	traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_MUTEXES == 1 )
 
-	QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+	static void prvInitialiseMutex( Queue_t *pxNewQueue, const uint8_t ucQueueType )
 	{
-	Queue_t *pxNewQueue;
-
 		/* Prevent compiler warnings about unused parameters if
 		configUSE_TRACE_FACILITY does not equal 1. */
 		( void ) ucQueueType;
 
+		/* Information required for priority inheritance. */
+		pxNewQueue->pxMutexHolder = NULL;
+		pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+
+		#if ( configUSE_CEILING_MUTEXES == 1 )
+		{
+			pxNewQueue->uxCeilingPriority = tskIDLE_PRIORITY;
+		}
+		#endif
+
+		/* Queues used as a mutex no data is actually copied into or out
+		of the queue. */
+		pxNewQueue->pcWriteTo = NULL;
+		pxNewQueue->u.pcReadFrom = NULL;
+
+		/* Each mutex has a length of 1 (like a binary semaphore) and
+		an item size of 0 as nothing is actually copied into or out
+		of the mutex. */
+		pxNewQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
+		pxNewQueue->uxLength = ( UBaseType_t ) 1U;
+		pxNewQueue->uxItemSize = ( UBaseType_t ) 0U;
+		pxNewQueue->xRxLock = queueUNLOCKED;
+		pxNewQueue->xTxLock = queueUNLOCKED;
+
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			pxNewQueue->ucQueueType = ucQueueType;
+		}
+		#endif
+
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			pxNewQueue->pxQueueSetContainer = NULL;
+		}
+		#endif
+
+		#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+		{
+			pxNewQueue->pvNotifyTask = NULL;
+			pxNewQueue->ulNotifyBits = ( uint32_t ) 0;
+		}
+		#endif
+
+		/* Ensure the event queues start with the correct state. */
+		vEventListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
+		vEventListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
+
+		traceCREATE_MUTEX( pxNewQueue );
+
+		/* Start with the semaphore in the expected state. */
+		( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+	{
+	Queue_t *pxNewQueue;
+
 		/* Allocate the new queue structure. */
 		pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) );
 		if( pxNewQueue != NULL )
 		{
-			/* Information required for priority inheritance. */
-			pxNewQueue->pxMutexHolder = NULL;
-			pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxNewQueue->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseMutex( pxNewQueue, ucQueueType );
+		}
+		else
+		{
+			traceCREATE_MUTEX_FAILED();
+		}
 
-			/* Queues used as a mutex no data is actually copied into or out
-			of the queue. */
-			pxNewQueue->pcWriteTo = NULL;
-			pxNewQueue->u.pcReadFrom = NULL;
+		return pxNewQueue;
+	}
 
-			/* Each mutex has a length of 1 (like a binary semaphore) and
-			an item size of 0 as nothing is actually copied into or out
-			of the mutex. */
-			pxNewQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
-			pxNewQueue->uxLength = ( UBaseType_t ) 1U;
-			pxNewQueue->uxItemSize = ( UBaseType_t ) 0U;
-			pxNewQueue->xRxLock = queueUNLOCKED;
-			pxNewQueue->xTxLock = queueUNLOCKED;
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
 
-			#if ( configUSE_TRACE_FACILITY == 1 )
-			{
-				pxNewQueue->ucQueueType = ucQueueType;
-			}
-			#endif
+#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-			#if ( configUSE_QUEUE_SETS == 1 )
-			{
-				pxNewQueue->pxQueueSetContainer = NULL;
-			}
-			#endif
+	QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue )
+	{
+	Queue_t *pxNewQueue;
 
-			/* Ensure the event queues start with the correct state. */
-			vListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
+		configASSERT( pxStaticQueue != NULL );
+		configASSERT( sizeof( StaticQueue_t ) == sizeof( Queue_t ) );
 
-			traceCREATE_MUTEX( pxNewQueue );
+		pxNewQueue = ( Queue_t * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
 
-			/* Start with the semaphore in the expected state. */
-			( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			pxNewQueue->ucStaticallyAllocated = pdTRUE;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+		prvInitialiseMutex( pxNewQueue, ucQueueType );
+
+		return pxNewQueue;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutex( const uint8_t ucQueueType, const UBaseType_t uxCeilingPriority )
+	{
+	Queue_t *pxNewQueue;
+
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueCreateMutex( ucQueueType );
+		if( pxNewQueue != NULL )
+		{
+			pxNewQueue->uxCeilingPriority = uxCeilingPriority;
 		}
 		else
 		{
-			traceCREATE_MUTEX_FAILED();
+			mtCOVERAGE_TEST_MARKER();
 		}
 
 		return pxNewQueue;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutexStatic( const uint8_t ucQueueType, const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue )
+	{
+	Queue_t *pxNewQueue;
+
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueCreateMutexStatic( ucQueueType, pxStaticQueue );
+		pxNewQueue->uxCeilingPriority = uxCeilingPriority;
+
+		return pxNewQueue;
+	}
+
+#endif /* ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
@@ -480,6 +783,77 @@ QueueHandle_t xReturn = NULL;
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	static UBaseType_t prvGetHighestMutexWaiterPriority( Queue_t * const pxMutex )
+	{
+	ListItem_t *pxHighest;
+	UBaseType_t uxHighestPriority;
+
+		/* The event list item value of a task waiting for a mutex is its
+		inverted priority. */
+		pxHighest = listGET_HIGHEST_EVENT_ENTRY( &( pxMutex->xTasksWaitingToReceive ) );
+
+		if( pxHighest != NULL )
+		{
+			uxHighestPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( pxHighest );
+		}
+		else
+		{
+			uxHighestPriority = tskIDLE_PRIORITY;
+		}
+
+		#if ( configUSE_CEILING_MUTEXES == 1 )
+		{
+			/* The holder of a ceiling mutex keeps the ceiling, as if a task of
+			that priority was always waiting. */
+			if( pxMutex->uxCeilingPriority > uxHighestPriority )
+			{
+				uxHighestPriority = pxMutex->uxCeilingPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		return uxHighestPriority;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void *pvQueueRequeueMutexWaiter( QueueHandle_t xMutex, ListItem_t * const pxWaiterListItem, UBaseType_t uxNewPriority, UBaseType_t * const puxHighestWaitingPriority )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+	void *pvReturn;
+
+		configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+		/* The task may have been unblocked (the mutex given to it, time out)
+		without having run yet. */
+		if( listIS_CONTAINED_WITHIN_EVENT_LIST( &( pxMutex->xTasksWaitingToReceive ), pxWaiterListItem ) != pdFALSE )
+		{
+			( void ) uxListRemove( pxWaiterListItem );
+			vEventListInsert( &( pxMutex->xTasksWaitingToReceive ), pxWaiterListItem, uxNewPriority );
+
+			*puxHighestWaitingPriority = prvGetHighestMutexWaiterPriority( pxMutex );
+			pvReturn = ( void * ) pxMutex->pxMutexHolder;
+		}
+		else
+		{
+			pvReturn = NULL;
+		}
+
+		return pvReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_RECURSIVE_MUTEXES == 1 )
 
 	BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
@@ -577,7 +951,7 @@ QueueHandle_t xReturn = NULL;
 #endif /* configUSE_RECURSIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_COUNTING_SEMAPHORES == 1 )
+#if ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
 	{
@@ -603,17 +977,37 @@ QueueHandle_t xReturn = NULL;
 		return xHandle;
 	}
 
-#endif /* configUSE_COUNTING_SEMAPHORES */
+#endif /* ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
-{
-BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
-TimeOut_t xTimeOut;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue )
+	{
+	QueueHandle_t xHandle;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		xHandle = xQueueGenericCreateStatic( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+		traceCREATE_COUNTING_SEMAPHORE();
+
+		return xHandle;
+	}
+
+#endif /* ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
+{
+BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+TimeOut_t xTimeOut;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
 	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
@@ -632,12 +1026,18 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			/* Is there room on the queue now?  The running task must be the
 			highest priority task wanting to access the queue.  If the head item
 			in the queue is to be overwritten then it does not matter if the
-			queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			queue is full, unless a zero copy slot is held. */
+			if( prvCanCopyToQueue( pxQueue, xCopyPosition ) != pdFALSE )
 			{
 				traceQUEUE_SEND( pxQueue );
 				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
+				#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+				{
+					( void ) prvNotifyTaskOfPost( pxQueue, pdFALSE );
+				}
+				#endif
+
 				#if ( configUSE_QUEUE_SETS == 1 )
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
@@ -658,7 +1058,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					{
 						/* If there was a task waiting for data to arrive on the
 						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
 							{
@@ -691,7 +1091,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
 						{
@@ -762,7 +1162,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
 				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -823,14 +1223,14 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				/* Is there room on the queue now?  To be running we must be
 				the highest priority task wanting to access the queue. */
-				if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+				if( prvCanCopyToQueue( pxQueue, xCopyPosition ) != pdFALSE )
 				{
 					traceQUEUE_SEND( pxQueue );
 					prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
 						{
@@ -871,7 +1271,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 				{
-					if( prvIsQueueFull( pxQueue ) != pdFALSE )
+					if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
 					{
 						traceBLOCKING_ON_QUEUE_SEND( pxQueue );
 						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -912,7 +1312,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			taskENTER_CRITICAL();
 			{
-				if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+				if( prvCanCopyFromQueue( pxQueue ) != pdFALSE )
 				{
 					/* Remember our read position in case we are just peeking. */
 					pcOriginalReadPosition = pxQueue->u.pcReadFrom;
@@ -941,7 +1341,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 						}
 						#endif
 
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+						if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) == pdTRUE )
 							{
@@ -963,7 +1363,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 						/* The data is being left in the queue, so see if there are
 						any other tasks waiting for the data. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							/* Tasks that are removed from the event list will get added to
 							the pending ready list as the scheduler is still suspended. */
@@ -1017,7 +1417,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 							{
 								taskENTER_CRITICAL();
 								{
-									vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
+									vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder, ( void * ) pxQueue );
 								}
 								taskEXIT_CRITICAL();
 							}
@@ -1038,6 +1438,19 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				else
 				{
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+						{
+							vTaskPriorityDisinheritAfterTimeout( ( void * ) pxQueue->pxMutexHolder, prvGetHighestMutexWaiterPriority( pxQueue ) );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif
+
 					taskEXIT_CRITICAL();
 					traceQUEUE_RECEIVE_FAILED( pxQueue );
 					return errQUEUE_EMPTY;
@@ -1084,7 +1497,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	post). */
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		if( prvCanCopyToQueue( pxQueue, xCopyPosition ) != pdFALSE )
 		{
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
 
@@ -1095,6 +1508,21 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			the scheduler is suspended before accessing the ready lists. */
 			( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
+			#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+			{
+				/* The notification value is not part of the queue, so the
+				task is notified even if the queue is locked. */
+				if( ( prvNotifyTaskOfPost( pxQueue, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			/* The event list is not altered if the queue is locked.  This will
 			be done when the queue is unlocked later. */
 			if( pxQueue->xTxLock == queueUNLOCKED )
@@ -1124,7 +1552,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
@@ -1152,7 +1580,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1256,6 +1684,19 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			messages (semaphores) available. */
 			++( pxQueue->uxMessagesWaiting );
 
+			#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+			{
+				if( ( prvNotifyTaskOfPost( pxQueue, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			/* The event list is not altered if the queue is locked.  This will
 			be done when the queue is unlocked later. */
 			if( pxQueue->xTxLock == queueUNLOCKED )
@@ -1285,7 +1726,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
 							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
@@ -1313,7 +1754,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1386,7 +1827,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			/* Is there data in the queue now?  To be running the calling task
 			must be	the highest priority task wanting to access the queue. */
-			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( prvCanCopyFromQueue( pxQueue ) != pdFALSE )
 			{
 				/* Remember the read position in case the queue is only being
 				peeked. */
@@ -1408,6 +1849,23 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 							/* Record the information required to implement
 							priority inheritance should it become necessary. */
 							pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount(); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
+
+							#if ( configUSE_CEILING_MUTEXES == 1 )
+							{
+								/* The holder of a ceiling mutex runs at the
+								ceiling straight away, so none of the tasks that
+								take the mutex can preempt it and then block on
+								it. */
+								if( pxQueue->uxCeilingPriority != tskIDLE_PRIORITY )
+								{
+									vTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#endif
 						}
 						else
 						{
@@ -1416,7 +1874,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 					#endif /* configUSE_MUTEXES */
 
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) == pdTRUE )
 						{
@@ -1442,7 +1900,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 					/* The data is being left in the queue, so see if there are
 					any other tasks waiting for the data. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1508,7 +1966,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					{
 						taskENTER_CRITICAL();
 						{
-							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
+							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder, ( void * ) pxQueue );
 						}
 						taskEXIT_CRITICAL();
 					}
@@ -1541,6 +1999,26 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
+
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				/* The holder may have inherited the priority of this task, it
+				only keeps what the tasks still waiting need. */
+				if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+				{
+					taskENTER_CRITICAL();
+					{
+						vTaskPriorityDisinheritAfterTimeout( ( void * ) pxQueue->pxMutexHolder, prvGetHighestMutexWaiterPriority( pxQueue ) );
+					}
+					taskEXIT_CRITICAL();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			traceQUEUE_RECEIVE_FAILED( pxQueue );
 			return errQUEUE_EMPTY;
 		}
@@ -1576,7 +2054,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
 		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		if( prvCanCopyFromQueue( pxQueue ) != pdFALSE )
 		{
 			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
 
@@ -1589,7 +2067,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			locked. */
 			if( pxQueue->xRxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
@@ -1616,77 +2094,1001 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was removed while it was locked. */
-				++( pxQueue->xRxLock );
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was removed while it was locked. */
+				++( pxQueue->xRxLock );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( prvCanCopyFromQueue( pxQueue ) != pdFALSE )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void *pvQueueAcquireWrite( QueueHandle_t xQueue, TickType_t xTicksToWait )
+	{
+		return prvAcquireSlot( ( Queue_t * ) xQueue, xTicksToWait, pdTRUE );
+	}
+	/*-----------------------------------------------------------*/
+
+	void *pvQueueAcquireRead( QueueHandle_t xQueue, TickType_t xTicksToWait )
+	{
+		return prvAcquireSlot( ( Queue_t * ) xQueue, xTicksToWait, pdFALSE );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vQueueCommitWrite( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			traceQUEUE_SEND( pxQueue );
+
+			if( prvReturnSlot( pxQueue, pdTRUE, pdFALSE ) != pdFALSE )
+			{
+				/* Yes it is ok to do this from within the critical section -
+				the kernel takes care of that. */
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vQueueReleaseRead( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			if( prvReturnSlot( pxQueue, pdFALSE, pdFALSE ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void *pvQueueAcquireWriteFromISR( QueueHandle_t xQueue )
+	{
+	void *pvSlot;
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pvSlot = prvTakeSlot( pxQueue, pdTRUE );
+
+			if( pvSlot == NULL )
+			{
+				traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pvSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	void *pvQueueAcquireReadFromISR( QueueHandle_t xQueue )
+	{
+	void *pvSlot;
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pvSlot = prvTakeSlot( pxQueue, pdFALSE );
+
+			if( pvSlot != NULL )
+			{
+				traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+			}
+			else
+			{
+				traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pvSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vQueueCommitWriteFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			if( ( prvReturnSlot( pxQueue, pdTRUE, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vQueueReleaseReadFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( ( prvReturnSlot( pxQueue, pdFALSE, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvIsSlotAvailable( const Queue_t *pxQueue, const BaseType_t xForWrite )
+	{
+	BaseType_t xReturn;
+
+		if( xForWrite != pdFALSE )
+		{
+			/* The slot held by a reader is not free yet. */
+			xReturn = ( ( pxQueue->xWriteSlotTaken == pdFALSE ) &&
+						( ( pxQueue->uxMessagesWaiting + ( ( pxQueue->xReadSlotTaken != pdFALSE ) ? 1U : 0U ) ) < pxQueue->uxLength ) );
+		}
+		else
+		{
+			xReturn = ( ( pxQueue->xReadSlotTaken == pdFALSE ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) );
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void *prvTakeSlot( Queue_t * const pxQueue, const BaseType_t xForWrite )
+	{
+	void *pvSlot = NULL;
+
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			configASSERT( pxQueue->pxQueueSetContainer == NULL );
+		}
+		#endif
+
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0 );
+
+		if( prvIsSlotAvailable( pxQueue, xForWrite ) != pdFALSE )
+		{
+			if( xForWrite != pdFALSE )
+			{
+				/* The item is written where prvCopyDataToQueue() would have
+				copied it, pcWriteTo only moves on when it is committed. */
+				pxQueue->xWriteSlotTaken = pdTRUE;
+				pvSlot = ( void * ) pxQueue->pcWriteTo;
+			}
+			else
+			{
+				/* Same as prvCopyDataFromQueue(), without the copy. */
+				pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
+				if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+				{
+					pxQueue->u.pcReadFrom = pxQueue->pcHead;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				--( pxQueue->uxMessagesWaiting );
+				pxQueue->xReadSlotTaken = pdTRUE;
+				pvSlot = ( void * ) pxQueue->u.pcReadFrom;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void *prvAcquireSlot( Queue_t * const pxQueue, TickType_t xTicksToWait, const BaseType_t xForWrite )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE, xAvailable;
+	TimeOut_t xTimeOut;
+	void *pvSlot;
+	EventList_t * const pxWaitList = ( xForWrite != pdFALSE ) ? &( pxQueue->xTasksWaitingToSend ) : &( pxQueue->xTasksWaitingToReceive );
+
+		configASSERT( pxQueue );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				pvSlot = prvTakeSlot( pxQueue, xForWrite );
+
+				if( pvSlot != NULL )
+				{
+					if( xForWrite == pdFALSE )
+					{
+						traceQUEUE_RECEIVE( pxQueue );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return pvSlot;
+				}
+				else if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+
+					if( xForWrite != pdFALSE )
+					{
+						traceQUEUE_SEND_FAILED( pxQueue );
+					}
+					else
+					{
+						traceQUEUE_RECEIVE_FAILED( pxQueue );
+					}
+
+					return NULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				taskENTER_CRITICAL();
+				{
+					xAvailable = prvIsSlotAvailable( pxQueue, xForWrite );
+				}
+				taskEXIT_CRITICAL();
+
+				if( xAvailable == pdFALSE )
+				{
+					if( xForWrite != pdFALSE )
+					{
+						traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					}
+					else
+					{
+						traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					}
+
+					vTaskPlaceOnEventList( pxWaitList, xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+
+				if( xForWrite != pdFALSE )
+				{
+					traceQUEUE_SEND_FAILED( pxQueue );
+				}
+				else
+				{
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+				}
+
+				return NULL;
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvReturnSlot( Queue_t * const pxQueue, const BaseType_t xForWrite, const BaseType_t xFromISR )
+	{
+	BaseType_t xReturn;
+
+		if( xForWrite != pdFALSE )
+		{
+			configASSERT( pxQueue->xWriteSlotTaken != pdFALSE );
+
+			/* Post the item, as prvCopyDataToQueue() does after the copy. */
+			pxQueue->pcWriteTo += pxQueue->uxItemSize;
+			if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			++( pxQueue->uxMessagesWaiting );
+			pxQueue->xWriteSlotTaken = pdFALSE;
+
+			/* A reader can take the new item, and another writer the write
+			slot if the queue is not full. */
+			xReturn = prvWakeWaitingTask( &( pxQueue->xTasksWaitingToReceive ), &( pxQueue->xTxLock ), xFromISR );
+
+			#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+			{
+				if( prvNotifyTaskOfPost( pxQueue, xFromISR ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			if( prvIsSlotAvailable( pxQueue, pdTRUE ) != pdFALSE )
+			{
+				if( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToSend ), &( pxQueue->xRxLock ), xFromISR ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			configASSERT( pxQueue->xReadSlotTaken != pdFALSE );
+
+			pxQueue->xReadSlotTaken = pdFALSE;
+
+			/* The slot is free for a writer, and another reader can take the
+			read slot if items are left. */
+			xReturn = prvWakeWaitingTask( &( pxQueue->xTasksWaitingToSend ), &( pxQueue->xRxLock ), xFromISR );
+
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				if( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToReceive ), &( pxQueue->xTxLock ), xFromISR ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvWakeWaitingTask( EventList_t * const pxEventList, volatile BaseType_t * const pxLock, const BaseType_t xFromISR )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		if( ( xFromISR != pdFALSE ) && ( *pxLock != queueUNLOCKED ) )
+		{
+			/* The task that unlocks the queue will unblock the waiting task. */
+			++( *pxLock );
+		}
+		else if( listEVENT_LIST_IS_EMPTY( pxEventList ) == pdFALSE )
+		{
+			xReturn = xTaskRemoveFromEventList( pxEventList );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+	UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	UBaseType_t uxSent;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItems );
+		configASSERT( uxCount > ( UBaseType_t ) 0 );
+		/* Semaphores and mutexes have no items to copy, and a queue set
+		needs one event per item. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0 );
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			configASSERT( pxQueue->pxQueueSetContainer == NULL );
+		}
+		#endif
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				uxSent = prvCopyItemsToQueue( pxQueue, ( const uint8_t * ) pvItems, uxCount );
+
+				if( uxSent > ( UBaseType_t ) 0 )
+				{
+					traceQUEUE_SEND( pxQueue );
+
+					#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+					{
+						( void ) prvNotifyTaskOfPost( pxQueue, pdFALSE );
+					}
+					#endif
+
+					/* Yes it is ok to yield from within the critical section -
+					the kernel takes care of that. */
+					if( prvWakeWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), &( pxQueue->xTxLock ), uxSent, pdFALSE ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The queue is full.  Wait for a receive to make space, the
+					task is no longer ready once on the event list so the yield
+					below happens even if space is made between leaving the
+					critical section and yielding. */
+					if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+					{
+						traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					}
+					else
+					{
+						xTicksToWait = ( TickType_t ) 0;
+						traceQUEUE_SEND_FAILED( pxQueue );
+					}
+				}
+				else
+				{
+					traceQUEUE_SEND_FAILED( pxQueue );
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( ( uxSent > ( UBaseType_t ) 0 ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+			{
+				break;
+			}
+
+			/* Only reached after the task was placed on the event list. */
+			portYIELD_WITHIN_API();
+		}
+
+		return uxSent;
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, TickType_t xTicksToWait )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	UBaseType_t uxReceived;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( uxMaxCount > ( UBaseType_t ) 0 );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0 );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				uxReceived = prvCopyItemsFromQueue( pxQueue, ( uint8_t * ) pvBuffer, uxMaxCount );
+
+				if( uxReceived > ( UBaseType_t ) 0 )
+				{
+					traceQUEUE_RECEIVE( pxQueue );
+
+					if( prvWakeWaitingTasks( &( pxQueue->xTasksWaitingToSend ), &( pxQueue->xRxLock ), uxReceived, pdFALSE ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The queue is empty.  Wait for a post, then take all the
+					items there are at that point. */
+					if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+					{
+						traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					}
+					else
+					{
+						xTicksToWait = ( TickType_t ) 0;
+						traceQUEUE_RECEIVE_FAILED( pxQueue );
+					}
+				}
+				else
+				{
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( ( uxReceived > ( UBaseType_t ) 0 ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+			{
+				break;
+			}
+
+			/* Only reached after the task was placed on the event list. */
+			portYIELD_WITHIN_API();
+		}
+
+		return uxReceived;
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	UBaseType_t uxSavedInterruptStatus, uxSent;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItems );
+		configASSERT( uxCount > ( UBaseType_t ) 0 );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0 );
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			configASSERT( pxQueue->pxQueueSetContainer == NULL );
+		}
+		#endif
+
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			uxSent = prvCopyItemsToQueue( pxQueue, ( const uint8_t * ) pvItems, uxCount );
+
+			if( uxSent > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+				#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+				{
+					if( ( prvNotifyTaskOfPost( pxQueue, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				if( ( prvWakeWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), &( pxQueue->xTxLock ), uxSent, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return uxSent;
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	UBaseType_t uxSavedInterruptStatus, uxReceived;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( uxMaxCount > ( UBaseType_t ) 0 );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0 );
+
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			uxReceived = prvCopyItemsFromQueue( pxQueue, ( uint8_t * ) pvBuffer, uxMaxCount );
+
+			if( uxReceived > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+				if( ( prvWakeWaitingTasks( &( pxQueue->xTasksWaitingToSend ), &( pxQueue->xRxLock ), uxReceived, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
 			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-			xReturn = pdPASS;
+		return uxReceived;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvCopyItemsToQueue( Queue_t * const pxQueue, const uint8_t *pucItems, const UBaseType_t uxCount )
+	{
+	UBaseType_t uxItems, uxFirst;
+
+		if( prvIsWriteSlotHeld( pxQueue ) != pdFALSE )
+		{
+			uxItems = 0;
+		}
+		else if( prvIsReadSlotHeld( pxQueue ) != pdFALSE )
+		{
+			/* The slot held by the reader is not counted in uxMessagesWaiting. */
+			uxItems = pxQueue->uxLength - pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
 		}
 		else
 		{
-			xReturn = pdFAIL;
-			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			uxItems = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
 		}
-	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+		if( uxItems > uxCount )
+		{
+			uxItems = uxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+		if( uxItems > ( UBaseType_t ) 0 )
+		{
+			/* The items up to the end of the storage area, then the rest from
+			its start. */
+			uxFirst = ( UBaseType_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo ) / pxQueue->uxItemSize; /*lint !e946 !e947 MISRA exception justified as both pointers are in the storage area. */
+			if( uxFirst > uxItems )
+			{
+				uxFirst = uxItems;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+			( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pucItems, ( size_t ) ( uxFirst * pxQueue->uxItemSize ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			pxQueue->pcWriteTo += uxFirst * pxQueue->uxItemSize;
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			if( uxItems > uxFirst )
+			{
+				( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) &( pucItems[ uxFirst * pxQueue->uxItemSize ] ), ( size_t ) ( ( uxItems - uxFirst ) * pxQueue->uxItemSize ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				pxQueue->pcWriteTo += ( uxItems - uxFirst ) * pxQueue->uxItemSize;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxQueue->uxMessagesWaiting += uxItems;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxItems;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvCopyItemsFromQueue( Queue_t * const pxQueue, uint8_t *pucBuffer, const UBaseType_t uxMaxCount )
 	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+	UBaseType_t uxItems, uxFirst;
+	int8_t *pcReadFrom;
+
+		if( prvIsReadSlotHeld( pxQueue ) != pdFALSE )
 		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+			/* Reading past the slot held by the reader would let the copy
+			functions write to it. */
+			uxItems = 0;
+		}
+		else
+		{
+			uxItems = pxQueue->uxMessagesWaiting;
+		}
 
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+		if( uxItems > uxMaxCount )
+		{
+			uxItems = uxMaxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			xReturn = pdPASS;
+		if( uxItems > ( UBaseType_t ) 0 )
+		{
+			/* u.pcReadFrom points to the last item read, the first item to
+			read is the one after it. */
+			pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+			if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pcReadFrom = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxFirst = ( UBaseType_t ) ( pxQueue->pcTail - pcReadFrom ) / pxQueue->uxItemSize; /*lint !e946 !e947 MISRA exception justified as both pointers are in the storage area. */
+			if( uxFirst > uxItems )
+			{
+				uxFirst = uxItems;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			( void ) memcpy( ( void * ) pucBuffer, ( void * ) pcReadFrom, ( size_t ) ( uxFirst * pxQueue->uxItemSize ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			pxQueue->u.pcReadFrom = pcReadFrom + ( ( uxFirst - ( UBaseType_t ) 1 ) * pxQueue->uxItemSize );
+
+			if( uxItems > uxFirst )
+			{
+				( void ) memcpy( ( void * ) &( pucBuffer[ uxFirst * pxQueue->uxItemSize ] ), ( void * ) pxQueue->pcHead, ( size_t ) ( ( uxItems - uxFirst ) * pxQueue->uxItemSize ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				pxQueue->u.pcReadFrom = pxQueue->pcHead + ( ( uxItems - uxFirst - ( UBaseType_t ) 1 ) * pxQueue->uxItemSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxQueue->uxMessagesWaiting -= uxItems;
 		}
 		else
 		{
-			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return uxItems;
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	/*-----------------------------------------------------------*/
 
-	return xReturn;
-}
+	static BaseType_t prvWakeWaitingTasks( EventList_t * const pxEventList, volatile BaseType_t * const pxLock, UBaseType_t uxCount, const BaseType_t xFromISR )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		if( ( xFromISR != pdFALSE ) && ( *pxLock != queueUNLOCKED ) )
+		{
+			/* The task that unlocks the queue unblocks one waiting task per
+			count, and stops when none is left. */
+			*pxLock += ( BaseType_t ) uxCount;
+		}
+		else
+		{
+			while( ( uxCount > ( UBaseType_t ) 0 ) && ( listEVENT_LIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+			{
+				if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				--uxCount;
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_BATCH */
 /*-----------------------------------------------------------*/
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
@@ -1715,7 +3117,19 @@ Queue_t *pxQueue;
 
 	taskENTER_CRITICAL();
 	{
-		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		if( prvIsWriteSlotHeld( pxQueue ) != pdFALSE )
+		{
+			uxReturn = ( UBaseType_t ) 0;
+		}
+		else if( prvIsReadSlotHeld( pxQueue ) != pdFALSE )
+		{
+			/* The slot held by the reader is not counted in uxMessagesWaiting. */
+			uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
+		}
+		else
+		{
+			uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		}
 	}
 	taskEXIT_CRITICAL();
 
@@ -1747,7 +3161,24 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		vQueueUnregisterQueue( pxQueue );
 	}
 	#endif
-	vPortFree( pxQueue );
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	{
+		/* Only free the queue if it was allocated dynamically. */
+		if( pxQueue->ucStaticallyAllocated == pdFALSE )
+		{
+			vPortFree( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		vPortFree( pxQueue );
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 }
 /*-----------------------------------------------------------*/
 
@@ -1908,7 +3339,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 				{
 					/* Tasks that are removed from the event list will get added to
 					the pending ready list as the scheduler is still suspended. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
@@ -1931,7 +3362,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			{
 				/* Tasks that are removed from the event list will get added to
 				the pending ready list as the scheduler is still suspended. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
@@ -1963,7 +3394,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 	{
 		while( pxQueue->xRxLock > queueLOCKED_UNMODIFIED )
 		{
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
 				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 				{
@@ -1994,7 +3425,7 @@ BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 )
+		if( prvCanCopyFromQueue( pxQueue ) == pdFALSE )
 		{
 			xReturn = pdTRUE;
 		}
@@ -2027,13 +3458,13 @@ BaseType_t xReturn;
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xCopyPosition )
 {
 BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+		if( prvCanCopyToQueue( pxQueue, xCopyPosition ) == pdFALSE )
 		{
 			xReturn = pdTRUE;
 		}
@@ -2048,6 +3479,59 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
+static BaseType_t prvCanCopyToQueue( const Queue_t *pxQueue, const BaseType_t xCopyPosition )
+{
+BaseType_t xReturn;
+
+	if( prvIsWriteSlotHeld( pxQueue ) != pdFALSE )
+	{
+		/* The next item would be written to the held slot. */
+		xReturn = pdFALSE;
+	}
+	else if( prvIsReadSlotHeld( pxQueue ) != pdFALSE )
+	{
+		/* Items sent to the front, or overwriting, are written to the held
+		slot, which is not counted in uxMessagesWaiting. */
+		if( ( xCopyPosition == queueSEND_TO_BACK ) && ( ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 ) < pxQueue->uxLength ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	else if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCanCopyFromQueue( const Queue_t *pxQueue )
+{
+BaseType_t xReturn;
+
+	/* Reading past the held slot would let the copy functions write to it. */
+	if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( prvIsReadSlotHeld( pxQueue ) == pdFALSE ) )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 {
 BaseType_t xReturn;
@@ -2078,7 +3562,7 @@ BaseType_t xReturn;
 		between the check to see if the queue is full and blocking on the queue. */
 		portDISABLE_INTERRUPTS();
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
 			{
 				/* The queue is full - do we want to block or just leave without
 				posting? */
@@ -2108,7 +3592,7 @@ BaseType_t xReturn;
 				xReturn = pdPASS;
 
 				/* Were any co-routines waiting for data to become available? */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					/* In this instance the co-routine could be placed directly
 					into the ready list as we are within a critical section.
@@ -2200,7 +3684,7 @@ BaseType_t xReturn;
 				xReturn = pdPASS;
 
 				/* Were any co-routines waiting for space to become available? */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					/* In this instance the co-routine could be placed directly
 					into the ready list as we are within a critical section.
@@ -2249,7 +3733,7 @@ BaseType_t xReturn;
 			co-routine has not already been woken. */
 			if( xCoRoutinePreviouslyWoken == pdFALSE )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
@@ -2307,7 +3791,7 @@ BaseType_t xReturn;
 
 			if( ( *pxCoRoutineWoken ) == pdFALSE )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
 					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
@@ -2433,7 +3917,7 @@ BaseType_t xReturn;
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
 	{
@@ -2444,7 +3928,7 @@ BaseType_t xReturn;
 		return pxQueue;
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_QUEUE_SETS == 1 )
@@ -2563,7 +4047,7 @@ BaseType_t xReturn;
 
 			if( pxQueueSetContainer->xTxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( listEVENT_LIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
 					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
@@ -2606,3 +4090,64 @@ BaseType_t xReturn;
 
 
 
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+
+	void vQueueSetNotifyBits( QueueSetMemberHandle_t xQueueOrSemaphore, void *pvTaskToNotify, const uint32_t ulBitsToSet )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueueOrSemaphore;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			pxQueue->pvNotifyTask = pvTaskToNotify;
+			pxQueue->ulNotifyBits = ulBitsToSet;
+
+			/* Items posted before the task was chosen would otherwise only be
+			seen with the next one. */
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				( void ) prvNotifyTaskOfPost( pxQueue, pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_OBJECT_NOTIFY_BITS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+
+	static BaseType_t prvNotifyTaskOfPost( const Queue_t * const pxQueue, const BaseType_t xFromISR )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	TaskHandle_t const xTaskToNotify = ( TaskHandle_t ) pxQueue->pvNotifyTask;
+
+		if( xTaskToNotify != NULL )
+		{
+			if( xFromISR != pdFALSE )
+			{
+				( void ) xTaskNotifyFromISR( xTaskToNotify, pxQueue->ulNotifyBits, eSetBits, &xHigherPriorityTaskWoken );
+			}
+			else
+			{
+				/* Yes it is ok to yield from within the critical section -
+				the kernel takes care of that. */
+				( void ) xTaskNotify( xTaskToNotify, pxQueue->ulNotifyBits, eSetBits );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xHigherPriorityTaskWoken;
+	}
+
+#endif /* configUSE_OBJECT_NOTIFY_BITS */
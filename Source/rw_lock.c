@@ -0,0 +1,649 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/*
+ * The state of the lock is the number of readers holding it and the writer
+ * holding it, if any.  Both are only changed with interrupts masked, like the
+ * two lists of waiting tasks.
+ *
+ * A writer that blocks is counted in uxWritersWaiting until it gets the lock
+ * or gives up, not only while it is on xWritersWaiting: a writer woken to take
+ * the lock still keeps new readers out until it has run.
+ */
+typedef struct xRWLockDefinition
+{
+	void * volatile pvWriter;						/*< Task holding the lock for writing, NULL if none. */
+	volatile UBaseType_t uxReaders;					/*< Number of tasks holding the lock for reading. */
+	volatile UBaseType_t uxWritersWaiting;			/*< Writers blocked on the lock or woken and not run yet, readers wait while it is not 0. */
+	EventList_t xReadersWaiting;					/*< Readers blocked on the lock, in priority order. */
+	EventList_t xWritersWaiting;					/*< Writers blocked on the lock, in priority order. */
+	uint8_t ucStaticallyAllocated;					/*< pdTRUE if created by xRWLockCreateStatic(), so not freed on delete. */
+
+} RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Clear the state and the lists of waiting tasks.
+ */
+static void prvInitialiseNewRWLock( RWLock_t * const pxRWLock );
+
+/*
+ * Called after the state changed: wakes the highest priority waiting writer
+ * if the lock is free and a writer waits, or all the waiting readers if no
+ * writer holds or waits for the lock.  Returns pdTRUE if a woken task has a
+ * priority above the calling task.  Must be called with interrupts masked.
+ */
+static BaseType_t prvWakeWaiters( RWLock_t * const pxRWLock );
+
+#if ( configUSE_MUTEXES == 1 )
+
+	/*
+	 * The priority of the highest priority task waiting for the lock, for
+	 * the writer holding it after a waiting task timed out.  Must be called
+	 * with interrupts masked.
+	 */
+	static UBaseType_t prvGetHighestWaiterPriority( RWLock_t * const pxRWLock );
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreate( void )
+	{
+	RWLock_t *pxRWLock;
+
+		pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) );
+
+		if( pxRWLock != NULL )
+		{
+			prvInitialiseNewRWLock( pxRWLock );
+			pxRWLock->ucStaticallyAllocated = ( uint8_t ) pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( RWLockHandle_t ) pxRWLock;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxStaticRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) pxStaticRWLock; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+	configASSERT( pxStaticRWLock );
+
+	/* The dummy structure in rw_lock.h must be the size of the real one. */
+	configASSERT( sizeof( StaticRWLock_t ) == sizeof( RWLock_t ) );
+
+	prvInitialiseNewRWLock( pxRWLock );
+	pxRWLock->ucStaticallyAllocated = ( uint8_t ) pdTRUE;
+
+	return ( RWLockHandle_t ) pxRWLock;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockDelete( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+
+	configASSERT( pxRWLock );
+	configASSERT( ( pxRWLock->pvWriter == NULL ) && ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) );
+	configASSERT( pxRWLock->uxWritersWaiting == ( UBaseType_t ) 0 );
+	configASSERT( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xReadersWaiting ) ) != pdFALSE );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( pxRWLock->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( ( void * ) pxRWLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xEntryTimeSet = pdFALSE, xReturn;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxRWLock );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( pxRWLock->pvWriter == NULL ) && ( pxRWLock->uxWritersWaiting == ( UBaseType_t ) 0 ) )
+			{
+				( pxRWLock->uxReaders )++;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Block until a writer gives the lock back with no other
+					writer waiting, or the time runs out.  The task is no
+					longer ready once on the event list, so the yield below
+					happens even if the lock is given back between leaving the
+					critical section and yielding. */
+					if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+					{
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							if( pxRWLock->pvWriter != NULL )
+							{
+								vTaskPriorityInherit( ( TaskHandle_t ) pxRWLock->pvWriter, NULL );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif
+
+						vTaskPlaceOnEventList( &( pxRWLock->xReadersWaiting ), xTicksToWait );
+					}
+					else
+					{
+						xTicksToWait = ( TickType_t ) 0;
+
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							/* The writer may have inherited the priority of
+							this task. */
+							if( pxRWLock->pvWriter != NULL )
+							{
+								vTaskPriorityDisinheritAfterTimeout( ( TaskHandle_t ) pxRWLock->pvWriter, prvGetHighestWaiterPriority( pxRWLock ) );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( ( xReturn != pdFAIL ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+		{
+			break;
+		}
+
+		/* Only reached after the task was placed on the event list. */
+		portYIELD_WITHIN_API();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveRead( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxRWLock->uxReaders > ( UBaseType_t ) 0 );
+		( pxRWLock->uxReaders )--;
+
+		if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+		{
+			xYieldRequired = prvWakeWaiters( pxRWLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xYieldRequired != pdFALSE )
+	{
+		portYIELD_WITHIN_API();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xEntryTimeSet = pdFALSE, xCounted = pdFALSE, xReturn, xYieldRequired = pdFALSE;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxRWLock );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( pxRWLock->pvWriter == NULL ) && ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) )
+			{
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* Counted as a mutex held, so the task keeps a priority
+					it inherits until it gives the lock back. */
+					pxRWLock->pvWriter = pvTaskIncrementMutexHeldCount();
+				}
+				#else
+				{
+					pxRWLock->pvWriter = ( void * ) xTaskGetCurrentTaskHandle();
+				}
+				#endif
+
+				if( xCounted != pdFALSE )
+				{
+					( pxRWLock->uxWritersWaiting )--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				/* The lock cannot be taken recursively. */
+				configASSERT( pxRWLock->pvWriter != ( void * ) xTaskGetCurrentTaskHandle() );
+
+				xReturn = pdFAIL;
+
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+					{
+						/* From now on the readers that come wait for this
+						task. */
+						if( xCounted == pdFALSE )
+						{
+							( pxRWLock->uxWritersWaiting )++;
+							xCounted = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							if( pxRWLock->pvWriter != NULL )
+							{
+								vTaskPriorityInherit( ( TaskHandle_t ) pxRWLock->pvWriter, NULL );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif
+
+						vTaskPlaceOnEventList( &( pxRWLock->xWritersWaiting ), xTicksToWait );
+					}
+					else
+					{
+						xTicksToWait = ( TickType_t ) 0;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* Giving up after blocking: the writer may have inherited
+					the priority of this task, and the readers held back by
+					this task may now go in. */
+					if( xCounted != pdFALSE )
+					{
+						( pxRWLock->uxWritersWaiting )--;
+
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							if( pxRWLock->pvWriter != NULL )
+							{
+								vTaskPriorityDisinheritAfterTimeout( ( TaskHandle_t ) pxRWLock->pvWriter, prvGetHighestWaiterPriority( pxRWLock ) );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif
+
+						xYieldRequired = prvWakeWaiters( pxRWLock );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( ( xReturn != pdFAIL ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+		{
+			break;
+		}
+
+		/* Only reached after the task was placed on the event list. */
+		portYIELD_WITHIN_API();
+	}
+
+	if( xYieldRequired != pdFALSE )
+	{
+		portYIELD_WITHIN_API();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveWrite( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = ( RWLock_t * ) xRWLock;
+BaseType_t xYieldRequired;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		/* Only the writer holding the lock can give it back. */
+		configASSERT( pxRWLock->pvWriter == ( void * ) xTaskGetCurrentTaskHandle() );
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			/* Back to the base priority if this was the last lock or mutex
+			held. */
+			xYieldRequired = xTaskPriorityDisinherit( ( TaskHandle_t ) pxRWLock->pvWriter );
+		}
+		#else
+		{
+			xYieldRequired = pdFALSE;
+		}
+		#endif
+
+		pxRWLock->pvWriter = NULL;
+
+		if( prvWakeWaiters( pxRWLock ) != pdFALSE )
+		{
+			xYieldRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xYieldRequired != pdFALSE )
+	{
+		portYIELD_WITHIN_API();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxRWLockGetReaders( RWLockHandle_t xRWLock )
+{
+	configASSERT( xRWLock );
+
+	return ( ( RWLock_t * ) xRWLock )->uxReaders;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewRWLock( RWLock_t * const pxRWLock )
+{
+	pxRWLock->pvWriter = NULL;
+	pxRWLock->uxReaders = ( UBaseType_t ) 0;
+	pxRWLock->uxWritersWaiting = ( UBaseType_t ) 0;
+
+	vEventListInitialise( &( pxRWLock->xReadersWaiting ) );
+	vEventListInitialise( &( pxRWLock->xWritersWaiting ) );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWakeWaiters( RWLock_t * const pxRWLock )
+{
+BaseType_t xYieldRequired = pdFALSE;
+
+	if( pxRWLock->pvWriter == NULL )
+	{
+		if( pxRWLock->uxWritersWaiting != ( UBaseType_t ) 0 )
+		{
+			/* A woken writer that has not run yet is no longer on the list,
+			it takes the lock when it runs. */
+			if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xWritersWaiting ) ) == pdFALSE ) )
+			{
+				xYieldRequired = xTaskRemoveFromEventList( &( pxRWLock->xWritersWaiting ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* All the readers can hold the lock together.  This is the one
+			loop run with interrupts masked, one pass per waiting reader. */
+			while( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xReadersWaiting ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxRWLock->xReadersWaiting ) ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xYieldRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static UBaseType_t prvGetHighestWaiterPriority( RWLock_t * const pxRWLock )
+	{
+	ListItem_t *pxHighest;
+	UBaseType_t uxHighestPriority = tskIDLE_PRIORITY, uxPriority;
+
+		/* The event list item value of a waiting task is its inverted
+		priority. */
+		pxHighest = listGET_HIGHEST_EVENT_ENTRY( &( pxRWLock->xReadersWaiting ) );
+		if( pxHighest != NULL )
+		{
+			uxHighestPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( pxHighest );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxHighest = listGET_HIGHEST_EVENT_ENTRY( &( pxRWLock->xWritersWaiting ) );
+		if( pxHighest != NULL )
+		{
+			uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( pxHighest );
+
+			if( uxPriority > uxHighestPriority )
+			{
+				uxHighestPriority = uxPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxHighestPriority;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
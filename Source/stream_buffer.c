@@ -0,0 +1,802 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build stream_buffer.c
+#endif
+
+/*
+ * The storage is one byte longer than the capacity, so the head index only
+ * equals the tail index when the buffer is empty.  Each index is written by
+ * one side only and is a single word, so neither side needs a critical
+ * section to move data.
+ */
+typedef struct xStreamBufferDefinition
+{
+	volatile size_t xTail;							/*< Index of the next byte to read, only written by the reader. */
+	volatile size_t xHead;							/*< Index of the next byte to write, only written by the writer. */
+	size_t xLength;									/*< Size of the storage area, the capacity plus one. */
+	volatile size_t xTriggerLevelBytes;				/*< Bytes needed in the buffer before a blocked reader is woken. */
+	volatile TaskHandle_t xTaskWaitingToReceive;	/*< Reader blocked on the buffer, if any. */
+	volatile TaskHandle_t xTaskWaitingToSend;		/*< Writer blocked on the buffer, if any. */
+	uint8_t *pucBuffer;								/*< Storage area, allocated just after the structure unless created statically. */
+	#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+		void * volatile pvNotifyTask;				/*< Task that gets ulNotifyBits set in its notification value when the trigger level is reached, NULL if none. */
+		volatile uint32_t ulNotifyBits;
+	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated;				/*< Set to pdTRUE if the buffer was created by xStreamBufferCreateStatic(), so it is not freed if it is deleted. */
+	#endif
+
+} StreamBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy bytes in or out of the storage area, wrapping around its end, and move
+ * the index of the calling side.  The caller has checked that they fit.
+ */
+static void prvWriteBytes( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount );
+static void prvReadBytes( StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount );
+
+/*
+ * Wake the task blocked on the other side of the buffer, if any.
+ */
+static void prvNotifyWaitingTask( volatile TaskHandle_t * const pxWaitingTask );
+static void prvNotifyWaitingTaskFromISR( volatile TaskHandle_t * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken );
+
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+
+	/*
+	 * Set the bits chosen by vStreamBufferSetNotifyBits() in the notification
+	 * value of the chosen task, if any.  pxHigherPriorityTaskWoken is only used
+	 * if xFromISR is pdTRUE.
+	 */
+	static void prvNotifyTaskOfSend( StreamBuffer_t * const pxStreamBuffer, const BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken );
+
+#endif
+
+/*
+ * Set up the members of a stream buffer created statically or dynamically.
+ * xLength is the size of the storage area, the capacity plus one.
+ */
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xLength, size_t xTriggerLevelBytes );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes )
+	{
+	StreamBuffer_t *pxStreamBuffer = NULL;
+
+		configASSERT( xBufferSizeBytes > 0 );
+
+		if( xTriggerLevelBytes == ( size_t ) 0 )
+		{
+			xTriggerLevelBytes = ( size_t ) 1;
+		}
+
+		if( xTriggerLevelBytes <= xBufferSizeBytes )
+		{
+			xBufferSizeBytes++;
+			pxStreamBuffer = ( StreamBuffer_t * ) pvPortMalloc( sizeof( StreamBuffer_t ) + xBufferSizeBytes );
+
+			if( pxStreamBuffer != NULL )
+			{
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					pxStreamBuffer->ucStaticallyAllocated = pdFALSE;
+				}
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+				prvInitialiseNewStreamBuffer( pxStreamBuffer, ( uint8_t * ) ( pxStreamBuffer + 1 ), xBufferSizeBytes, xTriggerLevelBytes );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( StreamBufferHandle_t ) pxStreamBuffer;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, uint8_t *pucStreamBufferStorage, StaticStreamBuffer_t *pxStaticStreamBuffer )
+	{
+	StreamBuffer_t *pxStreamBuffer = NULL;
+
+		configASSERT( xBufferSizeBytes > 0 );
+		configASSERT( pucStreamBufferStorage != NULL );
+		configASSERT( pxStaticStreamBuffer != NULL );
+
+		/* The dummy structure in stream_buffer.h must be the size of the real
+		structure. */
+		configASSERT( sizeof( StaticStreamBuffer_t ) == sizeof( StreamBuffer_t ) );
+
+		if( xTriggerLevelBytes == ( size_t ) 0 )
+		{
+			xTriggerLevelBytes = ( size_t ) 1;
+		}
+
+		if( xTriggerLevelBytes <= xBufferSizeBytes )
+		{
+			pxStreamBuffer = ( StreamBuffer_t * ) pxStaticStreamBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				pxStreamBuffer->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewStreamBuffer( pxStreamBuffer, pucStreamBufferStorage, xBufferSizeBytes + ( size_t ) 1, xTriggerLevelBytes );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( StreamBufferHandle_t ) pxStreamBuffer;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xLength, size_t xTriggerLevelBytes )
+{
+	pxStreamBuffer->xTail = ( size_t ) 0;
+	pxStreamBuffer->xHead = ( size_t ) 0;
+	pxStreamBuffer->xLength = xLength;
+	pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+	pxStreamBuffer->xTaskWaitingToReceive = NULL;
+	pxStreamBuffer->xTaskWaitingToSend = NULL;
+	pxStreamBuffer->pucBuffer = pucBuffer;
+
+	#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+	{
+		pxStreamBuffer->pvNotifyTask = NULL;
+		pxStreamBuffer->ulNotifyBits = ( uint32_t ) 0;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+	configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	{
+		/* Only free the buffer if it was allocated dynamically. */
+		if( pxStreamBuffer->ucStaticallyAllocated == pdFALSE )
+		{
+			vPortFree( ( void * ) pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		vPortFree( ( void * ) pxStreamBuffer );
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	taskENTER_CRITICAL();
+	{
+		if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+		{
+			pxStreamBuffer->xTail = ( size_t ) 0;
+			pxStreamBuffer->xHead = ( size_t ) 0;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevelBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xTriggerLevelBytes == ( size_t ) 0 )
+	{
+		xTriggerLevelBytes = ( size_t ) 1;
+	}
+
+	if( xTriggerLevelBytes < pxStreamBuffer->xLength )
+	{
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+
+	void vStreamBufferSetNotifyBits( StreamBufferHandle_t xStreamBuffer, void *pvTaskToNotify, uint32_t ulBitsToSet )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+		configASSERT( pxStreamBuffer );
+
+		taskENTER_CRITICAL();
+		{
+			pxStreamBuffer->pvNotifyTask = pvTaskToNotify;
+			pxStreamBuffer->ulNotifyBits = ulBitsToSet;
+		}
+		taskEXIT_CRITICAL();
+
+		/* Bytes sent before the task was chosen would otherwise only be seen
+		with the next send. */
+		if( xStreamBufferBytesAvailable( xStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyTaskOfSend( pxStreamBuffer, pdFALSE, NULL );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_OBJECT_NOTIFY_BITS */
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xCount;
+
+	configASSERT( pxStreamBuffer );
+
+	/* The head is read once, a write may complete in the meantime. */
+	xCount = pxStreamBuffer->xHead;
+	xCount += pxStreamBuffer->xLength - pxStreamBuffer->xTail;
+
+	if( xCount >= pxStreamBuffer->xLength )
+	{
+		xCount -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xSpace;
+
+	configASSERT( pxStreamBuffer );
+
+	/* One byte of the storage is never used, see StreamBuffer_t. */
+	xSpace = pxStreamBuffer->xTail;
+	xSpace += pxStreamBuffer->xLength - ( size_t ) 1 - pxStreamBuffer->xHead;
+
+	if( xSpace >= pxStreamBuffer->xLength )
+	{
+		xSpace -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xSpace, xRequiredSpace;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvTxData );
+
+	/* More than the capacity can never fit, wait for an empty buffer then. */
+	xRequiredSpace = xDataLengthBytes;
+	if( xRequiredSpace > ( pxStreamBuffer->xLength - ( size_t ) 1 ) )
+	{
+		xRequiredSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* A notification left pending from an earlier wait must
+					not end the wait below. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( xSpace >= xRequiredSpace )
+			{
+				break;
+			}
+
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+			{
+				break;
+			}
+		}
+	}
+
+	xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+	if( xDataLengthBytes > xSpace )
+	{
+		xDataLengthBytes = xSpace;
+	}
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvWriteBytes( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+
+		if( xStreamBufferBytesAvailable( xStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToReceive ) );
+
+			#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+			{
+				prvNotifyTaskOfSend( pxStreamBuffer, pdFALSE, NULL );
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xSpace;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvTxData );
+
+	xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+	if( xDataLengthBytes > xSpace )
+	{
+		xDataLengthBytes = xSpace;
+	}
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvWriteBytes( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+
+		if( xStreamBufferBytesAvailable( xStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+
+			#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+			{
+				prvNotifyTaskOfSend( pxStreamBuffer, pdTRUE, pxHigherPriorityTaskWoken );
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xAvailable;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvRxData );
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		taskENTER_CRITICAL();
+		{
+			xAvailable = xStreamBufferBytesAvailable( xStreamBuffer );
+
+			if( xAvailable == ( size_t ) 0 )
+			{
+				/* A notification left pending from an earlier wait must not
+				end the wait below. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xAvailable == ( size_t ) 0 )
+		{
+			/* Woken by the writer once the trigger level is reached, or by
+			the time out, the buffer is then read as it is. */
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	xAvailable = xStreamBufferBytesAvailable( xStreamBuffer );
+	if( xBufferLengthBytes > xAvailable )
+	{
+		xBufferLengthBytes = xAvailable;
+	}
+
+	if( xBufferLengthBytes > ( size_t ) 0 )
+	{
+		prvReadBytes( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes );
+		prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToSend ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xBufferLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xAvailable;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvRxData );
+
+	xAvailable = xStreamBufferBytesAvailable( xStreamBuffer );
+	if( xBufferLengthBytes > xAvailable )
+	{
+		xBufferLengthBytes = xAvailable;
+	}
+
+	if( xBufferLengthBytes > ( size_t ) 0 )
+	{
+		prvReadBytes( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes );
+		prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xBufferLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteBytes( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+{
+size_t xHead = pxStreamBuffer->xHead, xFirst;
+
+	/* Up to the end of the storage area, then from its start. */
+	xFirst = pxStreamBuffer->xLength - xHead;
+	if( xFirst > xCount )
+	{
+		xFirst = xCount;
+	}
+
+	( void ) memcpy( ( void * ) &( pxStreamBuffer->pucBuffer[ xHead ] ), ( const void * ) pucData, xFirst );
+
+	if( xCount > xFirst )
+	{
+		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirst ] ), xCount - xFirst );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xHead += xCount;
+	if( xHead >= pxStreamBuffer->xLength )
+	{
+		xHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The bytes are in place before the reader can see them. */
+	pxStreamBuffer->xHead = xHead;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReadBytes( StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount )
+{
+size_t xTail = pxStreamBuffer->xTail, xFirst;
+
+	xFirst = pxStreamBuffer->xLength - xTail;
+	if( xFirst > xCount )
+	{
+		xFirst = xCount;
+	}
+
+	( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirst );
+
+	if( xCount > xFirst )
+	{
+		( void ) memcpy( ( void * ) &( pucData[ xFirst ] ), ( const void * ) pxStreamBuffer->pucBuffer, xCount - xFirst );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xTail += xCount;
+	if( xTail >= pxStreamBuffer->xLength )
+	{
+		xTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The bytes are copied out before the writer can reuse the space. */
+	pxStreamBuffer->xTail = xTail;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTask( volatile TaskHandle_t * const pxWaitingTask )
+{
+	/* The scheduler is suspended so the woken task cannot run, and find the
+	handle still set, before it is cleared. */
+	vTaskSuspendAll();
+	{
+		if( *pxWaitingTask != NULL )
+		{
+			( void ) xTaskNotify( *pxWaitingTask, ( uint32_t ) 0, eNoAction );
+			*pxWaitingTask = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTaskFromISR( volatile TaskHandle_t * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( *pxWaitingTask != NULL )
+		{
+			( void ) xTaskNotifyFromISR( *pxWaitingTask, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+			*pxWaitingTask = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_OBJECT_NOTIFY_BITS == 1 )
+
+	static void prvNotifyTaskOfSend( StreamBuffer_t * const pxStreamBuffer, const BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* The task and its bits are read together. */
+		if( xFromISR != pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				if( pxStreamBuffer->pvNotifyTask != NULL )
+				{
+					( void ) xTaskNotifyFromISR( ( TaskHandle_t ) pxStreamBuffer->pvNotifyTask, pxStreamBuffer->ulNotifyBits, eSetBits, pxHigherPriorityTaskWoken );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxStreamBuffer->pvNotifyTask != NULL )
+				{
+					( void ) xTaskNotify( ( TaskHandle_t ) pxStreamBuffer->pvNotifyTask, pxStreamBuffer->ulNotifyBits, eSetBits );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+#endif /* configUSE_OBJECT_NOTIFY_BITS */
+/*-----------------------------------------------------------*/
+
@@ -79,6 +79,7 @@ task.h is included from an application file. */
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "queue.h"
 #include "timers.h"
 #include "StackMacros.h"
 
@@ -118,6 +119,20 @@ functions but without including stdio.h here. */
 	#define taskYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+	/* Number of buckets of each of the two delayed task lists. */
+	#define taskDELAYED_BUCKETS			( ( UBaseType_t ) 1U << configDELAYED_TASK_BUCKET_BITS )
+	#define taskDELAYED_BUCKET_MASK		( ( TickType_t ) ( taskDELAYED_BUCKETS - ( UBaseType_t ) 1U ) )
+#endif
+
+/* Tasks can be created with a TCB and a stack given by the application, or
+allocated from the heap, or both ways.  When both are possible the TCB records
+how the task was created, the values being those below. */
+#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE	( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 0 )
+#define tskSTATICALLY_ALLOCATED_STACK_ONLY			( ( uint8_t ) 1 )
+#define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
+
 /* Value that can be assigned to the eNotifyState member of the TCB. */
 typedef enum
 {
@@ -162,6 +177,7 @@ typedef struct tskTaskControlBlock
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t 	uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 		UBaseType_t 	uxMutexesHeld;
+		void			*pvMutexWaitedOn;	/*< The mutex the task is blocked on, if any - used to pass inherited priorities along chains of mutexes. */
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -192,6 +208,14 @@ typedef struct tskTaskControlBlock
 		volatile eNotifyValue eNotifyState;
 	#endif
 
+	#if ( configUSE_HR_TIMER == 1 )
+		volatile uint8_t ucDelayAborted;	/*< Set by xTaskAbortDelayFromISR(), the next timeout check of the task times out at once. */
+	#endif
+
+	#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
+		uint8_t	ucStaticallyAllocated; 		/*< Which of the stack and the TCB were given by the application, so are not freed if the task is deleted. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -213,8 +237,13 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+	PRIVILEGED_DATA static List_t xDelayedTaskList1[ taskDELAYED_BUCKETS ];	/*< Delayed tasks, in the bucket given by the low bits of their wake time. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2[ taskDELAYED_BUCKETS ];	/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+#else
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+#endif
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
@@ -371,7 +400,7 @@ count overflows. */
 	List_t *pxTemp;																					\
 																									\
 	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+	configASSERT( ( listLIST_IS_EMPTY( taskNEAREST_DELAYED_LIST() ) ) );							\
 																									\
 	pxTemp = pxDelayedTaskList;																		\
 	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
@@ -380,6 +409,39 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+
+	/* Each delayed task list is an array of taskDELAYED_BUCKETS lists.  A task
+	is inserted, in wake time order, in the bucket selected by the low bits of
+	its wake time, so an insertion only walks the tasks of one bucket.  The
+	task with the nearest wake time is found by prvGetNearestDelayedList(). */
+	#define taskDELAYED_LIST_FOR( pxList, xTimeToWake ) ( &( ( pxList )[ ( xTimeToWake ) & taskDELAYED_BUCKET_MASK ] ) )
+	#define taskNEAREST_DELAYED_LIST() prvGetNearestDelayedList()
+	#define taskIS_DELAYED_LIST( pxList )																\
+		( ( ( ( pxList ) >= &( xDelayedTaskList1[ 0 ] ) ) && ( ( pxList ) < &( xDelayedTaskList1[ taskDELAYED_BUCKETS ] ) ) ) ||	\
+		  ( ( ( pxList ) >= &( xDelayedTaskList2[ 0 ] ) ) && ( ( pxList ) < &( xDelayedTaskList2[ taskDELAYED_BUCKETS ] ) ) ) )
+
+#else
+
+	#define taskDELAYED_LIST_FOR( pxList, xTimeToWake ) ( pxList )
+	#define taskNEAREST_DELAYED_LIST() ( pxDelayedTaskList )
+	#define taskIS_DELAYED_LIST( pxList ) ( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#endif /* configUSE_DELAYED_TASK_BUCKETS */
+
+#if ( configUSE_HR_TIMER == 1 )
+
+	/* The microsecond timeout of hr_timer.c set for the calling task expired,
+	see xTaskAbortDelayFromISR().  The task does not block until the timeout
+	is stopped. */
+	#define taskDELAY_ABORTED() ( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+
+#else
+
+	#define taskDELAY_ABORTED() ( pdFALSE )
+
+#endif /* configUSE_HR_TIMER */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -483,13 +545,35 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
  * The currently executing task is entering the Blocked state.  Add the task to
  * either the current or the overflow delayed task list.
  */
-static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+static void prvAddCurrentTaskToDelayedList( TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+
+/*
+ * Changes the priority a task runs at, but not its base priority, on behalf of
+ * the priority inheritance mechanism: the task is moved to the ready list of
+ * its new priority if it is ready.  The position of a task blocked on a mutex
+ * in the list of the tasks waiting for that mutex is left to the caller.
+ */
+#if ( configUSE_MUTEXES == 1 )
+
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
  * Allocates memory from the heap for a TCB and associated stack.  Checks the
  * allocation was successful.
  */
-static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Sets up the TCB and the stack of a new task, whichever way their memory was
+ * obtained, and adds the task to the ready list.
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions, TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
 /*
  * Fills an TaskStatus_t structure with information on each task that is
@@ -537,7 +621,17 @@ static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t *
  */
 static void prvResetNextTaskUnblockTime( void );
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( configUSE_DELAYED_TASK_BUCKETS == 1 )
+
+	/*
+	 * Returns the bucket of the current delayed task list that holds the task
+	 * with the nearest wake time, or an empty bucket if no task is delayed.
+	 */
+	static List_t *prvGetNearestDelayedList( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	/*
 	 * Helper function used to pad task names with spaces when printing out
@@ -548,194 +642,259 @@ static void prvResetNextTaskUnblockTime( void );
 #endif
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-BaseType_t xReturn;
-TCB_t * pxNewTCB;
-StackType_t *pxTopOfStack;
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	configASSERT( pxTaskCode );
-	configASSERT( ( ( uxPriority & ( UBaseType_t ) ( ~portPRIVILEGE_BIT ) ) < ( UBaseType_t ) configMAX_PRIORITIES ) );
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TCB_t *pxNewTCB;
+	TaskHandle_t xReturn;
+
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
 
-	/* Allocate the memory required by the TCB and stack for the new task,
-	checking that the allocation was successful. */
-	pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
+		/* The dummy structure in task.h must be the size of the real TCB. */
+		configASSERT( sizeof( StaticTask_t ) == sizeof( TCB_t ) );
 
-	if( pxNewTCB != NULL )
+		pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+		pxNewTCB->pxStack = puxStackBuffer;
+
+		#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
+		{
+			/* Neither the TCB nor the stack are freed if the task is deleted. */
+			pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+		}
+		#endif
+
+		prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xReturn, puxStackBuffer, NULL, pxNewTCB );
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		#if( portUSING_MPU_WRAPPERS == 1 )
-			/* Should the task be created in privileged mode? */
-			BaseType_t xRunPrivileged;
-			if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-			{
-				xRunPrivileged = pdTRUE;
-			}
-			else
-			{
-				xRunPrivileged = pdFALSE;
-			}
-			uxPriority &= ~portPRIVILEGE_BIT;
+	BaseType_t xReturn;
+	TCB_t * pxNewTCB;
 
-			if( puxStackBuffer != NULL )
-			{
-				/* The application provided its own stack.  Note this so no
-				attempt is made to delete the stack should that task be
-				deleted. */
-				pxNewTCB->xUsingStaticallyAllocatedStack = pdTRUE;
-			}
-			else
-			{
-				/* The stack was allocated dynamically.  Note this so it can be
-				deleted again if the task is deleted. */
-				pxNewTCB->xUsingStaticallyAllocatedStack = pdFALSE;
-			}
-		#endif /* portUSING_MPU_WRAPPERS == 1 */
+		/* Allocate the memory required by the TCB and stack for the new task,
+		checking that the allocation was successful. */
+		pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
 
-		/* Calculate the top of stack address.  This depends on whether the
-		stack grows from high memory to low (as per the 80x86) or vice versa.
-		portSTACK_GROWTH is used to make the result positive or negative as
-		required by the port. */
-		#if( portSTACK_GROWTH < 0 )
+		if( pxNewTCB != NULL )
 		{
-			pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
-			pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
+			{
+				/* Note how the task was created so only what was allocated is
+				freed if the task is deleted. */
+				if( puxStackBuffer != NULL )
+				{
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+				}
+				else
+				{
+					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+			}
+			#endif
 
-			/* Check the alignment of the calculated top of stack is correct. */
-			configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+			prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, puxStackBuffer, xRegions, pxNewTCB );
+			xReturn = pdPASS;
 		}
-		#else /* portSTACK_GROWTH */
+		else
 		{
-			pxTopOfStack = pxNewTCB->pxStack;
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			traceTASK_CREATE_FAILED();
+		}
+
+		return xReturn;
+	}
 
-			/* Check the alignment of the stack buffer is correct. */
-			configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
 
-			/* If we want to use stack checking on architectures that use
-			a positive stack growth direction then we also need to store the
-			other extreme of the stack space. */
-			pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
-		}
-		#endif /* portSTACK_GROWTH */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions, TCB_t *pxNewTCB ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+StackType_t *pxTopOfStack;
 
-		/* Setup the newly allocated TCB with the initial state of the task. */
-		prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+	configASSERT( pxTaskCode );
+	configASSERT( ( ( uxPriority & ( UBaseType_t ) ( ~portPRIVILEGE_BIT ) ) < ( UBaseType_t ) configMAX_PRIORITIES ) );
 
-		/* Initialize the TCB stack to look as if the task was already running,
-		but had been interrupted by the scheduler.  The return address is set
-		to the start of the task function. Once the stack has been initialised
-		the	top of stack variable is updated. */
-		#if( portUSING_MPU_WRAPPERS == 1 )
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+			xRunPrivileged = pdTRUE;
 		}
-		#else /* portUSING_MPU_WRAPPERS */
+		else
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+			xRunPrivileged = pdFALSE;
 		}
-		#endif /* portUSING_MPU_WRAPPERS */
+		uxPriority &= ~portPRIVILEGE_BIT;
 
-		if( ( void * ) pxCreatedTask != NULL )
+		if( puxStackBuffer != NULL )
 		{
-			/* Pass the TCB out - in an anonymous way.  The calling function/
-			task can use this as a handle to delete the task later if
-			required.*/
-			*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+			/* The application provided its own stack.  Note this so no
+			attempt is made to delete the stack should that task be
+			deleted. */
+			pxNewTCB->xUsingStaticallyAllocatedStack = pdTRUE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* The stack was allocated dynamically.  Note this so it can be
+			deleted again if the task is deleted. */
+			pxNewTCB->xUsingStaticallyAllocatedStack = pdFALSE;
 		}
+	#else
+		/* Only the MPU port needs to know where the stack came from. */
+		( void ) puxStackBuffer;
+	#endif /* portUSING_MPU_WRAPPERS == 1 */
 
-		/* Ensure interrupts don't access the task lists while they are being
-		updated. */
-		taskENTER_CRITICAL();
+	/* Avoid dependency on memset() if it is not required. */
+	#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+	{
+		/* Just to help debugging. */
+		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
+	}
+	#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
+
+	/* Calculate the top of stack address.  This depends on whether the
+	stack grows from high memory to low (as per the 80x86) or vice versa.
+	portSTACK_GROWTH is used to make the result positive or negative as
+	required by the port. */
+	#if( portSTACK_GROWTH < 0 )
+	{
+		pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
+		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+
+		/* Check the alignment of the calculated top of stack is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+	}
+	#else /* portSTACK_GROWTH */
+	{
+		pxTopOfStack = pxNewTCB->pxStack;
+
+		/* Check the alignment of the stack buffer is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+		/* If we want to use stack checking on architectures that use
+		a positive stack growth direction then we also need to store the
+		other extreme of the stack space. */
+		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
+	}
+	#endif /* portSTACK_GROWTH */
+
+	/* Setup the newly allocated TCB with the initial state of the task. */
+	prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+
+	/* Initialize the TCB stack to look as if the task was already running,
+	but had been interrupted by the scheduler.  The return address is set
+	to the start of the task function. Once the stack has been initialised
+	the	top of stack variable is updated. */
+	#if( portUSING_MPU_WRAPPERS == 1 )
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+	}
+	#else /* portUSING_MPU_WRAPPERS */
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+	}
+	#endif /* portUSING_MPU_WRAPPERS */
+
+	if( ( void * ) pxCreatedTask != NULL )
+	{
+		/* Pass the TCB out - in an anonymous way.  The calling function/
+		task can use this as a handle to delete the task later if
+		required.*/
+		*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Ensure interrupts don't access the task lists while they are being
+	updated. */
+	taskENTER_CRITICAL();
+	{
+		uxCurrentNumberOfTasks++;
+		if( pxCurrentTCB == NULL )
 		{
-			uxCurrentNumberOfTasks++;
-			if( pxCurrentTCB == NULL )
-			{
-				/* There are no other tasks, or all the other tasks are in
-				the suspended state - make this the current task. */
-				pxCurrentTCB =  pxNewTCB;
+			/* There are no other tasks, or all the other tasks are in
+			the suspended state - make this the current task. */
+			pxCurrentTCB =  pxNewTCB;
 
-				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-				{
-					/* This is the first task to be created so do the preliminary
-					initialisation required.  We will not recover if this call
-					fails, but we will report the failure. */
-					prvInitialiseTaskLists();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+			{
+				/* This is the first task to be created so do the preliminary
+				initialisation required.  We will not recover if this call
+				fails, but we will report the failure. */
+				prvInitialiseTaskLists();
 			}
 			else
 			{
-				/* If the scheduler is not already running, make this task the
-				current task if it is the highest priority task to be created
-				so far. */
-				if( xSchedulerRunning == pdFALSE )
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* If the scheduler is not already running, make this task the
+			current task if it is the highest priority task to be created
+			so far. */
+			if( xSchedulerRunning == pdFALSE )
+			{
+				if( pxCurrentTCB->uxPriority <= uxPriority )
 				{
-					if( pxCurrentTCB->uxPriority <= uxPriority )
-					{
-						pxCurrentTCB = pxNewTCB;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					pxCurrentTCB = pxNewTCB;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-
-			uxTaskNumber++;
-
-			#if ( configUSE_TRACE_FACILITY == 1 )
+			else
 			{
-				/* Add a counter into the TCB for tracing only. */
-				pxNewTCB->uxTCBNumber = uxTaskNumber;
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif /* configUSE_TRACE_FACILITY */
-			traceTASK_CREATE( pxNewTCB );
+		}
 
-			prvAddTaskToReadyList( pxNewTCB );
+		uxTaskNumber++;
 
-			xReturn = pdPASS;
-			portSETUP_TCB( pxNewTCB );
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* Add a counter into the TCB for tracing only. */
+			pxNewTCB->uxTCBNumber = uxTaskNumber;
 		}
-		taskEXIT_CRITICAL();
-	}
-	else
-	{
-		xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
-		traceTASK_CREATE_FAILED();
+		#endif /* configUSE_TRACE_FACILITY */
+		traceTASK_CREATE( pxNewTCB );
+
+		prvAddTaskToReadyList( pxNewTCB );
+
+		portSETUP_TCB( pxNewTCB );
 	}
+	taskEXIT_CRITICAL();
 
-	if( xReturn == pdPASS )
+	if( xSchedulerRunning != pdFALSE )
 	{
-		if( xSchedulerRunning != pdFALSE )
+		/* If the created task is of a higher priority than the current task
+		then it should run now. */
+		if( pxCurrentTCB->uxPriority < uxPriority )
 		{
-			/* If the created task is of a higher priority than the current task
-			then it should run now. */
-			if( pxCurrentTCB->uxPriority < uxPriority )
-			{
-				taskYIELD_IF_USING_PREEMPTION();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			taskYIELD_IF_USING_PREEMPTION();
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-
-	return xReturn;
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 }
 /*-----------------------------------------------------------*/
 
@@ -941,25 +1100,34 @@ StackType_t *pxTopOfStack;
 				This task cannot be in an event list as it is the currently
 				executing task. */
 
-				/* Calculate the time to wake - this may overflow but this is
-				not a problem. */
-				xTimeToWake = xTickCount + xTicksToDelay;
-
-				/* We must remove ourselves from the ready list before adding
-				ourselves to the blocked list as the same list item is used for
-				both lists. */
-				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				/* The delay of vTaskDelayUs() can end before the task got
+				here, the task then does not block. */
+				if( taskDELAY_ABORTED() == pdFALSE )
 				{
-					/* The current task must be in a ready list, so there is
-					no need to check, and the port reset macro can be called
-					directly. */
-					portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					/* Calculate the time to wake - this may overflow but this
+					is not a problem. */
+					xTimeToWake = xTickCount + xTicksToDelay;
+
+					/* We must remove ourselves from the ready list before
+					adding ourselves to the blocked list as the same list item
+					is used for both lists. */
+					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						/* The current task must be in a ready list, so there
+						is no need to check, and the port reset macro can be
+						called directly. */
+						portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					prvAddCurrentTaskToDelayedList( xTimeToWake );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-				prvAddCurrentTaskToDelayedList( xTimeToWake );
 			}
 			xAlreadyYielded = xTaskResumeAll();
 		}
@@ -1006,7 +1174,7 @@ StackType_t *pxTopOfStack;
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			if( taskIS_DELAYED_LIST( pxStateList ) )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1545,7 +1713,36 @@ void vTaskStartScheduler( void )
 BaseType_t xReturn;
 
 	/* Add the idle task at the lowest priority. */
-	#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+	StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+	StackType_t *pxIdleTaskStackBuffer = NULL;
+	uint16_t usIdleTaskStackSize = tskIDLE_STACK_SIZE;
+	TaskHandle_t xIdleTask;
+
+		/* The memory used by the idle task is provided by the application, so
+		the scheduler can be started without a heap. */
+		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &usIdleTaskStackSize );
+		xIdleTask = xTaskCreateStatic( prvIdleTask, "IDLE", usIdleTaskStackSize, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), pxIdleTaskStackBuffer, pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+		#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+		{
+			/* Store the handle so it can be returned by the
+			xTaskGetIdleTaskHandle() function. */
+			xIdleTaskHandle = xIdleTask;
+		}
+		#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+
+		if( xIdleTask != NULL )
+		{
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	#elif ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 	{
 		/* Create the idle task, storing its handle in xIdleTaskHandle so it can
 		be returned by the xTaskGetIdleTaskHandle() function. */
@@ -1556,7 +1753,7 @@ BaseType_t xReturn;
 		/* Create the idle task without storing its handle. */
 		xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL );  /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
 	}
-	#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 	#if ( configUSE_TIMERS == 1 )
 	{
@@ -1852,8 +2049,20 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < taskDELAYED_BUCKETS; uxQueue++ )
+					{
+						uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxDelayedTaskList[ uxQueue ] ), eBlocked );
+						uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxOverflowDelayedTaskList[ uxQueue ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#endif
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -1939,6 +2148,7 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 BaseType_t xTaskIncrementTick( void )
 {
 TCB_t * pxTCB;
+List_t * pxDelayedList;
 TickType_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
 
@@ -1972,9 +2182,11 @@ BaseType_t xSwitchRequired = pdFALSE;
 			look any further down the list. */
 			if( xConstTickCount >= xNextTaskUnblockTime )
 			{
+				pxDelayedList = taskNEAREST_DELAYED_LIST();
+
 				for( ;; )
 				{
-					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+					if( listLIST_IS_EMPTY( pxDelayedList ) != pdFALSE )
 					{
 						/* The delayed list is empty.  Set xNextTaskUnblockTime
 						to the maximum possible value so it is extremely
@@ -1990,7 +2202,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 						item at the head of the delayed list.  This is the time
 						at which the task at the head of the delayed list must
 						be removed from the Blocked state. */
-						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedList );
 						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
 
 						if( xConstTickCount < xItemValue )
@@ -2044,6 +2256,22 @@ BaseType_t xSwitchRequired = pdFALSE;
 							}
 						}
 						#endif /* configUSE_PREEMPTION */
+
+						#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+						{
+							/* The tasks due at the same tick are in the same
+							bucket.  Only look for the next nearest bucket
+							once this one has no more task due now. */
+							if( ( listLIST_IS_EMPTY( pxDelayedList ) != pdFALSE ) || ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedList ) > xConstTickCount ) )
+							{
+								pxDelayedList = prvGetNearestDelayedList();
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_DELAYED_TASK_BUCKETS */
 					}
 				}
 			}
@@ -2213,6 +2441,14 @@ void vTaskSwitchContext( void )
 		xYieldPending = pdFALSE;
 		traceTASK_SWITCHED_OUT();
 
+		#if ( configUSE_CRITICAL_PROFILER == 1 )
+		{
+			/* A task that yields inside a critical section leaves it masked
+			only until the next task runs. */
+			vCriticalProfilerTaskSwitched();
+		}
+		#endif /* configUSE_CRITICAL_PROFILER */
+
 		#if ( configGENERATE_RUN_TIME_STATS == 1 )
 		{
 				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
@@ -2259,7 +2495,7 @@ void vTaskSwitchContext( void )
 }
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
+void vTaskPlaceOnEventList( EventList_t * const pxEventList, const TickType_t xTicksToWait )
 {
 TickType_t xTimeToWake;
 
@@ -2272,7 +2508,7 @@ TickType_t xTimeToWake;
 	This is placed in the list in priority order so the highest priority task
 	is the first to be woken by the event.  The queue that contains the event
 	list is locked, preventing simultaneous access from interrupts. */
-	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+	vEventListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
 
 	/* The task must be removed from from the ready list before it is added to
 	the blocked list as the same list item is used for both lists.  Exclusive
@@ -2386,7 +2622,7 @@ TickType_t xTimeToWake;
 
 #if configUSE_TIMERS == 1
 
-	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, const TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList, const TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
 	{
 	TickType_t xTimeToWake;
 
@@ -2401,8 +2637,17 @@ TickType_t xTimeToWake;
 		/* Place the event list item of the TCB in the appropriate event list.
 		In this case it is assume that this is the only task that is going to
 		be waiting on this event list, so the faster vListInsertEnd() function
-		can be used in place of vListInsert. */
-		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		can be used in place of vListInsert.  A bucketed event list is O(1)
+		anyway. */
+		#if( configUSE_EVENT_LIST_BUCKETS == 1 )
+		{
+			vEventListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
+		}
+		#else
+		{
+			vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		}
+		#endif
 
 		/* We must remove this task from the ready list before adding it to the
 		blocked list as the same list item is used for both lists.  This
@@ -2462,7 +2707,7 @@ TickType_t xTimeToWake;
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList )
 {
 TCB_t *pxUnblockedTCB;
 BaseType_t xReturn;
@@ -2471,8 +2716,9 @@ BaseType_t xReturn;
 	called from a critical section within an ISR. */
 
 	/* The event list is sorted in priority order, so the first in the list can
-	be removed as it is known to be the highest priority.  Remove the TCB from
-	the delayed list, and add it to the ready list.
+	be removed as it is known to be the highest priority (with bucketed event
+	lists, the first of the highest priority bucket).  Remove the TCB from the
+	delayed list, and add it to the ready list.
 
 	If an event is for a queue that is locked then this function will never
 	get called - the lock count on the queue will get modified instead.  This
@@ -2480,7 +2726,7 @@ BaseType_t xReturn;
 
 	This function assumes that a check has already been made to ensure that
 	pxEventList is not empty. */
-	pxUnblockedTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+	pxUnblockedTCB = ( TCB_t * ) listGET_OWNER_OF_HIGHEST_EVENT_ENTRY( pxEventList );
 	configASSERT( pxUnblockedTCB );
 	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
 
@@ -2575,32 +2821,98 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-	configASSERT( pxTimeOut );
-	pxTimeOut->xOverflowCount = xNumOfOverflows;
-	pxTimeOut->xTimeOnEntering = xTickCount;
-}
-/*-----------------------------------------------------------*/
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
 
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
-{
-BaseType_t xReturn;
+	BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+	{
+	TCB_t *pxUnblockedTCB;
+	BaseType_t xReturn;
 
-	configASSERT( pxTimeOut );
-	configASSERT( pxTicksToWait );
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION WITHIN AN ISR,
+		the event group that holds the event list not being locked by a task
+		so the event list is not accessed at the same time. */
 
-	taskENTER_CRITICAL();
-	{
-		/* Minor optimisation.  The tick count cannot change in this block. */
-		const TickType_t xConstTickCount = xTickCount;
+		/* Store the new item value in the event list. */
+		listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
 
-		#if ( INCLUDE_vTaskSuspend == 1 )
-			/* If INCLUDE_vTaskSuspend is set to 1 and the block time specified is
-			the maximum block time then the task should block indefinitely, and
-			therefore never time out. */
-			if( *pxTicksToWait == portMAX_DELAY )
-			{
+		pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( pxEventListItem );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			( void ) uxListRemove( &( pxUnblockedTCB->xGenericListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
+		}
+		else
+		{
+			/* The delayed and ready lists cannot be accessed, so hold this task
+			pending until the scheduler is resumed. */
+			vListInsertEnd( &( xPendingReadyList ), pxEventListItem );
+		}
+
+		if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+		{
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter of the ISR safe function. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		#if( configUSE_TICKLESS_IDLE != 0 )
+		{
+			/* See xTaskRemoveFromEventList(). */
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+	configASSERT( pxTimeOut );
+	pxTimeOut->xOverflowCount = xNumOfOverflows;
+	pxTimeOut->xTimeOnEntering = xTickCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxTimeOut );
+	configASSERT( pxTicksToWait );
+
+	taskENTER_CRITICAL();
+	{
+		/* Minor optimisation.  The tick count cannot change in this block. */
+		const TickType_t xConstTickCount = xTickCount;
+
+		#if ( configUSE_HR_TIMER == 1 )
+			/* The microsecond timeout of hr_timer.c expired, whatever the
+			block time. */
+			if( taskDELAY_ABORTED() )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+		#endif
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+			/* If INCLUDE_vTaskSuspend is set to 1 and the block time specified is
+			the maximum block time then the task should block indefinitely, and
+			therefore never time out. */
+			if( *pxTicksToWait == portMAX_DELAY )
+			{
 				xReturn = pdFALSE;
 			}
 			else /* We are not blocking indefinitely, perform the checks below. */
@@ -2638,6 +2950,136 @@ void vTaskMissedYield( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HR_TIMER == 1 )
+
+	BaseType_t xTaskAbortDelayFromISR( TaskHandle_t xTask, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	List_t *pxStateList;
+	BaseType_t xBlocked, xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED WITH INTERRUPTS MASKED, it is called by
+		the compare interrupt of hr_timer.c. */
+		configASSERT( pxTCB );
+		configASSERT( pxHigherPriorityTaskWoken );
+
+		if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+		{
+			/* A task that suspended the scheduler may be walking the event
+			list the task is on (a queue is locked, an event group is
+			updated), the task cannot be taken off it now.  The caller tries
+			again a little later. */
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			pxStateList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xGenericListItem ) );
+			xBlocked = ( taskIS_DELAYED_LIST( pxStateList ) ) ? pdTRUE : pdFALSE;
+
+			#if ( INCLUDE_vTaskSuspend == 1 )
+			{
+				/* A task blocked without a timeout is on the suspended list
+				too, but unlike a task suspended by vTaskSuspend() it is on an
+				event list or waits for a notification. */
+				if( pxStateList == &xSuspendedTaskList )
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						xBlocked = pdTRUE;
+					}
+					#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+						else if( pxTCB->eNotifyState == eWaitingNotification )
+						{
+							xBlocked = pdTRUE;
+						}
+					#endif
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* INCLUDE_vTaskSuspend */
+
+			if( xBlocked != pdFALSE )
+			{
+				/* The scheduler is not suspended so the pending ready list is
+				empty, an event list the task is on is the one of the object
+				it waits for. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+
+					/* Mark that a yield is pending in case the caller does not
+					use the "xHigherPriorityTaskWoken" value. */
+					xYieldPending = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if( configUSE_TICKLESS_IDLE != 0 )
+				{
+					/* See xTaskRemoveFromEventList(). */
+					prvResetNextTaskUnblockTime();
+				}
+				#endif
+			}
+			else
+			{
+				/* The task runs or is ready, it times out at its next
+				blocking call. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Until xTaskClearDelayAborted(), every timeout check of the task
+			times out and the task does not block. */
+			pxTCB->ucDelayAborted = ( uint8_t ) pdTRUE;
+			xReturn = pdPASS;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HR_TIMER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HR_TIMER == 1 )
+
+	BaseType_t xTaskClearDelayAborted( void )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = ( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE ) ? pdTRUE : pdFALSE;
+			pxCurrentTCB->ucDelayAborted = ( uint8_t ) pdFALSE;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HR_TIMER */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TRACE_FACILITY == 1 )
 
 	UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
@@ -2872,6 +3314,7 @@ UBaseType_t x;
 	{
 		pxTCB->uxBasePriority = uxPriority;
 		pxTCB->uxMutexesHeld = 0;
+		pxTCB->pvMutexWaitedOn = NULL;
 	}
 	#endif /* configUSE_MUTEXES */
 
@@ -2931,6 +3374,12 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if ( configUSE_HR_TIMER == 1 )
+	{
+		pxTCB->ucDelayAborted = ( uint8_t ) pdFALSE;
+	}
+	#endif
+
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 	{
 		/* Initialise this task's Newlib reent structure. */
@@ -3004,8 +3453,20 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < taskDELAYED_BUCKETS; uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskList1[ uxPriority ] ) );
+			vListInitialise( &( xDelayedTaskList2[ uxPriority ] ) );
+		}
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3022,8 +3483,17 @@ UBaseType_t uxPriority;
 
 	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
 	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+	{
+		pxDelayedTaskList = &( xDelayedTaskList1[ 0 ] );
+		pxOverflowDelayedTaskList = &( xDelayedTaskList2[ 0 ] );
+	}
+	#else
+	{
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -3068,20 +3538,37 @@ static void prvCheckTasksWaitingTermination( void )
 }
 /*-----------------------------------------------------------*/
 
-static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
+static void prvAddCurrentTaskToDelayedList( TickType_t xTimeToWake )
 {
+	#if( configUSE_DELAYED_TASK_BUCKETS == 1 )
+	{
+		/* A task due at the current tick is only removed from the Blocked
+		state by the next tick, as it would be from the head of a single
+		sorted list.  Give it that wake time so it is in the bucket that the
+		next tick looks at. */
+		if( xTimeToWake == xTickCount )
+		{
+			xTimeToWake++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
 	/* The list item will be inserted in wake time order. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
 
 	if( xTimeToWake < xTickCount )
 	{
 		/* Wake time has overflowed.  Place this item in the overflow list. */
-		vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		vListInsert( taskDELAYED_LIST_FOR( pxOverflowDelayedTaskList, xTimeToWake ), &( pxCurrentTCB->xGenericListItem ) );
 	}
 	else
 	{
 		/* The wake time has not overflowed, so the current block list is used. */
-		vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		vListInsert( taskDELAYED_LIST_FOR( pxDelayedTaskList, xTimeToWake ), &( pxCurrentTCB->xGenericListItem ) );
 
 		/* If the task entering the blocked state was placed at the head of the
 		list of blocked tasks then xNextTaskUnblockTime needs to be updated
@@ -3098,6 +3585,8 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 }
 /*-----------------------------------------------------------*/
 
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
 static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer )
 {
 TCB_t *pxNewTCB;
@@ -3158,19 +3647,10 @@ TCB_t *pxNewTCB;
 	}
 	#endif /* portSTACK_GROWTH */
 
-	if( pxNewTCB != NULL )
-	{
-		/* Avoid dependency on memset() if it is not required. */
-		#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
-		{
-			/* Just to help debugging. */
-			( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
-		}
-		#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
-	}
-
 	return pxNewTCB;
 }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -3323,22 +3803,49 @@ TCB_t *pxNewTCB;
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
-		#if( portUSING_MPU_WRAPPERS == 1 )
+		#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 1 )
 		{
-			/* Only free the stack if it was allocated dynamically in the first
-			place. */
-			if( pxTCB->xUsingStaticallyAllocatedStack == pdFALSE )
+			/* Only free what was allocated when the task was created. */
+			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
 			{
 				vPortFreeAligned( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			{
+				vPortFree( pxTCB );
+			}
+			else
+			{
+				/* Neither the stack nor the TCB were allocated dynamically. */
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			#if( portUSING_MPU_WRAPPERS == 1 )
+			{
+				/* Only free the stack if it was allocated dynamically in the
+				first place. */
+				if( pxTCB->xUsingStaticallyAllocatedStack == pdFALSE )
+				{
+					vPortFreeAligned( pxTCB->pxStack );
+				}
+			}
+			#else
+			{
+				vPortFreeAligned( pxTCB->pxStack );
+			}
+			#endif
+
+			vPortFree( pxTCB );
+		}
 		#else
 		{
-			vPortFreeAligned( pxTCB->pxStack );
+			/* Every task was created statically, there is nothing to free. */
+			( void ) pxTCB;
 		}
-		#endif
-
-		vPortFree( pxTCB );
+		#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 	}
 
 #endif /* INCLUDE_vTaskDelete */
@@ -3347,8 +3854,9 @@ TCB_t *pxNewTCB;
 static void prvResetNextTaskUnblockTime( void )
 {
 TCB_t *pxTCB;
+List_t * const pxDelayedList = taskNEAREST_DELAYED_LIST();
 
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+	if( listLIST_IS_EMPTY( pxDelayedList ) != pdFALSE )
 	{
 		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
 		the maximum possible value so it is	extremely unlikely that the
@@ -3362,12 +3870,62 @@ TCB_t *pxTCB;
 		the item at the head of the delayed list.  This is the time at
 		which the task at the head of the delayed list should be removed
 		from the Blocked state. */
-		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedList );
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) );
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_BUCKETS == 1 )
+
+	static List_t *prvGetNearestDelayedList( void )
+	{
+	const TickType_t xConstTickCount = xTickCount;
+	List_t *pxList, *pxNearest = &( pxDelayedTaskList[ xConstTickCount & taskDELAYED_BUCKET_MASK ] );
+	TickType_t xWakeTime, xNearestWakeTime = portMAX_DELAY;
+	UBaseType_t uxStep;
+
+		/* No task of the current delayed list is due before the tick count.
+		Looking at the buckets in wake time order from the one of the tick
+		count, the first bucket whose head is due within one turn holds the
+		nearest task and the search stops there.  Otherwise the nearest task
+		is the smallest of the bucket heads.  The search is bounded by the
+		number of buckets, not by the number of delayed tasks. */
+		for( uxStep = ( UBaseType_t ) 0U; uxStep < taskDELAYED_BUCKETS; uxStep++ )
+		{
+			pxList = &( pxDelayedTaskList[ ( xConstTickCount + ( TickType_t ) uxStep ) & taskDELAYED_BUCKET_MASK ] );
+
+			if( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+			{
+				xWakeTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxList );
+
+				if( xWakeTime == ( TickType_t ) ( xConstTickCount + ( TickType_t ) uxStep ) )
+				{
+					pxNearest = pxList;
+					break;
+				}
+				else if( xWakeTime <= xNearestWakeTime )
+				{
+					pxNearest = pxList;
+					xNearestWakeTime = xWakeTime;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return pxNearest;
+	}
+
+#endif /* configUSE_DELAYED_TASK_BUCKETS */
+/*-----------------------------------------------------------*/
+
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
 
 	TaskHandle_t xTaskGetCurrentTaskHandle( void )
@@ -3415,55 +3973,172 @@ TCB_t *pxTCB;
 
 #if ( configUSE_MUTEXES == 1 )
 
-	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+		/* Only reset the event list item value if the value is not being used
+		for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL. */
-		if( pxMutexHolder != NULL )
+		/* If the task being modified is in the ready state it will need to be
+		moved into a new list. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Change the priority before being moved into the new list. */
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			/* Just change the priority. */
+			pxTCB->uxPriority = uxNewPriority;
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder, void * const pvMutex )
+	{
+	TCB_t *pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxHops, uxHighestWaitingPriority;
+
+		/* Remember the mutex the calling task is about to block on, so a task
+		that later blocks on a mutex held by the calling task can pass its
+		priority on to the holder of this one. */
+		pxCurrentTCB->pvMutexWaitedOn = pvMutex;
+
+		/* Walk the chain of holders: the holder of the mutex, the holder of the
+		mutex that task is blocked on, and so on.  Each of them that has a
+		priority below the priority of the calling task temporarily inherits
+		it.  The walk stops at the first task that already has that priority,
+		the tasks further along the chain have it too.  A deadlock makes the
+		chain a loop, which the hop count bounds.
+
+		If the mutex was given back by an interrupt while the queue was locked
+		then the mutex holder might now be NULL. */
+		for( uxHops = uxCurrentNumberOfTasks; ( pxTCB != NULL ) && ( uxHops > ( UBaseType_t ) 0 ); uxHops-- )
 		{
-			/* If the holder of the mutex has a priority below the priority of
-			the task attempting to obtain the mutex then it will temporarily
-			inherit the priority of the task attempting to obtain the mutex. */
 			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
 			{
-				/* Adjust the mutex holder state to account for its new
-				priority.  Only reset the event list item value if the value is
-				not	being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				prvSetInheritedPriority( pxTCB, pxCurrentTCB->uxPriority );
+				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+
+				/* A holder blocked on another mutex is moved up the list of the
+				tasks waiting for it, then its holder is next. */
+				if( pxTCB->pvMutexWaitedOn != NULL )
 				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					pxTCB = ( TCB_t * ) pvQueueRequeueMutexWaiter( ( QueueHandle_t ) pxTCB->pvMutexWaitedOn, &( pxTCB->xEventListItem ), pxTCB->uxPriority, &uxHighestWaitingPriority );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					pxTCB = NULL;
 				}
+			}
+			else
+			{
+				pxTCB = NULL;
+			}
+		}
+	}
 
-				/* If the task being modified is in the ready state it will need
-				to be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
-				{
-					if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
 
-					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxTCB );
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask )
+	{
+	TCB_t *pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxHops, uxPriorityToUse;
+
+		/* The calling task is no longer waiting for the mutex. */
+		pxCurrentTCB->pvMutexWaitedOn = NULL;
+
+		/* The holder no longer needs the priority the calling task may have
+		given it: it now needs the highest of its base priority and the
+		priority of the tasks still waiting for the mutex.  The same goes for
+		the holder of the mutex that task is blocked on, and so on down the
+		chain, until a task keeps its priority.
+
+		A task that holds other mutexes keeps its priority, the tasks waiting
+		for them may be the reason for it.  It goes back to its base priority
+		when it gives the last of them back, as if no task had timed out. */
+		for( uxHops = uxCurrentNumberOfTasks; ( pxTCB != NULL ) && ( uxHops > ( UBaseType_t ) 0 ); uxHops-- )
+		{
+			/* A task cannot wait for a mutex it holds. */
+			configASSERT( pxTCB != pxCurrentTCB );
+
+			if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
+			{
+				uxPriorityToUse = uxHighestPriorityWaitingTask;
+			}
+			else
+			{
+				uxPriorityToUse = pxTCB->uxBasePriority;
+			}
+
+			if( ( pxTCB->uxPriority != uxPriorityToUse ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 1 ) )
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetInheritedPriority( pxTCB, uxPriorityToUse );
+
+				if( pxTCB->pvMutexWaitedOn != NULL )
+				{
+					pxTCB = ( TCB_t * ) pvQueueRequeueMutexWaiter( ( QueueHandle_t ) pxTCB->pvMutexWaitedOn, &( pxTCB->xEventListItem ), pxTCB->uxPriority, &uxHighestPriorityWaitingTask );
 				}
 				else
 				{
-					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					pxTCB = NULL;
 				}
+			}
+			else
+			{
+				pxTCB = NULL;
+			}
+		}
+	}
 
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+	{
+		/* If the mutex is taken before any task has been created then
+		pxCurrentTCB will be NULL. */
+		if( pxCurrentTCB != NULL )
+		{
+			/* A task with a base priority above the ceiling could be preempted
+			by nothing that takes the mutex: the ceiling is too low. */
+			configASSERT( pxCurrentTCB->uxBasePriority <= uxCeilingPriority );
+
+			/* The running task is in the ready list of its priority, and no
+			ready task has a higher priority, so raising it never needs a
+			context switch.  It may already be above the ceiling through
+			another mutex. */
+			if( pxCurrentTCB->uxPriority < uxCeilingPriority )
+			{
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				prvSetInheritedPriority( pxCurrentTCB, uxCeilingPriority );
 			}
 			else
 			{
@@ -3476,7 +4151,7 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_CEILING_MUTEXES */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_MUTEXES == 1 )
@@ -3623,7 +4298,7 @@ TCB_t *pxTCB;
 #endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName )
 	{
@@ -3646,10 +4321,10 @@ TCB_t *pxTCB;
 		return &( pcBuffer[ x ] );
 	}
 
-#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	void vTaskList( char * pcWriteBuffer )
 	{
@@ -3738,10 +4413,10 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	void vTaskGetRunTimeStats( char *pcWriteBuffer )
 	{
@@ -3862,7 +4537,7 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 TickType_t uxTaskResetEventItemValue( void )
@@ -3888,6 +4563,7 @@ TickType_t uxReturn;
 		if( pxCurrentTCB != NULL )
 		{
 			( pxCurrentTCB->uxMutexesHeld )++;
+			pxCurrentTCB->pvMutexWaitedOn = NULL;
 		}
 
 		return pxCurrentTCB;
@@ -3911,7 +4587,7 @@ TickType_t uxReturn;
 				/* Mark this task as waiting for a notification. */
 				pxCurrentTCB->eNotifyState = eWaitingNotification;
 
-				if( xTicksToWait > ( TickType_t ) 0 )
+				if( ( xTicksToWait > ( TickType_t ) 0 ) && ( taskDELAY_ABORTED() == pdFALSE ) )
 				{
 					/* The task is going to block.  First it must be removed
 					from the ready list. */
@@ -4029,7 +4705,7 @@ TickType_t uxReturn;
 				/* Mark this task as waiting for a notification. */
 				pxCurrentTCB->eNotifyState = eWaitingNotification;
 
-				if( xTicksToWait > ( TickType_t ) 0 )
+				if( ( xTicksToWait > ( TickType_t ) 0 ) && ( taskDELAY_ABORTED() == pdFALSE ) )
 				{
 					/* The task is going to block.  First it must be removed
 					from the	ready list. */
@@ -100,6 +100,18 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* Geometry of the timing wheel.  Each level has tmrWHEEL_SLOTS slots and
+	covers configTIMER_WHEEL_SLOT_BITS more bits of the expiry time than the
+	level below it, enough levels being used to cover the whole tick count. */
+	#define tmrWHEEL_SLOTS			( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+	#define tmrWHEEL_LEVELS			( ( UBaseType_t ) ( ( ( sizeof( TickType_t ) * 8U ) + configTIMER_WHEEL_SLOT_BITS - 1U ) / configTIMER_WHEEL_SLOT_BITS ) )
+	#define tmrWHEEL_SHIFT( uxLevel )	( ( uxLevel ) * configTIMER_WHEEL_SLOT_BITS )
+
+#endif /* configUSE_TIMER_WHEEL */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -112,6 +124,9 @@ typedef struct tmrTimerControl
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t 			ucStaticallyAllocated; /*<< Set to pdTRUE if the timer was created by xTimerCreateStatic(), so it is not freed if the timer is deleted. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -157,13 +172,31 @@ typedef struct tmrTimerQueueMessage
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* The timing wheel in which active timers are stored.  A timer is in the
+	lowest level whose span covers the time left to its expiry, in the slot
+	given by the digit of its expiry time at that level, so starting, stopping
+	or resetting a timer is O(1) whatever the number of active timers.  When
+	the wheel time reaches the start of a slot of a higher level its timers
+	are cascaded to the lower levels, a slot of level 0 holding the timers due
+	at a single tick.  Only the timer service task is allowed to access the
+	wheel. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ tmrWHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static UBaseType_t uxTimersInLevel[ tmrWHEEL_LEVELS ];
+	PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;	/*< The last tick processed. */
+
+#else
+
+	/* The list in which active timers are stored.  Timers are referenced in expire
+	time order, with the nearest expiry time at the front of the list.  Only the
+	timer service task is allowed to access these lists. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -199,21 +232,47 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow (into the
+ * timing wheel when configUSE_TIMER_WHEEL is 1).
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
-/*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
- */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMER_WHEEL == 1 )
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+	/*
+	 * Add a timer to, or remove a timer from, the slot of the timing wheel
+	 * matching its expiry time.
+	 */
+	static void prvWheelInsert( Timer_t * const pxTimer, const TickType_t xExpiryTime ) PRIVILEGED_FUNCTION;
+	static void prvWheelRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The wheel time has just reached xTime.  Cascade the higher level slots
+	 * starting at xTime, then expire the timers due at xTime.
+	 */
+	static void prvWheelProcessTick( const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the wheel time up to xTimeNow, processing every tick on the way at
+	 * which a slot has to be cascaded or expired.
+	 */
+	static void prvWheelAdvance( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * An active timer has reached its expire time.  Reload the timer if it is an
+	 * auto reload timer, then call its callback.
+	 */
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -235,6 +294,12 @@ static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIV
  */
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called after a timer has been created, statically or dynamically, to set up
+ * its members.
+ */
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -249,7 +314,29 @@ BaseType_t xReturn = pdFAIL;
 
 	if( xTimerQueue != NULL )
 	{
-		#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+		StaticTask_t *pxTimerTaskTCBBuffer = NULL;
+		StackType_t *pxTimerTaskStackBuffer = NULL;
+		uint16_t usTimerTaskStackSize = ( uint16_t ) configTIMER_TASK_STACK_DEPTH;
+		TaskHandle_t xTimerTask;
+
+			/* The memory of the timer task is provided by the application. */
+			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &usTimerTaskStackSize );
+			xTimerTask = xTaskCreateStatic( prvTimerTask, "Tmr Svc", usTimerTaskStackSize, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, pxTimerTaskStackBuffer, pxTimerTaskTCBBuffer );
+
+			#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+			{
+				xTimerTaskHandle = xTimerTask;
+			}
+			#endif
+
+			if( xTimerTask != NULL )
+			{
+				xReturn = pdPASS;
+			}
+		}
+		#elif ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 		{
 			/* Create the timer task, storing its handle in xTimerTaskHandle so
 			it can be returned by the xTimerGetTimerDaemonTaskHandle() function. */
@@ -272,44 +359,100 @@ BaseType_t xReturn = pdFAIL;
 }
 /*-----------------------------------------------------------*/
 
-TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-Timer_t *pxNewTimer;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* Allocate the timer structure. */
-	if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+	TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = NULL;
+	Timer_t *pxNewTimer;
+
+		/* Allocate the timer structure. */
+		if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+		{
+			pxNewTimer = NULL;
+		}
+		else
+		{
+			pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+			if( pxNewTimer != NULL )
+			{
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* The timer can be freed if it is deleted. */
+					pxNewTimer->ucStaticallyAllocated = pdFALSE;
+				}
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+				prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
+			}
+			else
+			{
+				traceTIMER_CREATE_FAILED();
+			}
+		}
+
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
-	else
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
-		if( pxNewTimer != NULL )
-		{
-			/* Ensure the infrastructure used by the timer service task has been
-			created/initialised. */
-			prvCheckForValidListAndQueue();
+	Timer_t *pxNewTimer;
+
+		configASSERT( pxTimerBuffer != NULL );
 
-			/* Initialise the timer structure members using the function parameters. */
-			pxNewTimer->pcTimerName = pcTimerName;
-			pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
-			pxNewTimer->uxAutoReload = uxAutoReload;
-			pxNewTimer->pvTimerID = pvTimerID;
-			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
-			vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+		/* The dummy structure in timers.h must be the size of the real timer
+		structure. */
+		configASSERT( sizeof( StaticTimer_t ) == sizeof( Timer_t ) );
 
-			traceTIMER_CREATE( pxNewTimer );
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+		if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+		{
+			pxNewTimer = NULL;
 		}
 		else
 		{
-			traceTIMER_CREATE_FAILED();
+			pxNewTimer = ( Timer_t * ) pxTimerBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* The timer must not be freed if it is deleted. */
+				pxNewTimer->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
 		}
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
 
-	/* 0 is not a valid value for xTimerPeriodInTicks. */
-	configASSERT( ( xTimerPeriodInTicks > 0 ) );
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	/* Ensure the infrastructure used by the timer service task has been
+	created/initialised. */
+	prvCheckForValidListAndQueue();
 
-	return ( TimerHandle_t ) pxNewTimer;
+	/* Initialise the timer structure members using the function parameters. */
+	pxNewTimer->pcTimerName = pcTimerName;
+	pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+	pxNewTimer->uxAutoReload = uxAutoReload;
+	pxNewTimer->pvTimerID = pvTimerID;
+	pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+	vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+
+	traceTIMER_CREATE( pxNewTimer );
 }
 /*-----------------------------------------------------------*/
 
@@ -378,6 +521,8 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -416,6 +561,8 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
@@ -442,6 +589,8 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -590,6 +739,8 @@ BaseType_t xProcessTimerNow = pdFALSE;
 
 	return xProcessTimerNow;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
@@ -634,7 +785,15 @@ TickType_t xTimeNow;
 			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				#if ( configUSE_TIMER_WHEEL == 1 )
+				{
+					prvWheelRemove( pxTimer );
+				}
+				#else
+				{
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				#endif
 			}
 			else
 			{
@@ -705,8 +864,23 @@ TickType_t xTimeNow;
 
 				case tmrCOMMAND_DELETE :
 					/* The timer has already been removed from the active list,
-					just free up the memory. */
-					vPortFree( pxTimer );
+					just free up the memory if it was allocated dynamically. */
+					#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+					{
+						if( pxTimer->ucStaticallyAllocated == pdFALSE )
+						{
+							vPortFree( pxTimer );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+					{
+						vPortFree( pxTimer );
+					}
+					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 					break;
 
 				default	:
@@ -718,6 +892,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -775,6 +951,244 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvWheelInsert( Timer_t * const pxTimer, const TickType_t xExpiryTime )
+{
+const TickType_t xTicksToExpiry = xExpiryTime - xWheelTime;
+UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+
+	/* Use the lowest level whose span covers the time left to the expiry.
+	The timer is then found in its slot when the wheel time reaches the start
+	of that slot, at which point it is cascaded to a lower level. */
+	while( ( uxLevel < ( tmrWHEEL_LEVELS - 1U ) ) && ( ( xTicksToExpiry >> tmrWHEEL_SHIFT( uxLevel + 1U ) ) != ( TickType_t ) 0U ) )
+	{
+		uxLevel++;
+	}
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+	vListInsertEnd( &( xTimerWheel[ uxLevel ][ ( xExpiryTime >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK ] ), &( pxTimer->xTimerListItem ) );
+	( uxTimersInLevel[ uxLevel ] )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelRemove( Timer_t * const pxTimer )
+{
+const List_t * const pxSlot = ( const List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+const UBaseType_t uxLevel = ( UBaseType_t ) ( pxSlot - &( xTimerWheel[ 0 ][ 0 ] ) ) / tmrWHEEL_SLOTS;
+
+	( uxTimersInLevel[ uxLevel ] )--;
+	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelProcessTick( const TickType_t xTime )
+{
+UBaseType_t uxLevel;
+List_t *pxSlot;
+Timer_t *pxTimer;
+
+	/* Cascade the slot of each level starting at xTime.  A level only has a
+	slot starting at xTime if all the lower digits of xTime are zero.  The
+	timers always move down as less than the span of their level is left. */
+	for( uxLevel = ( UBaseType_t ) 1U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+	{
+		if( ( xTime & ( ( ( TickType_t ) 1U << tmrWHEEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+		{
+			break;
+		}
+
+		pxSlot = &( xTimerWheel[ uxLevel ][ ( xTime >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK ] );
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+			prvWheelRemove( pxTimer );
+			prvWheelInsert( pxTimer, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+		}
+	}
+
+	/* Every timer in the level 0 slot of xTime expires now. */
+	pxSlot = &( xTimerWheel[ 0 ][ xTime & tmrWHEEL_SLOT_MASK ] );
+	while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+	{
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+		prvWheelRemove( pxTimer );
+		traceTIMER_EXPIRED( pxTimer );
+
+		/* An auto reload timer is re-inserted relative to the time it should
+		have expired, not to the tick count.  The period is at least one tick
+		so it never goes back in the slot being emptied, and if the daemon is
+		late the wheel catches up before prvWheelAdvance() returns. */
+		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		{
+			prvWheelInsert( pxTimer, xTime + pxTimer->xTimerPeriodInTicks );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Call the timer callback. */
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelAdvance( const TickType_t xTimeNow )
+{
+UBaseType_t uxLevel;
+TickType_t xNextTime;
+
+	while( xWheelTime != xTimeNow )
+	{
+		/* Nothing can happen before the start of the next slot of the
+		lowest level that holds timers, so the wheel time jumps straight
+		there.  The tick count wrapping needs no special case as only the
+		differences to the wheel time are compared. */
+		for( uxLevel = ( UBaseType_t ) 0U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+		{
+			if( uxTimersInLevel[ uxLevel ] != ( UBaseType_t ) 0U )
+			{
+				break;
+			}
+		}
+
+		if( uxLevel == tmrWHEEL_LEVELS )
+		{
+			xWheelTime = xTimeNow;
+		}
+		else
+		{
+			xNextTime = ( TickType_t ) ( ( ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) + ( TickType_t ) 1U ) << tmrWHEEL_SHIFT( uxLevel ) );
+
+			if( ( TickType_t ) ( xNextTime - xWheelTime ) > ( TickType_t ) ( xTimeNow - xWheelTime ) )
+			{
+				xWheelTime = xTimeNow;
+			}
+			else
+			{
+				xWheelTime = xNextTime;
+				prvWheelProcessTick( xNextTime );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+TickType_t xTimeNow;
+
+	vTaskSuspendAll();
+	{
+		xTimeNow = xTaskGetTickCount();
+
+		/* The next expire time is the next tick at which a slot has to be
+		cascaded or expired.  Compare the distances from the wheel time as the
+		tick count may have overflowed in between. */
+		if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xTimeNow - xWheelTime ) >= ( TickType_t ) ( xNextExpireTime - xWheelTime ) ) )
+		{
+			( void ) xTaskResumeAll();
+			prvWheelAdvance( xTimeNow );
+		}
+		else
+		{
+			vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				/* Yield to wait for either a command to arrive, or the block
+				time to expire. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+{
+TickType_t xNextExpireTime = ( TickType_t ) 0U, xTicks, xMinTicks = portMAX_DELAY;
+UBaseType_t uxLevel, uxSlot, uxStep;
+
+	/* Find, in every level holding timers, the first non empty slot after
+	the current one.  The nearest slot start is the next tick at which the
+	daemon has work to do.  A level 0 slot start is a true expiry time, a
+	higher level one only a cascade.  At most tmrWHEEL_SLOTS lists are
+	looked at per level, whatever the number of active timers. */
+	*pxListWasEmpty = pdTRUE;
+
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+	{
+		if( uxTimersInLevel[ uxLevel ] != ( UBaseType_t ) 0U )
+		{
+			uxSlot = ( UBaseType_t ) ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) );
+
+			for( uxStep = ( UBaseType_t ) 1U; uxStep <= tmrWHEEL_SLOTS; uxStep++ )
+			{
+				if( listLIST_IS_EMPTY( &( xTimerWheel[ uxLevel ][ ( uxSlot + uxStep ) & tmrWHEEL_SLOT_MASK ] ) ) == pdFALSE )
+				{
+					break;
+				}
+			}
+
+			xTicks = ( TickType_t ) ( ( ( TickType_t ) ( ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) + ( TickType_t ) uxStep ) << tmrWHEEL_SHIFT( uxLevel ) ) - xWheelTime );
+
+			if( ( *pxListWasEmpty != pdFALSE ) || ( xTicks < xMinTicks ) )
+			{
+				xMinTicks = xTicks;
+				xNextExpireTime = xWheelTime + xTicks;
+				*pxListWasEmpty = pdFALSE;
+			}
+		}
+	}
+
+	return xNextExpireTime;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+TickType_t xTimeNow;
+
+	/* Bring the wheel up to date before a command is processed, so the
+	timers are always inserted relative to the current time. */
+	xTimeNow = xTaskGetTickCount();
+	prvWheelAdvance( xTimeNow );
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTimeNow;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+
+	/* Has the expiry time elapsed between the command to start/reset the
+	timer being issued and the command being processed?  The unsigned
+	difference is right even if the tick count overflowed in between. */
+	if( ( xTimeNow - xCommandTime ) >= pxTimer->xTimerPeriodInTicks )
+	{
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		prvWheelInsert( pxTimer, xNextExpiryTime );
+	}
+
+	return xProcessTimerNow;
+}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -786,11 +1200,40 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
-			xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = ( UBaseType_t ) 0U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxSlot = ( UBaseType_t ) 0U; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+				}
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+			PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;
+			PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+
+				/* The timer queue is only ever created once, so its memory is
+				kept here rather than provided by the application. */
+				xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ), ucStaticTimerQueueStorage, &xStaticTimerQueue );
+			}
+			#else
+			{
+				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 			configASSERT( xTimerQueue );
 
 			#if ( configQUEUE_REGISTRY_SIZE > 0 )
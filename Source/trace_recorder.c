@@ -0,0 +1,354 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not
+configured to include the trace recorder. */
+#if( configUSE_TRACE_RECORDER == 1 )
+
+/* The ring buffer.  uxNextRecord is where the next record goes, the oldest
+record is there too once the buffer has wrapped.  Everything is accessed
+with interrupts masked, events are recorded from tasks and interrupts. */
+PRIVILEGED_DATA static TraceRecorderRecord_t xRecords[ configTRACE_RECORDER_RECORDS ];
+PRIVILEGED_DATA static UBaseType_t uxNextRecord = 0;
+PRIVILEGED_DATA static uint32_t ulWritten = 0UL;
+PRIVILEGED_DATA static BaseType_t xRecording = pdTRUE;
+
+/* The object table, the object of ID n is in entry n - 1. */
+PRIVILEGED_DATA static TraceRecorderObject_t xObjects[ configTRACE_RECORDER_OBJECTS ];
+PRIVILEGED_DATA static UBaseType_t uxObjects = 0;
+PRIVILEGED_DATA static UBaseType_t uxLostObjects = 0;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy pcName into the name of an entry of the object table, an empty name
+ * if pcName is NULL.
+ */
+static void prvCopyName( TraceRecorderObject_t *pxObject, const char *pcName );
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint8_t ucEvent, UBaseType_t uxObject, UBaseType_t uxParam )
+{
+UBaseType_t uxSavedInterruptStatus;
+TraceRecorderRecord_t *pxRecord;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( xRecording != pdFALSE )
+		{
+			pxRecord = &( xRecords[ uxNextRecord ] );
+			pxRecord->ulTimeStamp = configTRACE_RECORDER_GET_TIME();
+			pxRecord->ucEvent = ucEvent;
+			pxRecord->ucObject = ( uint8_t ) uxObject;
+			pxRecord->usParam = ( uint16_t ) uxParam;
+
+			uxNextRecord++;
+			if( uxNextRecord >= ( UBaseType_t ) configTRACE_RECORDER_RECORDS )
+			{
+				uxNextRecord = 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			ulWritten++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTraceRecorderAddObject( uint8_t ucType, const char *pcName )
+{
+UBaseType_t uxSavedInterruptStatus, uxObject = 0;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( uxObjects < ( UBaseType_t ) configTRACE_RECORDER_OBJECTS )
+		{
+			xObjects[ uxObjects ].ucType = ucType;
+			prvCopyName( &( xObjects[ uxObjects ] ), pcName );
+			uxObjects++;
+			uxObject = uxObjects;
+		}
+		else
+		{
+			uxLostObjects++;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxObject;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderSetObjectName( UBaseType_t uxObject, const char *pcName )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* ID 0, an object that did not fit in the table, is ignored. */
+		if( ( uxObject > 0 ) && ( uxObject <= uxObjects ) )
+		{
+			prvCopyName( &( xObjects[ uxObject - 1 ] ), pcName );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	taskENTER_CRITICAL();
+	{
+		xRecording = pdTRUE;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	taskENTER_CRITICAL();
+	{
+		xRecording = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+	taskENTER_CRITICAL();
+	{
+		uxNextRecord = 0;
+		ulWritten = 0UL;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderGetInfo( TraceRecorderInfo_t *pxInfo )
+{
+	configASSERT( pxInfo );
+
+	taskENTER_CRITICAL();
+	{
+		if( ulWritten < ( uint32_t ) configTRACE_RECORDER_RECORDS )
+		{
+			pxInfo->uxRecords = ( UBaseType_t ) ulWritten;
+		}
+		else
+		{
+			pxInfo->uxRecords = ( UBaseType_t ) configTRACE_RECORDER_RECORDS;
+		}
+
+		pxInfo->ulWritten = ulWritten;
+		pxInfo->uxObjects = uxObjects;
+		pxInfo->uxLostObjects = uxLostObjects;
+		pxInfo->xRecording = xRecording;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceRecorderGetRecord( UBaseType_t uxIndex, TraceRecorderRecord_t *pxRecord )
+{
+BaseType_t xReturn = pdFALSE;
+
+	configASSERT( pxRecord );
+
+	taskENTER_CRITICAL();
+	{
+		if( ulWritten < ( uint32_t ) configTRACE_RECORDER_RECORDS )
+		{
+			/* The buffer has not wrapped, the oldest record is the first
+			one. */
+			if( ( uint32_t ) uxIndex < ulWritten )
+			{
+				*pxRecord = xRecords[ uxIndex ];
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( uxIndex < ( UBaseType_t ) configTRACE_RECORDER_RECORDS )
+		{
+			/* The buffer has wrapped, the oldest record is the one that
+			will be overwritten next. */
+			uxIndex += uxNextRecord;
+
+			if( uxIndex >= ( UBaseType_t ) configTRACE_RECORDER_RECORDS )
+			{
+				uxIndex -= ( UBaseType_t ) configTRACE_RECORDER_RECORDS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			*pxRecord = xRecords[ uxIndex ];
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceRecorderGetObject( UBaseType_t uxObject, TraceRecorderObject_t *pxObject )
+{
+BaseType_t xReturn = pdFALSE;
+
+	configASSERT( pxObject );
+
+	taskENTER_CRITICAL();
+	{
+		if( ( uxObject > 0 ) && ( uxObject <= uxObjects ) )
+		{
+			*pxObject = xObjects[ uxObject - 1 ];
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyName( TraceRecorderObject_t *pxObject, const char *pcName )
+{
+UBaseType_t x;
+
+	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configTRACE_RECORDER_NAME_LEN; x++ )
+	{
+		if( pcName != NULL )
+		{
+			pxObject->cName[ x ] = pcName[ x ];
+
+			/* Past the end of the string the rest of the array is
+			cleared. */
+			if( pcName[ x ] == 0x00 )
+			{
+				pcName = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			pxObject->cName[ x ] = 0x00;
+		}
+	}
+}
+
+#endif /* configUSE_TRACE_RECORDER */
+
@@ -8,74 +8,44 @@
  *                                          on the target
  * Serge Hould      Dec 2016        v1.1.0  Add header
  *                                          Add with function without flow control
- *                                          Add an ISR 
+ *                                          Add an ISR
  * Samson Kaller    Feb 25 2019     v2.0.0  Lab4 Vending Machine
+ * Samson Kaller    Oct 19 2026     v3.0.0  Now a thin wrapper around the instance
+ *                                          based driver in uart.c (COMM2_PORT)
  *****************************************************************************/
 
 
+#include "../../Source/include/FreeRTOS.h"
+#include "include/uart.h"
 #include "include/COMM2.h"
 
-#include <xc.h>
-
-// I/O definitions for the Explorer16 using hardware flow control
-#define CTS    	_RF12              // Cleart To Send, input, HW handshake
-#define RTS     _RF13               // Request To Send, output, HW handshake
-#define TRTS    TRISFbits.TRISF13   // tris control for RTS pin
-
-/* U2BRG (BRATE)
-U2BRG = (Fosc / 8 / baudrate) -1 ; for BREGH=1
-In our case this translates to the following expression:
- */
-
-/* U2BRG (BRATE)
-U2BRG = (Fosc / 32 / baudrate) -1 ; for BREGH=0
-In our case this translates to the following expression:
-
-*/
-// timing and baud rate calculations
-//#define BRATE     33        // 115200 baud (BREGH=1) for PIC24  at 32MHz  BRATE=33 
-#define BRATE   	417        // 9600 baud (BREGH=1) for PIC24  at 32MHz  BRATE=417 
-#define U_ENABLE 	0x8008      // enable the UART peripheral (BREGH=1)
-#define U_TX    	0x0400      // enable transmission
-   
+// Settings of the Explorer16 RS232 port (UART2). CTS/RTS are handled by the
+// UART hardware (UEN = 10) instead of polling _RF12 in putc2().
+static const UartConfig_t comm2Config = { COMM2_BAUD, UART_FLOW_RTS_CTS };
+
 /**********************************
  Initialize the UART2 serial port
 **********************************/
-
-// initialize the UART2 serial port. interrupt driven UART microcontrollers from assembly language to c using the pic24 family.pdf p389
 void initUart2( void)
 {
-    /* Calcul de U2BRG (BRATE)*/
-    //U2BRG = (Fcy/ 4 / baudrate) - 1; // for BREGH=0
-    U2BRG  = BRATE;     // 16M/4/9600
-    U2MODE = U_ENABLE;  // enable the UART peripheral (BREGH=1)
-    U2STA = U_TX;       // enable transmission
-    U2STA = 0x8400;     // enable transmission
+    iUartOpen(COMM2_PORT, &comm2Config);
 } // initUart
 
 /**********************************
- initialize the UART2 serial port 
- with interrupt.  
- See ISR at the end of this document
+ initialize the UART2 serial port
+ with interrupt.
+ The ISRs are in uart.c
  **********************************/
 void initUart2_wInt( void)
 {
-    /* Calcul de U2BRG (BRATE)*/
-    //U2BRG = (Fcy/ 4 / baudrate) -1 ; for BREGH=0
-   U2BRG    = BRATE ;    // 16M/4/9600 = 417
-   U2MODE    = U_ENABLE ;     // enable the UART peripheral (BREGH=1)
-   U2STA    = U_TX;      // enable transmission
-   _U2RXIF=0;  
-   _U2RXIP=1;  // Interrutp priority 1
-   _U2RXIE=1;  // if interrupt driven RX only
-
+    iUartOpen(COMM2_PORT, &comm2Config);
 } // initUart
 
 /****************************************
-Send a singe character to the UART2 
+Send a singe character to the UART2
 serial port.
 
-input: 
+input:
 	Parameters:
 		char c 	character to be sent
 output:
@@ -84,30 +54,28 @@ output:
 *****************************************/
 int putc2(char c)
 {
-   while ( CTS);              // wait for !CTS, clear to send
-   while ( U2STAbits.UTXBF);   // wait while Tx buffer full
-   U2TXREG = c;
-   return c;
-} 
+    vUartPutc(COMM2_PORT, c);
+    return c;
+}
 /****************************************
-Same as putc2() but  w/o hardware control
+Same as putc2(). Flow control is now a
+setting of the port (see comm2Config)
 *****************************************/
 int putc2_noHard(char c)
 {
-   while ( U2STAbits.UTXBF);   // wait while Tx buffer is still full
-   U2TXREG = c;
-   return c;
+    vUartPutc(COMM2_PORT, c);
+    return c;
 }
 /****************************************
 *****************************************/
 // wait for a new character to arrive to the UART2 serial port
 char getc2( void)
 {
-    RTS = 0;            // assert Request To Send !RTS
-   while ( !U2STAbits.URXDA);   // wait for a new character to arrive
-   return U2RXREG;      // read the character from the receive buffer
-   RTS = 1;
-}// 
+    char c;
+
+    iUartGetc(COMM2_PORT, &c, portMAX_DELAY);
+    return c;
+}//
 
 
    /*******************************************************************************
@@ -126,32 +94,20 @@ char getc2( void)
    *******************************************************************************/
    void puts2( char *str )
    {
-      unsigned char c;
-
-      while( (c = *str++) )
-         putc2(c);
+      vUartPuts(COMM2_PORT, str);
    }
 
-   
+
    // to erase because putI8 supercedes it
 void outUint8(unsigned char u8_x) {
-  unsigned char u8_c;
-   putc2('0');
-   putc2('X');
-  u8_c = (u8_x>>4)& 0xf;
-  if (u8_c > 9) putc2('A'+u8_c-10);
-  else putc2('0'+u8_c);
-  //LSDigit
-  u8_c= u8_x & 0xf;
-  if (u8_c > 9) putc2('A'+u8_c-10);
-  else putc2('0'+u8_c);
+  putI8(u8_x);
 }
 /****************************************
 Precondition:
-    initUart2() must be called prior to calling 
+    initUart2() must be called prior to calling
 	this routine.
 
-	Overview: send an 8 bit integer value to 	
+	Overview: send an 8 bit integer value to
 	the UART2 serial port
 	Example: putI8(55);
 *****************************************/
@@ -167,17 +123,3 @@ void putI8(unsigned char u8_x) {
   if (u8_c > 9) putc2('A'+u8_c-10);
   else putc2('0'+u8_c);
 }
-/****************************************
-	ISR for Uart 2 rx
-*****************************************/
-/*
- void _ISR_NO_PSV _U2RXInterrupt(void)
-{
-            _U2RXIF=0;
-
-            static char i=0;
-            static int recBuffer[50];
-
-            recBuffer[i++] = U2RXREG; // received data
-
-}*/
\ No newline at end of file
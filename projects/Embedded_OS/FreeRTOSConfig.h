@@ -6,6 +6,22 @@
  *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Samson Kaller    Feb 04 2019     v1.0.0  Lab 2 Scheduler & Idle Hook
+ *   "      "       Oct 19 2026     v1.0.1  configMAX_PRIORITIES 5, TIMER_TASK_PRIORITY (4)
+ *                                          was silently lowered to 3 by the kernel
+ *   "      "       Oct 19 2026     v1.0.2  configUSE_PORT_OPTIMISED_TASK_SELECTION
+ *   "      "       Oct 19 2026     v1.0.3  configUSE_ZERO_COPY_QUEUES
+ *   "      "       Oct 19 2026     v1.0.4  Software timers for KERNEL_BENCH, configUSE_TIMER_WHEEL
+ *   "      "       Oct 19 2026     v1.0.5  configUSE_DELAYED_TASK_BUCKETS
+ *   "      "       Oct 19 2026     v1.0.6  configUSE_EVENT_LIST_BUCKETS
+ *   "      "       Oct 19 2026     v1.0.7  configUSE_EVENT_GROUP_BIT_INDEX, configUSE_EVENT_GROUP_DIRECT_ISR
+ *   "      "       Oct 19 2026     v1.0.8  Static allocation only, the heap is left out unless KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.0.9  Heap profiler for HEAP_PROFILER
+ *   "      "       Oct 19 2026     v1.0.10 Critical section profiler for CRIT_PROFILER
+ *   "      "       Oct 19 2026     v1.0.11 Trace recorder for TRACE_RECORDER
+ *   "      "       Oct 19 2026     v1.0.12 configUSE_CEILING_MUTEXES, context switch count for KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.0.13 configUSE_OBJECT_NOTIFY_BITS, queue sets for KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.0.14 configUSE_QUEUE_BATCH
+ *   "      "       Oct 19 2026     v1.0.15 configUSE_HR_TIMER
  *****************************************************************************/
 
 #ifndef FREERTOS_CONFIG_H
@@ -30,14 +46,99 @@
 #define configUSE_TICK_HOOK				0
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configCPU_CLOCK_HZ				( ( unsigned long ) 16000000 )  /* fcy (Fosc / 2) */
-#define configMAX_PRIORITIES			( 4 )
+#define configMAX_PRIORITIES			( 5 )
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1   /* FF1L on the ready priority bit map, 0 for the generic search (compare with KERNEL_BENCH) */
 #define configMINIMAL_STACK_SIZE		( 115 )
 #define configTOTAL_HEAP_SIZE			( ( size_t ) 5120 )
 #define configMAX_TASK_NAME_LEN			( 4 )
+#if defined(TRACE_RECORDER) && TRACE_RECORDER
+#define configUSE_TRACE_FACILITY		1   /* object IDs of the trace recorder */
+#else
 #define configUSE_TRACE_FACILITY		0
+#endif
 #define configUSE_16_BIT_TICKS			1
 #define configIDLE_SHOULD_YIELD			1
 #define configCHECK_FOR_STACK_OVERFLOW  2
+#define configUSE_ZERO_COPY_QUEUES      1
+
+/* Every kernel object of the vending machine is created statically, so all of
+the RAM is known at link time and heap_1.c compiles to nothing. The benchmark
+creates and deletes objects at run time and keeps the heap. */
+#define configSUPPORT_STATIC_ALLOCATION 1
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#else
+#define configSUPPORT_DYNAMIC_ALLOCATION 0
+#endif
+
+/* Software timers, only used by the benchmark: the timer service task does not
+fit in the heap next to the vending machine tasks. KERNEL_BENCH has to be given
+on the compiler command line for this to see it. */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configUSE_TIMERS                1
+#define configTIMER_TASK_PRIORITY       ( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH        5
+#define configTIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#define INCLUDE_xTimerPendFunctionCall  1       /* deferred xEventGroupSetBitsFromISR() */
+#endif
+#define configUSE_TIMER_WHEEL           1       /* hierarchical timing wheel, 0 for the sorted timer lists (compare with KERNEL_BENCH) */
+#define configUSE_DELAYED_TASK_BUCKETS  0       /* 1 for bucketed delayed task lists, only worth it with many delayed tasks (compare with KERNEL_BENCH) */
+#define configUSE_EVENT_LIST_BUCKETS    0       /* 1 for O(1) queue/semaphore waiters, costs 2 lists of 5 buckets per queue */
+#define configUSE_EVENT_GROUP_BIT_INDEX 1       /* only test the tasks waiting for the bits being set (compare with KERNEL_BENCH) */
+#define configUSE_EVENT_GROUP_DIRECT_ISR 1      /* xEventGroupSetBitsFromISR() without the timer task (compare with KERNEL_BENCH) */
+#define configUSE_CEILING_MUTEXES       1       /* xSemaphoreCreateMutexWithCeiling(), the holder runs at the ceiling (ceiling_vend_switches of KERNEL_BENCH) */
+#define configUSE_OBJECT_NOTIFY_BITS    1       /* vQueueSetNotifyBits(): wait on several objects with xTaskNotifyWait() instead of a queue set */
+#define configUSE_QUEUE_BATCH           1       /* uxQueueSendMultiple() / uxQueueReceiveMultiple(): many items per critical section */
+#define configUSE_HR_TIMER              1       /* vTaskDelayUs(), microsecond timeouts and one-shot callbacks on a compare timer */
+
+/* Queue sets, only used by the benchmark to compare with the notification
+bits. */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configUSE_QUEUE_SETS            1
+#endif
+
+/* Context switch count of the benchmark (bench.c), not with the trace recorder
+that has its own traceTASK_SWITCHED_IN(). */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH && !(defined(TRACE_RECORDER) && TRACE_RECORDER)
+void vBenchTaskSwitchedIn( void *pvTask );
+#define traceTASK_SWITCHED_IN()         vBenchTaskSwitchedIn( pxCurrentTCB )
+#endif
+
+/* Heap profiler (heap_profiler.c), HEAP_PROFILER has to be set to 1 on the
+compiler command line with KERNEL_BENCH, the only build with a heap. Times in
+counts of the benchmark timer. */
+#if defined(HEAP_PROFILER) && HEAP_PROFILER
+#define configUSE_HEAP_PROFILER         1
+#define configHEAP_PROFILER_SITES       16
+#define configHEAP_PROFILER_BLOCKS      32
+uint32_t ulReadBenchTimer( void );
+#define configHEAP_PROFILER_GET_TIME()  ulReadBenchTimer()
+#endif
+
+/* Critical section profiler (critical_profiler.c), CRIT_PROFILER has to be set
+to 1 on the compiler command line, with or without KERNEL_BENCH. Times in
+counts of the benchmark timer, which main() then starts. The callers are the
+return addresses given by __builtin_return_address(), 16 bit wide: look them
+up in the map file. */
+#if defined(CRIT_PROFILER) && CRIT_PROFILER
+#define configUSE_CRITICAL_PROFILER     1
+#define configCRITICAL_PROFILER_SITES   8
+uint32_t ulReadBenchTimer( void );
+#define configCRITICAL_PROFILER_GET_TIME()  ulReadBenchTimer()
+#endif
+
+/* Trace recorder (trace_recorder.c), TRACE_RECORDER has to be set to 1 on the
+compiler command line, with or without KERNEL_BENCH. Time stamps in counts of
+the benchmark timer, which main() then starts. 128 records take 1KB, the
+queue registry names the queues in the dump. */
+#if defined(TRACE_RECORDER) && TRACE_RECORDER
+#define configUSE_TRACE_RECORDER        1
+#define configTRACE_RECORDER_RECORDS    128
+#define configTRACE_RECORDER_OBJECTS    16
+#define configQUEUE_REGISTRY_SIZE       4
+uint32_t ulReadBenchTimer( void );
+#define configTRACE_RECORDER_GET_TIME() ulReadBenchTimer()
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           1
@@ -53,6 +154,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend			1
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetSchedulerState	1
 
 #define configKERNEL_INTERRUPT_PRIORITY	0x01
 
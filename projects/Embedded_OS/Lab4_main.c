@@ -17,6 +17,13 @@
  *   "      "       Apr 09 2019     v2.0.0  -   Lab 5: WatchDog
  *   "      "       Apr 16 2019     v2.1.0  -   Implemented saving in EEPROM NVM
  *   "      "       May 14 2019     v2.1.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v2.2.0  -   KERNEL_BENCH build starts the kernel benchmark
+ *                                              instead of the vending machine tasks
+ *   "      "       Oct 19 2026     v2.3.0  -   vTaskHog created statically, memory of the
+ *                                              idle and timer tasks given to the kernel
+ *   "      "       Oct 19 2026     v2.4.0  -   Benchmark timer started for the critical
+ *                                              section profiler (CRIT_PROFILER)
+ *   "      "       Oct 19 2026     v2.5.0  -   and for the trace recorder (TRACE_RECORDER)
  *****************************************************************************/
 
 /* Standard includes. */
@@ -36,14 +43,25 @@
 #include "include/public.h"
 #include "include/initBoard.h"
 #include "include/Tick4.h"
+#include "include/bench.h"
 
 /* Prototypes for the standard FreeRTOS callback/hook functions implemented within this file. */
 void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName );
 void vApplicationIdleHook(void);
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize);
+#if configUSE_TIMERS == 1
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize);
+#endif
 
 /* Prototype for vTaskHog for Lab5: Watchdog */
 void vTaskHog(void *pvParameters);
 
+#if !KERNEL_BENCH
+/* vTaskHog stack and TCB */
+static StackType_t xTaskHogStack[240];
+static StaticTask_t xTaskHogTCB;
+#endif
+
 int main( void )
 {   
     /* Lines 50-51 are implemented for Lab5: Watchdog */
@@ -58,6 +76,16 @@ int main( void )
     initUart2_wInt();           // UART serial interface with interrupt on RX
     InitNVM();                  // Non-volatile memory EEPROM
 
+#if KERNEL_BENCH
+    /* Kernel benchmark only, results on the RS232 port */
+    vStartKernelBench();
+#else
+#if configUSE_CRITICAL_PROFILER == 1 || configUSE_TRACE_RECORDER == 1
+    /* Time base of the critical section profiler and of the trace recorder,
+       report with Ctrl-R and dump with Ctrl-T on the RS232 port */
+    initBenchTimer();
+#endif
+
     /* Tasks creation */
     vStartTaskUI();
     vStartTaskPoll();
@@ -65,12 +93,13 @@ int main( void )
     vStartTaskTimer();
     
     /* vTaskHog creation for Lab5: Watchdog */
-    xTaskCreate(vTaskHog, (char*) "vTaskHog", 240, NULL, 1, NULL);   
+    xTaskCreateStatic(vTaskHog, (char*) "vTaskHog", 240, NULL, 1, xTaskHogStack, &xTaskHogTCB);
+#endif
 
 	/* Finally start the scheduler. */
 	vTaskStartScheduler();
 
-	/* Will only reach here if there is insufficient heap available to start the scheduler. */
+	/* Will only reach here if the idle task could not be created. */
     while(1);
 	return(0);
 }
@@ -92,6 +121,45 @@ void vApplicationIdleHook( void )
     _RA0 ^= 1;      // toggle LED
 }
 
+/******************************************************************************
+ * Name:        vApplicationGetIdleTaskMemory
+ * Description: Gives vTaskStartScheduler() the stack and TCB of the idle task,
+ *              nothing is allocated from a heap.
+ *  Parameters: - ppxIdleTaskTCBBuffer:     set to the TCB
+ *              - ppxIdleTaskStackBuffer:   set to the stack
+ *              - pusIdleTaskStackSize:     set to the stack depth in words
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize)
+{
+    static StackType_t xIdleTaskStack[configMINIMAL_STACK_SIZE];
+    static StaticTask_t xIdleTaskTCB;
+
+    *ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+    *ppxIdleTaskStackBuffer = xIdleTaskStack;
+    *pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if configUSE_TIMERS == 1
+/******************************************************************************
+ * Name:        vApplicationGetTimerTaskMemory
+ * Description: Gives the kernel the stack and TCB of the timer task.
+ *  Parameters: - ppxTimerTaskTCBBuffer:    set to the TCB
+ *              - ppxTimerTaskStackBuffer:  set to the stack
+ *              - pusTimerTaskStackSize:    set to the stack depth in words
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize)
+{
+    static StackType_t xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+    static StaticTask_t xTimerTaskTCB;
+
+    *ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+    *ppxTimerTaskStackBuffer = xTimerTaskStack;
+    *pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
 /******************************************************************************
  * Name:        vApplicationStackOverflowHook
  * Description: Traps the system during a stack overflow 
@@ -0,0 +1,1874 @@
+/******************************************************************************
+ * File:        bench.c
+ * Description: Kernel microbenchmark suite (see bench.h for the report format).
+ *              Built with KERNEL_BENCH set to 1, main() then starts vTaskBench
+ *              instead of the vending machine tasks.
+ *
+ *              vTaskBench runs every test BENCH_RUNS times, then prints the
+ *              results, so the UART interrupts do not land in the samples.
+ *              The tick interrupt still does: it shows up in the max column.
+ *
+ *              yield           taskYIELD() from a task to another one of the
+ *                              same priority, stamp to stamp
+ *              queue_send      xQueueSend() to an empty queue, no task waiting
+ *              queue_receive   xQueueReceive() from a full queue, no task waiting
+ *              mutex_take      xSemaphoreTake() of a free mutex
+ *              mutex_give      xSemaphoreGive() of the mutex back
+ *              sem_give_isr    xSemaphoreGiveFromISR() in the benchmark
+ *                              interrupt, a higher priority task waiting
+ *              isr_to_task     from before that give to the waiting task
+ *                              running
+ *              notify_to_task  from before xTaskNotifyGive() to the notified
+ *                              higher priority task running
+ *              copy_<n>        xQueueSend() then xQueueReceive() of an n byte
+ *                              item, no task waiting
+ *              zero_copy_<n>   the same with pvQueueAcquireWrite(),
+ *                              vQueueCommitWrite(), pvQueueAcquireRead() and
+ *                              vQueueReleaseRead(), the item being built and
+ *                              used in place (configUSE_ZERO_COPY_QUEUES)
+ *              rx_queue_byte   cost per byte of an RX_BURST byte burst passed
+ *                              from the benchmark interrupt to a waiting task
+ *                              through a queue of chars, one xQueueSendFromISR()
+ *                              and one xQueueReceive() per byte
+ *              rx_stream_byte  the same through a stream buffer, one
+ *                              xStreamBufferSendFromISR() and one
+ *                              xStreamBufferReceive() per burst (UART RX path)
+ *              rx_batch_byte   the same through a queue of chars, one
+ *                              uxQueueSendMultipleFromISR() and one
+ *                              uxQueueReceiveMultiple() per burst, the task
+ *                              woken once (configUSE_QUEUE_BATCH)
+ *              single_<n>      cost per item of BATCH_ITEMS n byte items sent
+ *                              to a queue with xQueueSend() then received
+ *                              with xQueueReceive(), one call per item, no
+ *                              task waiting
+ *              batch_<n>       the same with one uxQueueSendMultiple() and
+ *                              one uxQueueReceiveMultiple()
+ *              timer_reset_<n> xTimerReset() of a timer while n other timers
+ *                              are active, the timer service task (higher
+ *                              priority) processing the command before the
+ *                              call returns
+ *              timer_expire_<n>
+ *                              cost per timer of n auto reload timers
+ *                              expiring at the same tick, from the first
+ *                              callback to the last one
+ *                              (sorted timer lists or timing wheel, see
+ *                              configUSE_TIMER_WHEEL)
+ *              egroup_set_<n>  xEventGroupSetBits() of a bit no task waits
+ *                              for, n tasks waiting for other bits (all
+ *                              tested, or none with
+ *                              configUSE_EVENT_GROUP_BIT_INDEX)
+ *              egroup_isr_to_task
+ *                              from before xEventGroupSetBitsFromISR() in the
+ *                              benchmark interrupt to the waiting higher
+ *                              priority task running (through the timer
+ *                              service task, or directly with
+ *                              configUSE_EVENT_GROUP_DIRECT_ISR)
+ *              pool_alloc      pvBlockPoolAlloc() of a POOL_BLOCK_SIZE byte
+ *                              block, no task waiting
+ *              pool_free       vBlockPoolFree() of the block back
+ *              pool_isr_to_task
+ *                              from before vBlockPoolFreeFromISR() in the
+ *                              benchmark interrupt to the higher priority
+ *                              task blocked on the empty pool running with
+ *                              the block
+ *              set_to_task     from before a post to one of MULTI_SOURCES
+ *                              sources (queues and a binary semaphore) to
+ *                              the higher priority task waiting on all of
+ *                              them through a queue set having received the
+ *                              item (configUSE_QUEUE_SETS, as in
+ *                              Common/Minimal/QueueSet.c)
+ *              bits_to_task    the same with each source setting a bit of the
+ *                              notification value of the task, which waits
+ *                              in xTaskNotifyWait() (configUSE_OBJECT_NOTIFY_BITS)
+ *              set_round_trip  a post to one of the queue set sources then
+ *                              xQueueSelectFromSet() and the receive, no task
+ *                              waiting
+ *              bits_round_trip a post to one of the sources setting a bit
+ *                              of the calling task then xTaskNotifyWait() and
+ *                              the receive, no task waiting
+ *              hrt_delay_<n>   error of vTaskDelayUs(n), the time it took
+ *                              against the n us asked for: 10 spins, 100 and
+ *                              1500 block until the compare interrupt
+ *                              (configUSE_HR_TIMER)
+ *              tick_delay_1000 the same for vTaskDelay(1), called at varied
+ *                              points of the tick, for comparison
+ *              hrt_callback    from the deadline of a one-shot high
+ *                              resolution timer to its callback running
+ *              hrt_timeout     error of a HRT_TIMEOUT_US timeout
+ *                              (vHrTimeOutStart()) ending an xQueueReceive()
+ *                              from an empty queue with portMAX_DELAY
+ *              hrt_multi_8     the same as hrt_callback for each of
+ *                              HRT_TIMERS timers HRT_STAGGER_US apart, all
+ *                              on the one compare
+ *                              (the errors are measured with the high
+ *                              resolution time, in timer counts as the rest;
+ *                              the virtual time of the simulator reaches
+ *                              every deadline exactly, and only moves on
+ *                              for the spin of hrt_delay_10 at the next tick)
+ *              mutex_chain_block
+ *                              time the high priority task of a mutex
+ *                              chain is blocked: it waits for a mutex held
+ *                              by a task blocked on a second mutex, held by
+ *                              the lowest priority task for CONTENTION_HOLD
+ *                              ticks, while a medium priority task has
+ *                              CONTENTION_SPIN ticks of work ready
+ *                              (BENCH_CONTENTION, the work is only in the
+ *                              time without transitive inheritance)
+ *              mutex_timeout_to_task
+ *                              from the high priority task timing out on a
+ *                              mutex held for CONTENTION_HOLD ticks by the
+ *                              lowest priority task to the medium priority
+ *                              task running (BENCH_CONTENTION, the rest of
+ *                              the hold is in the time when the holder keeps
+ *                              the inherited priority after the time out)
+ *              mutex_vend_switches
+ *                              context switches, not timer counts, from a
+ *                              low priority task taking a mutex to it
+ *                              running again after giving it back, a high
+ *                              priority task made ready in between taking
+ *                              the mutex too (BENCH_CONTENTION, priority
+ *                              inheritance)
+ *              ceiling_vend_switches
+ *                              the same with a ceiling mutex
+ *                              (configUSE_CEILING_MUTEXES), the high priority
+ *                              task only runs once the mutex is given back
+ *                              (both 0 with the trace recorder, which has the
+ *                              traceTASK_SWITCHED_IN() hook)
+ *              mixed_mutex_op  time per operation of MIXED_READERS reader
+ *                              tasks and a writer task of the same priority
+ *                              doing MIXED_OPS operations each on data
+ *                              shared through a mutex, the writer writing
+ *                              once every MIXED_WRITE_EVERY operations,
+ *                              every task yielding in the middle of its
+ *                              access as the tick would (BENCH_CONTENTION)
+ *              mixed_rwlock_op the same through a reader-writer lock, the
+ *                              readers not waiting for each other
+ *              heap_malloc     pvPortMalloc() of CHURN_MIN_SIZE to
+ *                              CHURN_MAX_SIZE bytes, up to CHURN_BLOCKS blocks
+ *                              of random sizes being allocated
+ *                              (BENCH_HEAP_CHURN)
+ *              heap_free       vPortFree() of one of those blocks, chosen at
+ *                              random, before its slot is allocated again
+ *                              (whichever heap_n.c is linked, see the
+ *                              BENCH_HEAP line of the report)
+ *              delay_<n>       from a task blocking with a timeout later than
+ *                              the ones of n delayed tasks to a lower priority
+ *                              task running (BENCH_DELAYED_TASKS)
+ *              wake_<n>        from the tick interrupt to a task delayed for
+ *                              one tick running, n tasks staying delayed
+ *                              (sorted delayed lists or buckets, see
+ *                              configUSE_DELAYED_TASK_BUCKETS)
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *   "      "       Oct 19 2026     v1.1.0  -   Copy vs zero copy queue round trips
+ *   "      "       Oct 19 2026     v1.2.0  -   Per byte cost of the RX queue vs stream buffer
+ *   "      "       Oct 19 2026     v1.3.0  -   Timer reset and expiry vs number of active timers
+ *   "      "       Oct 19 2026     v1.4.0  -   Delay and wake vs number of delayed tasks
+ *   "      "       Oct 19 2026     v1.5.0  -   Event group set vs number of waiting tasks, ISR to task
+ *   "      "       Oct 19 2026     v1.6.0  -   Heap churn, allocation and free times and fragmentation
+ *   "      "       Oct 19 2026     v1.7.0  -   Block pool allocation, free and ISR to task
+ *   "      "       Oct 19 2026     v1.8.0  -   Heap profiler report after the results
+ *   "      "       Oct 19 2026     v1.9.0  -   Critical section profiler report after the results
+ *   "      "       Oct 19 2026     v1.10.0 -   Mutex chain and mutex time out contention tests
+ *   "      "       Oct 19 2026     v1.11.0 -   Context switches of a vend, inheritance vs ceiling mutex
+ *   "      "       Oct 19 2026     v1.12.0 -   Mixed read/write workload, mutex vs reader-writer lock
+ *   "      "       Oct 19 2026     v1.13.0 -   Waiting on several sources, queue set vs notification bits
+ *   "      "       Oct 19 2026     v1.14.0 -   Batched queue send / receive vs one item per call
+ *   "      "       Oct 19 2026     v1.15.0 -   Microsecond delay, timeout and callback errors vs tick delay
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "../../Source/include/queue.h"
+#include "../../Source/include/semphr.h"
+#include "../../Source/include/stream_buffer.h"
+#include "../../Source/include/timers.h"
+#include "../../Source/include/event_groups.h"
+#include "../../Source/include/block_pool.h"
+#include "../../Source/include/rw_lock.h"
+#include "../../Source/include/hr_timer.h"
+#include "include/initBoard.h"
+#include "include/COMM2.h"
+#include "include/uart.h"
+#include "include/bench.h"
+#include "include/heap_report.h"
+#include "include/crit_report.h"
+
+#if KERNEL_BENCH
+
+#define SIZE_LINE   64      // longest report line
+#define ITEM_SIZES  4       // item sizes of the copy / zero copy tests
+#define RX_BURST    16      // bytes per sample of the rx tests
+#define BATCH_SIZES 3       // item sizes of the single / batch tests
+#define BATCH_ITEMS 16      // items per sample of the single / batch tests
+#define TIMER_SETS  3       // numbers of active timers of the timer tests
+#define MAX_TIMERS  64      // largest of them
+#define TIMER_BURSTS    20  // samples of each timer_expire test, one burst of expiries each
+#define TIMER_TICKS     20  // period of the timer_expire tests
+#define EGROUP_SETS     2   // numbers of waiting tasks of the egroup_set tests
+#define MAX_WAITERS     7   // largest of them, one per event bit above bit 0 (8 bits with 16 bit ticks)
+#define EGROUP_BIT      0x01    // bit set by the egroup tests, no task of the egroup_set tests waits for it
+#define DELAY_SETS      3       // numbers of delayed tasks of the delay / wake tests
+#define MAX_SLEEPERS    1000    // largest of them
+#define SLEEP_TICKS     30000   // delay of the delayed tasks, never reached during the tests
+#define BLOCK_TICKS     32000   // timeout of the delay test, after all the delayed tasks
+#define WAKE_RUNS       100     // samples of each wake test, one tick each
+#define POOL_BLOCKS     4       // blocks of the pool_alloc / pool_free pool
+#define POOL_BLOCK_SIZE 32      // size of the blocks of the pool tests
+#define MULTI_SOURCES   3       // sources of the set_to_task / bits_to_task tests, one item each
+#define MULTI_SEM       2       // the one of them that is a binary semaphore, the others are queues
+#define CHURN_BLOCKS    256     // slots of the heap churn, allocated or free
+#define CHURN_MIN_SIZE  8       // smallest block of the heap churn
+#define CHURN_MAX_SIZE  256     // largest one
+#define CONTENTION_RUNS     50  // samples of each contention test
+#define CONTENTION_HOLD     3   // ticks the lowest priority task holds its mutex
+#define CONTENTION_SPIN     3   // ticks of work of the medium priority task
+#define CONTENTION_TIMEOUT  1   // block time of the high priority task in mutex_timeout_to_task
+#define MIXED_READERS       3   // reader tasks of the mixed tests, plus one writer task
+#define MIXED_WINDOWS       20  // samples of each mixed test
+#define MIXED_OPS           64  // operations of each task in a sample
+#define MIXED_WRITE_EVERY   8   // the writer task writes once every 8 operations, reads otherwise
+#define MIXED_DATA_SIZE     32  // shared data of the mixed tests
+#define HRT_RUNS            100 // samples of each hrt test, bursts of hrt_multi_8
+#define HRT_TIMERS          8   // timers of hrt_multi_8
+#define HRT_STAGGER_US      50  // time between their deadlines
+#define HRT_CALLBACK_US     300 // deadline of the hrt_callback timer
+#define HRT_TIMEOUT_US      400 // timeout of hrt_timeout
+
+// High resolution timer counts to benchmark timer counts
+#define HRT_TO_BENCH(c)     ((c) * (configCPU_CLOCK_HZ / (1000000UL * portHR_TIMER_COUNTS_PER_US)))
+
+// What the benchmark interrupt does
+enum { ISR_SEM_GIVE, ISR_RX_QUEUE, ISR_RX_STREAM, ISR_RX_BATCH, ISR_EVENT_BITS, ISR_POOL_FREE };
+
+// Contention test being run by the chain tasks
+enum { CONTENTION_CHAIN, CONTENTION_TIMEOUT_TO_TASK, CONTENTION_VEND_INHERIT, CONTENTION_VEND_CEILING };
+
+// Lock of the mixed test being run
+enum { MIXED_MUTEX, MIXED_RWLOCK };
+
+// Index of each test in the results table
+enum { BENCH_YIELD, BENCH_QUEUE_SEND, BENCH_QUEUE_RECEIVE, BENCH_MUTEX_TAKE, BENCH_MUTEX_GIVE,
+       BENCH_SEM_GIVE_ISR, BENCH_ISR_TO_TASK, BENCH_NOTIFY_TO_TASK,
+       BENCH_COPY_2, BENCH_ZERO_COPY_2, BENCH_COPY_8, BENCH_ZERO_COPY_8,
+       BENCH_COPY_32, BENCH_ZERO_COPY_32, BENCH_COPY_128, BENCH_ZERO_COPY_128,
+       BENCH_RX_QUEUE_BYTE, BENCH_RX_STREAM_BYTE, BENCH_RX_BATCH_BYTE,
+       BENCH_SINGLE_1, BENCH_BATCH_1, BENCH_SINGLE_2, BENCH_BATCH_2, BENCH_SINGLE_16, BENCH_BATCH_16,
+       BENCH_TIMER_RESET_4, BENCH_TIMER_EXPIRE_4, BENCH_TIMER_RESET_16, BENCH_TIMER_EXPIRE_16,
+       BENCH_TIMER_RESET_64, BENCH_TIMER_EXPIRE_64,
+       BENCH_EGROUP_SET_1, BENCH_EGROUP_SET_7, BENCH_EGROUP_ISR_TO_TASK,
+       BENCH_POOL_ALLOC, BENCH_POOL_FREE, BENCH_POOL_ISR_TO_TASK,
+       BENCH_SET_TO_TASK, BENCH_BITS_TO_TASK, BENCH_SET_ROUND_TRIP, BENCH_BITS_ROUND_TRIP,
+       BENCH_HRT_DELAY_10, BENCH_HRT_DELAY_100, BENCH_HRT_DELAY_1500, BENCH_TICK_DELAY_1000,
+       BENCH_HRT_CALLBACK, BENCH_HRT_TIMEOUT, BENCH_HRT_MULTI_8,
+#if BENCH_CONTENTION
+       BENCH_MUTEX_CHAIN_BLOCK, BENCH_MUTEX_TIMEOUT_TO_TASK, BENCH_MUTEX_VEND_SWITCHES, BENCH_CEILING_VEND_SWITCHES,
+       BENCH_MIXED_MUTEX_OP, BENCH_MIXED_RWLOCK_OP,
+#endif
+#if BENCH_HEAP_CHURN
+       BENCH_HEAP_MALLOC, BENCH_HEAP_FREE,
+#endif
+#if BENCH_DELAYED_TASKS
+       BENCH_DELAY_10, BENCH_WAKE_10, BENCH_DELAY_100, BENCH_WAKE_100,
+       BENCH_DELAY_1000, BENCH_WAKE_1000,
+#endif
+       BENCH_COUNT };
+
+// Samples of one test
+typedef struct
+{
+    const char *name;
+    unsigned int count;
+    uint32_t min, max;
+    uint32_t sum;
+
+} BenchStat_t;
+
+static BenchStat_t stats[BENCH_COUNT] =
+{
+    { "yield" }, { "queue_send" }, { "queue_receive" }, { "mutex_take" }, { "mutex_give" },
+    { "sem_give_isr" }, { "isr_to_task" }, { "notify_to_task" },
+    { "copy_2" }, { "zero_copy_2" }, { "copy_8" }, { "zero_copy_8" },
+    { "copy_32" }, { "zero_copy_32" }, { "copy_128" }, { "zero_copy_128" },
+    { "rx_queue_byte" }, { "rx_stream_byte" }, { "rx_batch_byte" },
+    { "single_1" }, { "batch_1" }, { "single_2" }, { "batch_2" }, { "single_16" }, { "batch_16" },
+    { "timer_reset_4" }, { "timer_expire_4" }, { "timer_reset_16" }, { "timer_expire_16" },
+    { "timer_reset_64" }, { "timer_expire_64" },
+    { "egroup_set_1" }, { "egroup_set_7" }, { "egroup_isr_to_task" },
+    { "pool_alloc" }, { "pool_free" }, { "pool_isr_to_task" },
+    { "set_to_task" }, { "bits_to_task" }, { "set_round_trip" }, { "bits_round_trip" },
+    { "hrt_delay_10" }, { "hrt_delay_100" }, { "hrt_delay_1500" }, { "tick_delay_1000" },
+    { "hrt_callback" }, { "hrt_timeout" }, { "hrt_multi_8" },
+#if BENCH_CONTENTION
+    { "mutex_chain_block" }, { "mutex_timeout_to_task" }, { "mutex_vend_switches" }, { "ceiling_vend_switches" },
+    { "mixed_mutex_op" }, { "mixed_rwlock_op" },
+#endif
+#if BENCH_HEAP_CHURN
+    { "heap_malloc" }, { "heap_free" },
+#endif
+#if BENCH_DELAYED_TASKS
+    { "delay_10" }, { "wake_10" }, { "delay_100" }, { "wake_100" },
+    { "delay_1000" }, { "wake_1000" }
+#endif
+};
+
+static const unsigned int itemSize[ITEM_SIZES] = { 2, 8, 32, 128 };     // same order as the BENCH_COPY_n entries
+static char item[128];
+static char rxBurst[RX_BURST];
+static const unsigned int batchSize[BATCH_SIZES] = { 1, 2, 16 };    // same order as the BENCH_SINGLE_n entries
+static char batchItems[BATCH_ITEMS * 16];
+static const unsigned int timerSet[TIMER_SETS] = { 4, 16, MAX_TIMERS };   // same order as the BENCH_TIMER_x_n entries
+static const unsigned int waiterSet[EGROUP_SETS] = { 1, MAX_WAITERS };   // same order as the BENCH_EGROUP_SET_n entries
+static const EventBits_t waiterBit[MAX_WAITERS] = { 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+
+
+static uint32_t ulOverhead;             // timer counts taken by ulReadBenchTimer() itself
+static volatile uint32_t ulStamp;       // time the measured operation started
+static volatile uint32_t ulIsrGive;     // xSemaphoreGiveFromISR() time, from the interrupt
+static volatile char isrMode;           // what vBenchIsr() does, ISR_SEM_GIVE to ISR_POOL_FREE
+static uint32_t ulTimerLast;            // time of the last callback of a timer_expire burst
+static unsigned int timersExpired;      // callbacks of the current burst
+static unsigned int timersActive;       // timers of the current burst
+static volatile uint32_t ulSwitches;    // context switches, counted by vBenchTaskSwitchedIn()
+static void *pvSwitchedIn;              // task running since the last one
+
+static xQueueHandle xQueue, xItemQueue[ITEM_SIZES], xRxQueue, xBatchQueue[BATCH_SIZES], xRxBatchQueue;
+static EventGroupHandle_t xEventGroup, xIsrEventGroup;
+static TaskHandle_t xWaiter[MAX_WAITERS];
+static StreamBufferHandle_t xRxStream;
+static xSemaphoreHandle xMutex, xIsrSem;
+static TaskHandle_t xBenchTask, xYieldPeer, xNotifyPeer, xSetPeer, xBitsPeer;
+static TimerHandle_t xTimer[MAX_TIMERS], xProbeTimer;
+static BlockPoolHandle_t xPool, xIsrPool;
+static StaticBlockPool_t xPoolBuffer, xIsrPoolBuffer;
+static size_t xPoolStorage[blockpoolSTORAGE_SIZE(POOL_BLOCK_SIZE, POOL_BLOCKS) / sizeof(size_t)];
+static size_t xIsrPoolStorage[blockpoolSTORAGE_SIZE(POOL_BLOCK_SIZE, 1) / sizeof(size_t)];
+static void *pvIsrBlock;                // only block of xIsrPool, held by vTaskPoolPeer between the samples
+static QueueSetHandle_t xQueueSet;
+static xQueueHandle xSetSource[MULTI_SOURCES], xBitsSource[MULTI_SOURCES];  // members of xQueueSet, sources notifying vTaskNotifyBitsPeer
+static HrTimerHandle_t xHrTimer[HRT_TIMERS];    // [0] is also the hrt_callback timer
+static StaticHrTimer_t xHrTimerBuffer[HRT_TIMERS];
+static uint32_t ulHrLate[HRT_TIMERS];           // time from the deadline of each timer to its callback, ID of the timer
+static volatile unsigned int hrTimersFired;     // callbacks of the current hrt sample
+static unsigned int hrTimersActive;             // timers of the current hrt sample
+
+#if BENCH_CONTENTION
+static xSemaphoreHandle xChainMutex[2];     // [0] wanted by the high priority task, [1] by the holder of [0]
+static xSemaphoreHandle xCeilingMutex;      // xChainMutex[0] with the ceiling of vTaskChainHigh
+static TaskHandle_t xChainLow, xChainMid, xChainMed, xChainHigh;
+static volatile char contentionMode;        // CONTENTION_CHAIN to CONTENTION_VEND_CEILING
+static const unsigned int mixedWriteEvery[MIXED_READERS + 1] = { 0, 0, 0, MIXED_WRITE_EVERY };    // 0 for the readers, the last task writes
+static TaskHandle_t xMixedTask[MIXED_READERS + 1];
+static xSemaphoreHandle xMixedMutex;
+static RWLockHandle_t xMixedLock;
+static volatile char mixedMode;             // MIXED_MUTEX or MIXED_RWLOCK
+static char mixedData[MIXED_DATA_SIZE];
+#endif
+
+#if BENCH_HEAP_CHURN
+static void *pvChurn[CHURN_BLOCKS];     // blocks of the heap churn, NULL when free
+static uint32_t ulChurnSeed = 1;        // random sizes and slots, the same sequence on every build
+static HeapStats_t xChurnStats;         // heap state at the end of the churn, CHURN_BLOCKS allocated
+#endif
+
+#if BENCH_DELAYED_TASKS
+static const unsigned int sleeperSet[DELAY_SETS] = { 10, 100, MAX_SLEEPERS };     // same order as the BENCH_DELAY_n entries
+static TaskHandle_t xSleeper[MAX_SLEEPERS], xCatcher;
+static volatile uint32_t ulCatch;       // last time vTaskCatcher ran
+static volatile char catchArmed;        // vTaskCatcher samples the next time it runs
+static BenchStat_t *pxCatchStat;        // test of that sample
+#endif
+
+/******************************************************************************
+********************* Private static function declarations ********************
+******************************************************************************/
+
+static void vTaskBench(void *pvParameters);
+static void vTaskYieldPeer(void *pvParameters);
+static void vTaskIsrPeer(void *pvParameters);
+static void vTaskNotifyPeer(void *pvParameters);
+static void vTaskRxQueuePeer(void *pvParameters);
+static void vTaskRxStreamPeer(void *pvParameters);
+static void vTaskRxBatchPeer(void *pvParameters);
+static void vTaskBitsWaiter(void *pvParameters);
+static void vTaskBitsPeer(void *pvParameters);
+static void vTaskPoolPeer(void *pvParameters);
+static void vTaskQueueSetPeer(void *pvParameters);
+static void vTaskNotifyBitsPeer(void *pvParameters);
+static void prvCalibrate(void);
+static void prvSample(BenchStat_t *s, uint32_t counts);
+static void prvSampleBurst(BenchStat_t *s, uint32_t counts, unsigned int n);
+static void prvYieldLoop(void);
+static void prvQueueItems(void);
+static void prvQueueBatches(void);
+static void prvTimers(void);
+static void vTimerExpired(TimerHandle_t xExpiredTimer);
+static void prvEventGroups(void);
+static void prvBlockPools(void);
+static void prvPostToSource(xQueueHandle *pxSources, int n);
+static void prvEmptySource(xQueueHandle *pxSources, int n);
+static void prvMultiWait(void);
+static uint32_t prvHrError(uint32_t ulStart, uint32_t ulUs);
+static void prvHrTimers(void);
+static BaseType_t xBenchHrTimerExpired(HrTimerHandle_t xExpiredTimer);
+#if BENCH_CONTENTION
+static void prvContention(void);
+static void prvSpinTicks(TickType_t xTicks);
+static void vTaskChainLow(void *pvParameters);
+static void vTaskChainMid(void *pvParameters);
+static void vTaskChainMed(void *pvParameters);
+static void vTaskChainHigh(void *pvParameters);
+static void prvMixed(void);
+static void vTaskMixedWorker(void *pvParameters);
+#endif
+#if BENCH_HEAP_CHURN
+static unsigned int prvChurnRandom(unsigned int range);
+static void prvHeapChurn(void);
+#endif
+#if BENCH_DELAYED_TASKS
+static void prvDelayedTasks(void);
+static void vTaskSleeper(void *pvParameters);
+static void vTaskCatcher(void *pvParameters);
+#endif
+#if configUSE_HEAP_PROFILER == 1 || configUSE_CRITICAL_PROFILER == 1
+static void prvPutLine(const char *line);
+#endif
+static void prvReport(void);
+
+/******************************************************************************
+ * Name:        prvCalibrate
+ * Description: Measures the cost of reading the timer (smallest of a few back
+ *              to back reads), removed from every sample, and clears the
+ *              results of the previous run.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvCalibrate(void)
+{
+    uint32_t t0, t1;
+    int i;
+
+    ulOverhead = 0xFFFFFFFFUL;
+    for (i = 0; i < 16; i++)
+    {
+        t0 = ulReadBenchTimer();
+        t1 = ulReadBenchTimer();
+        if (t1 - t0 < ulOverhead) ulOverhead = t1 - t0;
+    }
+
+    for (i = 0; i < BENCH_COUNT; i++)
+    {
+        stats[i].count = 0;
+        stats[i].min = 0xFFFFFFFFUL;
+        stats[i].max = 0;
+        stats[i].sum = 0;
+    }
+}
+
+/******************************************************************************
+ * Name:        prvSample
+ * Description: Adds a sample to a test, samples past BENCH_RUNS are ignored.
+ *  Parameters: - BenchStat_t *s:   test
+ *              - uint32_t counts:  timer counts between the two reads
+ *  Return:     None
+ *****************************************************************************/
+static void prvSample(BenchStat_t *s, uint32_t counts)
+{
+    if (s->count >= BENCH_RUNS) return;
+
+    counts = counts > ulOverhead ? counts - ulOverhead : 0;
+
+    if (counts < s->min) s->min = counts;
+    if (counts > s->max) s->max = counts;
+    s->sum += counts;
+    s->count++;
+}
+
+/******************************************************************************
+ * Name:        prvSampleBurst
+ * Description: Adds the per item time of a burst of n items to a test, the
+ *              timer read overhead being removed once for the burst.
+ *  Parameters: - BenchStat_t *s:   test
+ *              - uint32_t counts:  timer counts for the whole burst
+ *              - unsigned int n:   items in the burst
+ *  Return:     None
+ *****************************************************************************/
+static void prvSampleBurst(BenchStat_t *s, uint32_t counts, unsigned int n)
+{
+    counts = counts > ulOverhead ? counts - ulOverhead : 0;
+
+    prvSample(s, counts / n + ulOverhead);
+}
+
+/******************************************************************************
+ * Name:        prvYieldLoop
+ * Description: Run by vTaskBench and vTaskYieldPeer, which have the same
+ *              priority: each one stamps, yields to the other and times the
+ *              switch when it gets back, so every yield gives a sample.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvYieldLoop(void)
+{
+    while (stats[BENCH_YIELD].count < BENCH_RUNS)
+    {
+        ulStamp = ulReadBenchTimer();
+        taskYIELD();
+        prvSample(&stats[BENCH_YIELD], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+/******************************************************************************
+ * Name:        prvQueueItems
+ * Description: Round trip of an item through a queue of each size, copied
+ *              then in place.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvQueueItems(void)
+{
+    uint32_t t0, t1;
+    char *slot;
+    int i, n;
+
+    for (n = 0; n < ITEM_SIZES; n++)
+    {
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            xQueueSend(xItemQueue[n], item, 0);
+            xQueueReceive(xItemQueue[n], item, 0);
+            t1 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_COPY_2 + 2 * n], t1 - t0);
+
+            t0 = ulReadBenchTimer();
+            slot = pvQueueAcquireWrite(xItemQueue[n], 0);
+            slot[0] = i;
+            vQueueCommitWrite(xItemQueue[n]);
+            slot = pvQueueAcquireRead(xItemQueue[n], 0);
+            item[0] = slot[0];
+            vQueueReleaseRead(xItemQueue[n]);
+            t1 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_ZERO_COPY_2 + 2 * n], t1 - t0);
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        prvQueueBatches
+ * Description: BATCH_ITEMS items of each size through a queue with room for
+ *              all of them, one call per item then one call for all of them.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvQueueBatches(void)
+{
+    uint32_t t0, t1;
+    unsigned int i, k, n;
+
+    for (n = 0; n < BATCH_SIZES; n++)
+    {
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            for (k = 0; k < BATCH_ITEMS; k++) xQueueSend(xBatchQueue[n], &batchItems[k * batchSize[n]], 0);
+            for (k = 0; k < BATCH_ITEMS; k++) xQueueReceive(xBatchQueue[n], &batchItems[k * batchSize[n]], 0);
+            t1 = ulReadBenchTimer();
+            prvSampleBurst(&stats[BENCH_SINGLE_1 + 2 * n], t1 - t0, BATCH_ITEMS);
+
+            t0 = ulReadBenchTimer();
+            uxQueueSendMultiple(xBatchQueue[n], batchItems, BATCH_ITEMS, 0);
+            uxQueueReceiveMultiple(xBatchQueue[n], batchItems, BATCH_ITEMS, 0);
+            t1 = ulReadBenchTimer();
+            prvSampleBurst(&stats[BENCH_BATCH_1 + 2 * n], t1 - t0, BATCH_ITEMS);
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        prvTimers
+ * Description: Timer tests for each number of active timers. The background
+ *              timers of timer_reset have periods (1000 ticks and more) that
+ *              do not end during the test, the probe timer expires later than
+ *              all of them, the worst case of the sorted timer lists. The
+ *              timers of timer_expire are started with the same command time
+ *              so they all expire at the same tick, then stopped before they
+ *              expire again.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvTimers(void)
+{
+    uint32_t t0, t1;
+    TickType_t xStart;
+    unsigned int i, n, k;
+
+    for (n = 0; n < TIMER_SETS; n++)
+    {
+        for (k = 0; k < timerSet[n]; k++) xTimerChangePeriod(xTimer[k], 1000 + k, 0);
+
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            xTimerReset(xProbeTimer, 0);
+            t1 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_TIMER_RESET_4 + 2 * n], t1 - t0);
+        }
+
+        xTimerStop(xProbeTimer, 0);
+        for (k = 0; k < timerSet[n]; k++) xTimerChangePeriod(xTimer[k], TIMER_TICKS, 0);
+        for (k = 0; k < timerSet[n]; k++) xTimerStop(xTimer[k], 0);
+
+        timersActive = timerSet[n];
+        for (i = 0; i < TIMER_BURSTS; i++)
+        {
+            timersExpired = 0;
+            xStart = xTaskGetTickCount();
+            for (k = 0; k < timerSet[n]; k++) xTimerGenericCommand(xTimer[k], tmrCOMMAND_START, xStart, NULL, 0);
+
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            prvSampleBurst(&stats[BENCH_TIMER_EXPIRE_4 + 2 * n], ulTimerLast - ulStamp, timerSet[n] - 1);
+
+            for (k = 0; k < timerSet[n]; k++) xTimerStop(xTimer[k], 0);
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        prvEventGroups
+ * Description: Event group tests. The waiting tasks of egroup_set are resumed
+ *              and wait for their bit, then are suspended again at the end.
+ *              egroup_isr_to_task is timed by vTaskBitsPeer.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvEventGroups(void)
+{
+    uint32_t t0, t1;
+    unsigned int i, n, k = 0;
+
+    for (n = 0; n < EGROUP_SETS; n++)
+    {
+        for (; k < waiterSet[n]; k++) vTaskResume(xWaiter[k]);
+
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            xEventGroupSetBits(xEventGroup, EGROUP_BIT);
+            t1 = ulReadBenchTimer();
+            xEventGroupClearBits(xEventGroup, EGROUP_BIT);
+            prvSample(&stats[BENCH_EGROUP_SET_1 + n], t1 - t0);
+        }
+    }
+
+    for (k = 0; k < MAX_WAITERS; k++) vTaskSuspend(xWaiter[k]);
+
+    // the peer (and the timer service task) have a higher priority and run before these calls return
+    isrMode = ISR_EVENT_BITS;
+    for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+    isrMode = ISR_SEM_GIVE;
+}
+
+/******************************************************************************
+ * Name:        prvBlockPools
+ * Description: Block pool tests. pool_isr_to_task is timed by vTaskPoolPeer,
+ *              which waits on xIsrPool, emptied by its only block being held
+ *              by the peer.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvBlockPools(void)
+{
+    uint32_t t0, t1, t2;
+    void *pvBlock;
+    int i;
+
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        t0 = ulReadBenchTimer();
+        pvBlock = pvBlockPoolAlloc(xPool, 0);
+        t1 = ulReadBenchTimer();
+        vBlockPoolFree(xPool, pvBlock);
+        t2 = ulReadBenchTimer();
+        prvSample(&stats[BENCH_POOL_ALLOC], t1 - t0);
+        prvSample(&stats[BENCH_POOL_FREE], t2 - t1);
+    }
+
+    // the peer has a higher priority and runs before these calls return
+    isrMode = ISR_POOL_FREE;
+    for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+    isrMode = ISR_SEM_GIVE;
+}
+
+/******************************************************************************
+ * Name:        prvPostToSource
+ * Description: Posts an item to one of the sources of the multiple wait tests.
+ *  Parameters: - xQueueHandle *pxSources:  xSetSource or xBitsSource
+ *              - int n:                    source, MULTI_SEM for the semaphore
+ *  Return:     None
+ *****************************************************************************/
+static void prvPostToSource(xQueueHandle *pxSources, int n)
+{
+    unsigned int value = 0;
+
+    if (n == MULTI_SEM) xSemaphoreGive(pxSources[n]);
+    else xQueueSend(pxSources[n], &value, 0);
+}
+
+/******************************************************************************
+ * Name:        prvEmptySource
+ * Description: Takes the items of one of the sources of the multiple wait
+ *              tests until it is empty.
+ *  Parameters: - xQueueHandle *pxSources:  xSetSource or xBitsSource
+ *              - int n:                    source, MULTI_SEM for the semaphore
+ *  Return:     None
+ *****************************************************************************/
+static void prvEmptySource(xQueueHandle *pxSources, int n)
+{
+    unsigned int value;
+
+    if (n == MULTI_SEM) while (xSemaphoreTake(pxSources[n], 0) == pdPASS);
+    else while (xQueueReceive(pxSources[n], &value, 0) == pdPASS);
+}
+
+/******************************************************************************
+ * Name:        prvMultiWait
+ * Description: Multiple wait tests: posts to the sources in turn, the task
+ *              waiting on them through a queue set, then the one waiting on
+ *              notification bits, then the same without the task switch.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvMultiWait(void)
+{
+    uint32_t t0, ulBits;
+    int i, n;
+
+    // the peers have a higher priority and run before these calls return
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        ulStamp = ulReadBenchTimer();
+        prvPostToSource(xSetSource, i % MULTI_SOURCES);
+    }
+
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        ulStamp = ulReadBenchTimer();
+        prvPostToSource(xBitsSource, i % MULTI_SOURCES);
+    }
+
+    // this task takes the place of the peers
+    vTaskSuspend(xSetPeer);
+    vTaskSuspend(xBitsPeer);
+    for (n = 0; n < MULTI_SOURCES; n++) vQueueSetNotifyBits(xBitsSource[n], xBenchTask, 1UL << n);
+
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        n = i % MULTI_SOURCES;
+        t0 = ulReadBenchTimer();
+        prvPostToSource(xSetSource, n);
+        xQueueSelectFromSet(xQueueSet, 0);
+        prvEmptySource(xSetSource, n);
+        prvSample(&stats[BENCH_SET_ROUND_TRIP], ulReadBenchTimer() - t0);
+    }
+
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        n = i % MULTI_SOURCES;
+        t0 = ulReadBenchTimer();
+        prvPostToSource(xBitsSource, n);
+        xTaskNotifyWait(0, 1UL << n, &ulBits, 0);
+        prvEmptySource(xBitsSource, n);
+        prvSample(&stats[BENCH_BITS_ROUND_TRIP], ulReadBenchTimer() - t0);
+    }
+
+    for (n = 0; n < MULTI_SOURCES; n++) vQueueSetNotifyBits(xBitsSource[n], xBitsPeer, 1UL << n);
+    vTaskResume(xSetPeer);
+    vTaskResume(xBitsPeer);
+}
+
+/******************************************************************************
+ * Name:        prvHrError
+ * Description: Error of a delay, the time since ulStart against the time
+ *              asked for, either way.
+ *  Parameters: - uint32_t ulStart: high resolution time the delay started
+ *              - uint32_t ulUs:    delay asked for, in us
+ *  Return:     - uint32_t: the error in benchmark timer counts, plus the
+ *                timer read overhead for prvSample() to remove
+ *****************************************************************************/
+static uint32_t prvHrError(uint32_t ulStart, uint32_t ulUs)
+{
+    int32_t lError;
+
+    lError = (int32_t)(ulHrTimerGetTime() - ulStart - hrtimerUS_TO_COUNTS(ulUs));
+    if (lError < 0) lError = -lError;
+
+    return HRT_TO_BENCH((uint32_t)lError) + ulOverhead;
+}
+
+/******************************************************************************
+ * Name:        prvHrTimers
+ * Description: High resolution timer tests: delays against the tick delay,
+ *              then one-shot callbacks woken by the compare interrupt, a
+ *              timeout ending a queue receive, and HRT_TIMERS deadlines
+ *              sharing the compare.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvHrTimers(void)
+{
+    HrTimeOut_t xTimeOut;
+    uint32_t t0;
+    unsigned int value;
+    int i, n;
+
+    for (i = 0; i < HRT_RUNS; i++)
+    {
+        t0 = ulHrTimerGetTime();
+        vTaskDelayUs(10);
+        prvSample(&stats[BENCH_HRT_DELAY_10], prvHrError(t0, 10));
+
+        t0 = ulHrTimerGetTime();
+        vTaskDelayUs(100);
+        prvSample(&stats[BENCH_HRT_DELAY_100], prvHrError(t0, 100));
+
+        t0 = ulHrTimerGetTime();
+        vTaskDelayUs(1500);
+        prvSample(&stats[BENCH_HRT_DELAY_1500], prvHrError(t0, 1500));
+
+        // the tick delay starts anywhere in the tick, as a task woken by
+        // an interrupt would
+        vTaskDelayUs(50 + (i * 137) % 900);
+        t0 = ulHrTimerGetTime();
+        vTaskDelay(1);
+        prvSample(&stats[BENCH_TICK_DELAY_1000], prvHrError(t0, 1000));
+    }
+
+    // the callbacks notify this task once the last one of a sample ran
+    ulTaskNotifyTake(pdTRUE, 0);
+
+    hrTimersActive = 1;
+    for (i = 0; i < HRT_RUNS; i++)
+    {
+        hrTimersFired = 0;
+        vHrTimerStart(xHrTimer[0], HRT_CALLBACK_US);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        prvSample(&stats[BENCH_HRT_CALLBACK], HRT_TO_BENCH(ulHrLate[0]) + ulOverhead);
+    }
+
+    // nothing is ever sent to xQueue outside of the queue tests
+    for (i = 0; i < HRT_RUNS; i++)
+    {
+        t0 = ulHrTimerGetTime();
+        vHrTimeOutStart(&xTimeOut, HRT_TIMEOUT_US);
+        xQueueReceive(xQueue, &value, portMAX_DELAY);
+        xHrTimeOutStop(&xTimeOut);
+        prvSample(&stats[BENCH_HRT_TIMEOUT], prvHrError(t0, HRT_TIMEOUT_US));
+    }
+
+    hrTimersActive = HRT_TIMERS;
+    for (i = 0; i < HRT_RUNS; i++)
+    {
+        hrTimersFired = 0;
+        t0 = ulHrTimerGetTime() + hrtimerUS_TO_COUNTS(HRT_CALLBACK_US);
+        for (n = 0; n < HRT_TIMERS; n++) vHrTimerStartAt(xHrTimer[n], t0 + hrtimerUS_TO_COUNTS(n * HRT_STAGGER_US));
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        for (n = 0; n < HRT_TIMERS; n++) prvSample(&stats[BENCH_HRT_MULTI_8], HRT_TO_BENCH(ulHrLate[n]) + ulOverhead);
+    }
+}
+
+/******************************************************************************
+ * Name:        xBenchHrTimerExpired
+ * Description: Callback of the hrt timers, from the compare interrupt: keeps
+ *              how late it runs and notifies vTaskBench after the last one
+ *              of the sample.
+ *  Parameters: - HrTimerHandle_t xExpiredTimer:    one of xHrTimer
+ *  Return:     - BaseType_t: pdTRUE if vTaskBench has to run
+ *****************************************************************************/
+static BaseType_t xBenchHrTimerExpired(HrTimerHandle_t xExpiredTimer)
+{
+    BaseType_t xWoken = pdFALSE;
+    uint32_t *pulLate = (uint32_t *) pvHrTimerGetTimerID(xExpiredTimer);
+
+    *pulLate = ulHrTimerGetTime() - ulHrTimerGetDeadline(xExpiredTimer);
+
+    if (++hrTimersFired == hrTimersActive) vTaskNotifyGiveFromISR(xBenchTask, &xWoken);
+
+    return xWoken;
+}
+
+#if BENCH_CONTENTION
+/******************************************************************************
+ * Name:        prvContention
+ * Description: Mutex contention tests, timed by vTaskChainHigh and
+ *              vTaskChainMed. Each sample is started by notifying
+ *              vTaskChainLow, and ends when vTaskChainLow, vTaskChainMed and
+ *              vTaskChainHigh have each notified this task back, whatever
+ *              order the priority inheritance made them run in. The vend
+ *              tests are counted by vTaskChainLow, which notifies back alone.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvContention(void)
+{
+    int i, k;
+
+    contentionMode = CONTENTION_CHAIN;
+    for (i = 0; i < CONTENTION_RUNS; i++)
+    {
+        xTaskNotifyGive(xChainLow);
+        for (k = 0; k < 3; k++) ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    }
+
+    contentionMode = CONTENTION_TIMEOUT_TO_TASK;
+    for (i = 0; i < CONTENTION_RUNS; i++)
+    {
+        xTaskNotifyGive(xChainLow);
+        for (k = 0; k < 3; k++) ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    }
+
+    // vend tests: only vTaskChainLow notifies back, once it ran again
+    for (contentionMode = CONTENTION_VEND_INHERIT; contentionMode <= CONTENTION_VEND_CEILING; contentionMode++)
+    {
+        for (i = 0; i < CONTENTION_RUNS; i++)
+        {
+            xTaskNotifyGive(xChainLow);
+            ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        prvMixed
+ * Description: Mixed read/write tests. The worker tasks are resumed together
+ *              with the scheduler suspended, and this lower priority task
+ *              runs again once they have all suspended themselves at the end
+ *              of the sample.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvMixed(void)
+{
+    uint32_t t0;
+    int i, k;
+
+    for (mixedMode = MIXED_MUTEX; mixedMode <= MIXED_RWLOCK; mixedMode++)
+    {
+        for (i = 0; i < MIXED_WINDOWS; i++)
+        {
+            vTaskSuspendAll();
+            for (k = 0; k <= MIXED_READERS; k++) vTaskResume(xMixedTask[k]);
+            t0 = ulReadBenchTimer();
+            xTaskResumeAll();
+
+            t0 = ulReadBenchTimer() - t0;
+            prvSample(&stats[mixedMode == MIXED_MUTEX ? BENCH_MIXED_MUTEX_OP : BENCH_MIXED_RWLOCK_OP], t0 / ((MIXED_READERS + 1) * MIXED_OPS));
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        prvSpinTicks
+ * Description: Busy work of the contention tests: keeps the CPU for a number
+ *              of ticks, as a slow EEPROM write holding a mutex would.
+ *  Parameters: - TickType_t xTicks:    ticks to keep the CPU for
+ *  Return:     None
+ *****************************************************************************/
+static void prvSpinTicks(TickType_t xTicks)
+{
+    TickType_t xStart = xTaskGetTickCount();
+
+    while (xTaskGetTickCount() - xStart < xTicks);
+}
+#endif
+
+#if BENCH_HEAP_CHURN
+/******************************************************************************
+ * Name:        prvChurnRandom
+ * Description: Linear congruential generator of the heap churn.
+ *  Parameters: - unsigned int range:   number of values
+ *  Return:     unsigned int:           0 to range - 1
+ *****************************************************************************/
+static unsigned int prvChurnRandom(unsigned int range)
+{
+    ulChurnSeed = ulChurnSeed * 1103515245UL + 12345UL;
+
+    return (unsigned int)((ulChurnSeed >> 16) % range);
+}
+
+/******************************************************************************
+ * Name:        prvHeapChurn
+ * Description: Heap churn: fills CHURN_BLOCKS slots with blocks of random
+ *              sizes, then BENCH_RUNS times frees the block of a random slot
+ *              and allocates a new one in its place, timing both calls. The
+ *              state of the heap is taken before the blocks are freed.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvHeapChurn(void)
+{
+    uint32_t t0, t1;
+    unsigned int i, k;
+    size_t xSize;
+
+    for (k = 0; k < CHURN_BLOCKS; k++)
+        pvChurn[k] = pvPortMalloc(CHURN_MIN_SIZE + prvChurnRandom(CHURN_MAX_SIZE - CHURN_MIN_SIZE + 1));
+
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        k = prvChurnRandom(CHURN_BLOCKS);
+        xSize = CHURN_MIN_SIZE + prvChurnRandom(CHURN_MAX_SIZE - CHURN_MIN_SIZE + 1);
+
+        if (pvChurn[k] != NULL)
+        {
+            t0 = ulReadBenchTimer();
+            vPortFree(pvChurn[k]);
+            t1 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_HEAP_FREE], t1 - t0);
+        }
+
+        t0 = ulReadBenchTimer();
+        pvChurn[k] = pvPortMalloc(xSize);
+        t1 = ulReadBenchTimer();
+        prvSample(&stats[BENCH_HEAP_MALLOC], t1 - t0);
+    }
+
+    vPortGetHeapStats(&xChurnStats);
+
+    for (k = 0; k < CHURN_BLOCKS; k++)
+    {
+        vPortFree(pvChurn[k]);
+        pvChurn[k] = NULL;
+    }
+}
+#endif
+
+#if BENCH_DELAYED_TASKS
+/******************************************************************************
+ * Name:        prvDelayedTasks
+ * Description: Delay and wake tests for each number of delayed tasks. The
+ *              sleepers are resumed, then delay themselves for SLEEP_TICKS,
+ *              and are suspended again at the end. vTaskBench blocks with a
+ *              later timeout than all of them, the worst case of a sorted
+ *              delayed list, and vTaskCatcher, which runs as soon as it does,
+ *              takes the sample and notifies it back.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvDelayedTasks(void)
+{
+    uint32_t t;
+    unsigned int i, n, k = 0;
+
+    vTaskResume(xCatcher);
+
+    for (n = 0; n < DELAY_SETS; n++)
+    {
+        for (; k < sleeperSet[n]; k++) vTaskResume(xSleeper[k]);
+
+        pxCatchStat = &stats[BENCH_DELAY_10 + 2 * n];
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            catchArmed = 1;
+            ulStamp = ulReadBenchTimer();
+            ulTaskNotifyTake(pdTRUE, BLOCK_TICKS);
+        }
+
+        // vTaskCatcher keeps ulCatch up to date until the tick wakes this task
+        for (i = 0; i < WAKE_RUNS; i++)
+        {
+            ulCatch = ulReadBenchTimer();
+            vTaskDelay(1);
+            t = ulReadBenchTimer();
+            prvSample(&stats[BENCH_WAKE_10 + 2 * n], t - ulCatch);
+        }
+    }
+
+    vTaskSuspend(xCatcher);
+    for (k = 0; k < MAX_SLEEPERS; k++) vTaskSuspend(xSleeper[k]);
+}
+#endif
+
+#if configUSE_HEAP_PROFILER == 1 || configUSE_CRITICAL_PROFILER == 1
+/******************************************************************************
+ * Name:        prvPutLine
+ * Description: Output of the heap and critical section profiler reports, on
+ *              COMM2_PORT.
+ *  Parameters: - const char *line: report line without end of line
+ *  Return:     None
+ *****************************************************************************/
+static void prvPutLine(const char *line)
+{
+    vUartPuts(COMM2_PORT, line);
+    vUartPuts(COMM2_PORT, "\r\n");
+}
+#endif
+
+/******************************************************************************
+ * Name:        prvReport
+ * Description: Prints the results on COMM2_PORT, followed by the heap profiler
+ *              report (configUSE_HEAP_PROFILER) and the critical section
+ *              profiler report (configUSE_CRITICAL_PROFILER).
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvReport(void)
+{
+    char line[SIZE_LINE];
+    int i;
+
+    sprintf(line, "BENCH_BEGIN,%lu,%lu\r\n", (unsigned long)configCPU_CLOCK_HZ, (unsigned long)ulOverhead);
+    vUartPuts(COMM2_PORT, line);
+
+    for (i = 0; i < BENCH_COUNT; i++)
+    {
+        if (stats[i].count == 0) stats[i].min = 0;
+
+        sprintf(line, "BENCH,%s,%u,%lu,%lu,%lu\r\n", stats[i].name, stats[i].count, (unsigned long)stats[i].min,
+                (unsigned long)(stats[i].count ? stats[i].sum / stats[i].count : 0), (unsigned long)stats[i].max);
+        vUartPuts(COMM2_PORT, line);
+    }
+
+#if BENCH_HEAP_CHURN
+    sprintf(line, "BENCH_HEAP,%lu,%lu,%lu,%lu\r\n", (unsigned long)xChurnStats.xAvailableHeapSpaceInBytes,
+            (unsigned long)xChurnStats.xSizeOfLargestFreeBlockInBytes, (unsigned long)xChurnStats.xNumberOfFreeBlocks,
+            (unsigned long)xChurnStats.xMinimumEverFreeBytesRemaining);
+    vUartPuts(COMM2_PORT, line);
+#endif
+
+#if configUSE_HEAP_PROFILER == 1
+    vHeapReport(prvPutLine);
+#endif
+
+#if configUSE_CRITICAL_PROFILER == 1
+    vCritReport(prvPutLine);
+#endif
+
+    vUartPuts(COMM2_PORT, "BENCH_END\r\n");
+}
+
+/******************************************************************************
+ * Name:        vTaskBench
+ * Description: Runs the suite every BENCH_PERIOD_MS.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskBench(void *pvParameters)
+{
+    uint32_t t0, t1, t2;
+    unsigned int value = 0;
+    int i;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        prvCalibrate();
+
+        // yield: the peer finishes its last loop and suspends itself on the final yield
+        vTaskResume(xYieldPeer);
+        prvYieldLoop();
+        taskYIELD();
+
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            xQueueSend(xQueue, &value, 0);
+            t1 = ulReadBenchTimer();
+            xQueueReceive(xQueue, &value, 0);
+            t2 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_QUEUE_SEND], t1 - t0);
+            prvSample(&stats[BENCH_QUEUE_RECEIVE], t2 - t1);
+        }
+
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            t0 = ulReadBenchTimer();
+            xSemaphoreTake(xMutex, 0);
+            t1 = ulReadBenchTimer();
+            xSemaphoreGive(xMutex);
+            t2 = ulReadBenchTimer();
+            prvSample(&stats[BENCH_MUTEX_TAKE], t1 - t0);
+            prvSample(&stats[BENCH_MUTEX_GIVE], t2 - t1);
+        }
+
+        // the peers have a higher priority and run before these calls return
+        for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+
+        isrMode = ISR_RX_QUEUE;
+        for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+
+        isrMode = ISR_RX_STREAM;
+        for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+
+        isrMode = ISR_RX_BATCH;
+        for (i = 0; i < BENCH_RUNS; i++) vTriggerBenchIsr();
+
+        isrMode = ISR_SEM_GIVE;
+
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            ulStamp = ulReadBenchTimer();
+            xTaskNotifyGive(xNotifyPeer);
+        }
+
+        prvQueueItems();
+
+        prvQueueBatches();
+
+        prvTimers();
+
+        prvEventGroups();
+
+        prvBlockPools();
+
+        prvMultiWait();
+
+        prvHrTimers();
+
+#if BENCH_CONTENTION
+        prvContention();
+        prvMixed();
+#endif
+
+#if BENCH_HEAP_CHURN
+        prvHeapChurn();
+#endif
+
+#if BENCH_DELAYED_TASKS
+        prvDelayedTasks();
+#endif
+
+        prvReport();
+        vTaskDelay(BENCH_PERIOD_MS / portTICK_RATE_MS);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskYieldPeer
+ * Description: Other half of the yield test, suspended outside of it.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskYieldPeer(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        prvYieldLoop();
+        vTaskSuspend(NULL);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskIsrPeer
+ * Description: Waits for the semaphore given by vBenchIsr().
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskIsrPeer(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        xSemaphoreTake(xIsrSem, portMAX_DELAY);
+        prvSample(&stats[BENCH_ISR_TO_TASK], ulReadBenchTimer() - ulStamp);
+        prvSample(&stats[BENCH_SEM_GIVE_ISR], ulIsrGive);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskNotifyPeer
+ * Description: Waits for the notifications of vTaskBench.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskNotifyPeer(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        prvSample(&stats[BENCH_NOTIFY_TO_TASK], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskRxQueuePeer
+ * Description: Takes the bursts of vBenchIsr() one byte at a time.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskRxQueuePeer(void *pvParameters)
+{
+    char buf[RX_BURST];
+    int n;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        for (n = 0; n < RX_BURST; n++) xQueueReceive(xRxQueue, &buf[n], portMAX_DELAY);
+        prvSampleBurst(&stats[BENCH_RX_QUEUE_BYTE], ulReadBenchTimer() - ulStamp, RX_BURST);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskRxStreamPeer
+ * Description: Takes the bursts of vBenchIsr() in one read, the trigger level
+ *              being the burst size.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskRxStreamPeer(void *pvParameters)
+{
+    char buf[RX_BURST];
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        if (xStreamBufferReceive(xRxStream, buf, RX_BURST, portMAX_DELAY) == RX_BURST)
+            prvSampleBurst(&stats[BENCH_RX_STREAM_BYTE], ulReadBenchTimer() - ulStamp, RX_BURST);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskRxBatchPeer
+ * Description: Takes the bursts of vBenchIsr() with as few reads as the queue
+ *              allows, one when the whole burst is posted at once.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskRxBatchPeer(void *pvParameters)
+{
+    char buf[RX_BURST];
+    UBaseType_t n;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        for (n = 0; n < RX_BURST; ) n += uxQueueReceiveMultiple(xRxBatchQueue, &buf[n], RX_BURST - n, portMAX_DELAY);
+        prvSampleBurst(&stats[BENCH_RX_BATCH_BYTE], ulReadBenchTimer() - ulStamp, RX_BURST);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskBitsWaiter
+ * Description: One of the waiting tasks of the egroup_set tests, suspended
+ *              outside of them.
+ *  Parameters: - void *pvParameters:   bit waited for (const EventBits_t *)
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskBitsWaiter(void *pvParameters)
+{
+    const EventBits_t uxBit = *(const EventBits_t *) pvParameters;
+
+    for (;;) xEventGroupWaitBits(xEventGroup, uxBit, pdTRUE, pdFALSE, portMAX_DELAY);
+}
+
+/******************************************************************************
+ * Name:        vTaskBitsPeer
+ * Description: Waits for the bit set by vBenchIsr().
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskBitsPeer(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        xEventGroupWaitBits(xIsrEventGroup, EGROUP_BIT, pdTRUE, pdFALSE, portMAX_DELAY);
+        prvSample(&stats[BENCH_EGROUP_ISR_TO_TASK], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskPoolPeer
+ * Description: Waits for the block freed by vBenchIsr(), and keeps it for the
+ *              next sample.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskPoolPeer(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        pvIsrBlock = pvBlockPoolAlloc(xIsrPool, portMAX_DELAY);
+        prvSample(&stats[BENCH_POOL_ISR_TO_TASK], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskQueueSetPeer
+ * Description: Waits on the xSetSource sources through xQueueSet, and takes
+ *              the item of the one selected.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskQueueSetPeer(void *pvParameters)
+{
+    QueueSetMemberHandle_t xMember;
+    unsigned int value;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        xMember = xQueueSelectFromSet(xQueueSet, portMAX_DELAY);
+        if (xMember == xSetSource[MULTI_SEM]) xSemaphoreTake(xMember, 0);
+        else xQueueReceive(xMember, &value, 0);     // one item per source, one event per item
+        prvSample(&stats[BENCH_SET_TO_TASK], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskNotifyBitsPeer
+ * Description: Waits on the xBitsSource sources, source n setting bit n of its
+ *              notification value, and empties the ones whose bit is set.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskNotifyBitsPeer(void *pvParameters)
+{
+    uint32_t ulBits;
+    int n;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        xTaskNotifyWait(0, (1UL << MULTI_SOURCES) - 1, &ulBits, portMAX_DELAY);
+        for (n = 0; n < MULTI_SOURCES; n++)
+        {
+            if (ulBits & (1UL << n)) prvEmptySource(xBitsSource, n);
+        }
+        prvSample(&stats[BENCH_BITS_TO_TASK], ulReadBenchTimer() - ulStamp);
+    }
+}
+
+#if BENCH_CONTENTION
+/******************************************************************************
+ * Name:        vTaskChainLow
+ * Description: Lowest priority task of the contention tests, the one that
+ *              holds a mutex for CONTENTION_HOLD ticks. In the chain test it
+ *              takes xChainMutex[1] and lets vTaskChainMid block on it while
+ *              holding xChainMutex[0], in the time out test it takes
+ *              xChainMutex[0] itself. vTaskChainHigh then blocks on
+ *              xChainMutex[0]. In the vend tests it holds xChainMutex[0] or
+ *              xCeilingMutex only while it makes vTaskChainHigh ready, as
+ *              vTaskUI holds xMutexVM for a sale, and counts the context
+ *              switches until it runs again.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskChainLow(void *pvParameters)
+{
+    xSemaphoreHandle xHeld;
+    uint32_t ulStart;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if (contentionMode == CONTENTION_VEND_INHERIT || contentionMode == CONTENTION_VEND_CEILING)
+        {
+            xHeld = contentionMode == CONTENTION_VEND_INHERIT ? xChainMutex[0] : xCeilingMutex;
+            ulStart = ulSwitches;
+            xSemaphoreTake(xHeld, portMAX_DELAY);
+            xTaskNotifyGive(xChainHigh);        // runs until it blocks on the mutex, not at all under the ceiling
+            xSemaphoreGive(xHeld);              // runs, takes and gives the mutex, then waits for the next sample
+            prvSample(&stats[contentionMode == CONTENTION_VEND_INHERIT ? BENCH_MUTEX_VEND_SWITCHES : BENCH_CEILING_VEND_SWITCHES],
+                      ulSwitches - ulStart);
+        }
+        else
+        {
+            xHeld = contentionMode == CONTENTION_CHAIN ? xChainMutex[1] : xChainMutex[0];
+            xSemaphoreTake(xHeld, portMAX_DELAY);
+            if (contentionMode == CONTENTION_CHAIN) xTaskNotifyGive(xChainMid);    // runs until it blocks on xChainMutex[1]
+            xTaskNotifyGive(xChainHigh);                                            // runs until it blocks on xChainMutex[0]
+
+            prvSpinTicks(CONTENTION_HOLD);
+            xSemaphoreGive(xHeld);
+        }
+        xTaskNotifyGive(xBenchTask);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskChainMid
+ * Description: Middle of the chain test: holds xChainMutex[0] while blocked on
+ *              xChainMutex[1].
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskChainMid(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTake(xChainMutex[0], portMAX_DELAY);
+        xSemaphoreTake(xChainMutex[1], portMAX_DELAY);
+        xSemaphoreGive(xChainMutex[1]);
+        xSemaphoreGive(xChainMutex[0]);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskChainMed
+ * Description: Medium priority task of the contention tests, above the
+ *              holders' own priorities. Has CONTENTION_SPIN ticks of work in
+ *              the chain test, times how long it waited to run in the time out
+ *              test.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskChainMed(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if (contentionMode == CONTENTION_CHAIN) prvSpinTicks(CONTENTION_SPIN);
+        else prvSample(&stats[BENCH_MUTEX_TIMEOUT_TO_TASK], ulReadBenchTimer() - ulStamp);
+        xTaskNotifyGive(xBenchTask);
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskChainHigh
+ * Description: High priority task of the contention tests, blocks on
+ *              xChainMutex[0]. In the chain test it makes vTaskChainMed ready
+ *              and times how long it waits for the mutex, in the time out
+ *              test it makes vTaskChainMed ready when it times out. In the
+ *              vend tests it takes the mutex of vTaskChainLow, as vTaskTimer
+ *              takes xMutexVM.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskChainHigh(void *pvParameters)
+{
+    xSemaphoreHandle xHeld;
+    uint32_t t0;
+
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if (contentionMode == CONTENTION_CHAIN)
+        {
+            xTaskNotifyGive(xChainMed);
+            t0 = ulReadBenchTimer();
+            xSemaphoreTake(xChainMutex[0], portMAX_DELAY);
+            prvSample(&stats[BENCH_MUTEX_CHAIN_BLOCK], ulReadBenchTimer() - t0);
+            xSemaphoreGive(xChainMutex[0]);
+            xTaskNotifyGive(xBenchTask);
+        }
+        else if (contentionMode == CONTENTION_TIMEOUT_TO_TASK)
+        {
+            // the mutex is held for longer than the block time
+            if (xSemaphoreTake(xChainMutex[0], CONTENTION_TIMEOUT) == pdTRUE) xSemaphoreGive(xChainMutex[0]);
+            ulStamp = ulReadBenchTimer();
+            xTaskNotifyGive(xChainMed);
+            xTaskNotifyGive(xBenchTask);
+        }
+        else
+        {
+            xHeld = contentionMode == CONTENTION_VEND_INHERIT ? xChainMutex[0] : xCeilingMutex;
+            xSemaphoreTake(xHeld, portMAX_DELAY);
+            xSemaphoreGive(xHeld);
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        vTaskMixedWorker
+ * Description: Reader or writer task of the mixed tests, operates MIXED_OPS
+ *              times on mixedData then suspends itself until the next sample.
+ *              Every access yields half way through, so the other tasks find
+ *              the data locked.
+ *  Parameters: - void *pvParameters:   entry of mixedWriteEvery of the task
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskMixedWorker(void *pvParameters)
+{
+    const unsigned int *pWriteEvery = (const unsigned int *) pvParameters;
+    unsigned int n;
+    char copy[MIXED_DATA_SIZE];
+
+    for (;;)
+    {
+        for (n = 1; n <= MIXED_OPS; n++)
+        {
+            if (*pWriteEvery != 0 && n % *pWriteEvery == 0)
+            {
+                if (mixedMode == MIXED_MUTEX) xSemaphoreTake(xMixedMutex, portMAX_DELAY);
+                else xRWLockTakeWrite(xMixedLock, portMAX_DELAY);
+
+                memset(mixedData, n, MIXED_DATA_SIZE / 2);
+                taskYIELD();
+                memset(mixedData + MIXED_DATA_SIZE / 2, n, MIXED_DATA_SIZE / 2);
+
+                if (mixedMode == MIXED_MUTEX) xSemaphoreGive(xMixedMutex);
+                else vRWLockGiveWrite(xMixedLock);
+            }
+            else
+            {
+                if (mixedMode == MIXED_MUTEX) xSemaphoreTake(xMixedMutex, portMAX_DELAY);
+                else xRWLockTakeRead(xMixedLock, portMAX_DELAY);
+
+                memcpy(copy, mixedData, MIXED_DATA_SIZE / 2);
+                taskYIELD();
+                memcpy(copy + MIXED_DATA_SIZE / 2, mixedData + MIXED_DATA_SIZE / 2, MIXED_DATA_SIZE / 2);
+
+                if (mixedMode == MIXED_MUTEX) xSemaphoreGive(xMixedMutex);
+                else vRWLockGiveRead(xMixedLock);
+            }
+        }
+
+        vTaskSuspend(NULL);
+    }
+}
+#endif
+
+#if BENCH_DELAYED_TASKS
+/******************************************************************************
+ * Name:        vTaskSleeper
+ * Description: One of the delayed tasks of the delay / wake tests, suspended
+ *              outside of them.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskSleeper(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;) vTaskDelay(SLEEP_TICKS);
+}
+
+/******************************************************************************
+ * Name:        vTaskCatcher
+ * Description: Runs below vTaskBench during the delay / wake tests: stamps
+ *              ulCatch continuously and, when armed, takes the delay sample
+ *              and notifies vTaskBench.
+ *  Parameters: - void *pvParameters:   not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTaskCatcher(void *pvParameters)
+{
+    pvParameters = pvParameters;
+
+    for (;;)
+    {
+        ulCatch = ulReadBenchTimer();
+
+        // read again: this task may have been preempted since the read above
+        if (catchArmed)
+        {
+            catchArmed = 0;
+            prvSample(pxCatchStat, ulReadBenchTimer() - ulStamp);
+            xTaskNotifyGive(xBenchTask);
+        }
+    }
+}
+#endif
+
+/******************************************************************************
+ * Name:        vTimerExpired
+ * Description: Callback of the timer_expire timers, run by the timer service
+ *              task: stamps the first and the last expiry of the burst and
+ *              wakes vTaskBench on the last one.
+ *  Parameters: - TimerHandle_t xExpiredTimer:  not used
+ *  Return:     None
+ *****************************************************************************/
+static void vTimerExpired(TimerHandle_t xExpiredTimer)
+{
+    uint32_t t = ulReadBenchTimer();
+
+    xExpiredTimer = xExpiredTimer;
+
+    if (timersExpired == 0) ulStamp = t;
+    ulTimerLast = t;
+
+    if (++timersExpired == timersActive) xTaskNotifyGive(xBenchTask);
+}
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        vBenchIsr
+ * Description: Body of the benchmark interrupt. Either times the semaphore
+ *              give, the samples are taken by vTaskIsrPeer so that this time is
+ *              not part of isr_to_task, passes a burst of RX_BURST bytes as
+ *              the UART RX interrupt would, sets the event bit of
+ *              vTaskBitsPeer, or gives the block of vTaskPoolPeer back to
+ *              its pool.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vBenchIsr(void)
+{
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+    int n;
+
+    ulStamp = ulReadBenchTimer();
+
+    switch (isrMode)
+    {
+        case ISR_RX_QUEUE:
+            for (n = 0; n < RX_BURST; n++) xQueueSendFromISR(xRxQueue, &rxBurst[n], &xHigherPriorityTaskWoken);
+            break;
+
+        case ISR_RX_STREAM:
+            xStreamBufferSendFromISR(xRxStream, rxBurst, RX_BURST, &xHigherPriorityTaskWoken);
+            break;
+
+        case ISR_RX_BATCH:
+            uxQueueSendMultipleFromISR(xRxBatchQueue, rxBurst, RX_BURST, &xHigherPriorityTaskWoken);
+            break;
+
+        case ISR_EVENT_BITS:
+            xEventGroupSetBitsFromISR(xIsrEventGroup, EGROUP_BIT, &xHigherPriorityTaskWoken);
+            break;
+
+        case ISR_POOL_FREE:
+            vBlockPoolFreeFromISR(xIsrPool, pvIsrBlock, &xHigherPriorityTaskWoken);
+            break;
+
+        default:
+            xSemaphoreGiveFromISR(xIsrSem, &xHigherPriorityTaskWoken);
+            ulIsrGive = ulReadBenchTimer() - ulStamp;
+            break;
+    }
+
+    if (xHigherPriorityTaskWoken != pdFALSE) taskYIELD();
+}
+
+/******************************************************************************
+ * Name:        vBenchTaskSwitchedIn
+ * Description: traceTASK_SWITCHED_IN() of the benchmark build (see
+ *              FreeRTOSConfig.h), counts the context switches. The kernel
+ *              calls it on every yield, the ones that keep the same task
+ *              running are not counted. Interrupts are disabled.
+ *  Parameters: - void *pvTask:     task being switched in
+ *  Return:     None
+ *****************************************************************************/
+void vBenchTaskSwitchedIn(void *pvTask)
+{
+    if (pvTask != pvSwitchedIn)
+    {
+        pvSwitchedIn = pvTask;
+        ulSwitches++;
+    }
+}
+
+/******************************************************************************
+ * Name:        vStartKernelBench
+ * Description: Creates the kernel objects and tasks of the benchmark and
+ *              starts the benchmark timer.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vStartKernelBench(void)
+{
+    int n;
+
+    xQueue = xQueueCreate(1, sizeof(unsigned int));
+    for (n = 0; n < ITEM_SIZES; n++) xItemQueue[n] = xQueueCreate(1, itemSize[n]);
+    xMutex = xSemaphoreCreateMutex();
+    xIsrSem = xSemaphoreCreateBinary();
+    xRxQueue = xQueueCreate(RX_BURST, sizeof(char));
+    xRxStream = xStreamBufferCreate(RX_BURST, RX_BURST);
+    xRxBatchQueue = xQueueCreate(RX_BURST, sizeof(char));
+    for (n = 0; n < BATCH_SIZES; n++) xBatchQueue[n] = xQueueCreate(BATCH_ITEMS, batchSize[n]);
+    for (n = 0; n < MAX_TIMERS; n++) xTimer[n] = xTimerCreate((char *) "tmr", TIMER_TICKS, pdTRUE, NULL, vTimerExpired);
+    xProbeTimer = xTimerCreate((char *) "probe", 2000, pdFALSE, NULL, vTimerExpired);
+    xEventGroup = xEventGroupCreate();
+    xIsrEventGroup = xEventGroupCreate();
+    xPool = xBlockPoolCreateStatic(POOL_BLOCK_SIZE, POOL_BLOCKS, xPoolStorage, &xPoolBuffer);
+    xIsrPool = xBlockPoolCreateStatic(POOL_BLOCK_SIZE, 1, xIsrPoolStorage, &xIsrPoolBuffer);
+    xQueueSet = xQueueCreateSet(MULTI_SOURCES);     // one event per item
+    for (n = 0; n < MULTI_SOURCES; n++)
+    {
+        xSetSource[n] = (n == MULTI_SEM) ? xSemaphoreCreateBinary() : xQueueCreate(1, sizeof(unsigned int));
+        xBitsSource[n] = (n == MULTI_SEM) ? xSemaphoreCreateBinary() : xQueueCreate(1, sizeof(unsigned int));
+        xQueueAddToSet(xSetSource[n], xQueueSet);
+    }
+    for (n = 0; n < HRT_TIMERS; n++) xHrTimer[n] = xHrTimerCreateStatic(xBenchHrTimerExpired, &ulHrLate[n], &xHrTimerBuffer[n]);
+
+    xTaskCreate(vTaskBench, (char *) "vTaskBench", 300, NULL, BENCH_PRIORITY, &xBenchTask);
+    xTaskCreate(vTaskYieldPeer, (char *) "vTaskYieldPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, &xYieldPeer);
+    xTaskCreate(vTaskIsrPeer, (char *) "vTaskIsrPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskNotifyPeer, (char *) "vTaskNotifyPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xNotifyPeer);
+    xTaskCreate(vTaskRxQueuePeer, (char *) "vTaskRxQueuePeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskRxStreamPeer, (char *) "vTaskRxStreamPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskRxBatchPeer, (char *) "vTaskRxBatchPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskBitsPeer, (char *) "vTaskBitsPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskPoolPeer, (char *) "vTaskPoolPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+    xTaskCreate(vTaskQueueSetPeer, (char *) "vTaskQueueSetPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xSetPeer);
+    xTaskCreate(vTaskNotifyBitsPeer, (char *) "vTaskNotifyBitsPeer", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xBitsPeer);
+    for (n = 0; n < MULTI_SOURCES; n++) vQueueSetNotifyBits(xBitsSource[n], xBitsPeer, 1UL << n);
+    vTaskSuspend(xYieldPeer);   // until vTaskBench starts the yield test
+
+    for (n = 0; n < MAX_WAITERS; n++)
+    {
+        xTaskCreate(vTaskBitsWaiter, (char *) "vTaskBitsWaiter", configMINIMAL_STACK_SIZE, (void *) &waiterBit[n], BENCH_PRIORITY + 1, &xWaiter[n]);
+        vTaskSuspend(xWaiter[n]);
+    }
+
+#if BENCH_CONTENTION
+    xChainMutex[0] = xSemaphoreCreateMutex();
+    xChainMutex[1] = xSemaphoreCreateMutex();
+    xCeilingMutex = xSemaphoreCreateMutexWithCeiling(BENCH_PRIORITY + 2);
+    xMixedMutex = xSemaphoreCreateMutex();
+    xMixedLock = xRWLockCreate();
+    xTaskCreate(vTaskChainLow, (char *) "vTaskChainLow", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY - 1, &xChainLow);
+    xTaskCreate(vTaskChainMid, (char *) "vTaskChainMid", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, &xChainMid);
+    xTaskCreate(vTaskChainMed, (char *) "vTaskChainMed", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xChainMed);
+    xTaskCreate(vTaskChainHigh, (char *) "vTaskChainHigh", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 2, &xChainHigh);
+    for (n = 0; n <= MIXED_READERS; n++)
+    {
+        xTaskCreate(vTaskMixedWorker, (char *) "vTaskMixedWorker", configMINIMAL_STACK_SIZE, (void *) &mixedWriteEvery[n], BENCH_PRIORITY + 1, &xMixedTask[n]);
+        vTaskSuspend(xMixedTask[n]);
+    }
+#endif
+
+#if BENCH_DELAYED_TASKS
+    xTaskCreate(vTaskCatcher, (char *) "vTaskCatcher", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY - 1, &xCatcher);
+    vTaskSuspend(xCatcher);
+    for (n = 0; n < MAX_SLEEPERS; n++)
+    {
+        xTaskCreate(vTaskSleeper, (char *) "vTaskSleeper", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &xSleeper[n]);
+        vTaskSuspend(xSleeper[n]);
+    }
+#endif
+
+    initBenchTimer();
+}
+
+#endif /* KERNEL_BENCH */
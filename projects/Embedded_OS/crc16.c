@@ -0,0 +1,40 @@
+/******************************************************************************
+ * File:        crc16.c
+ * Description: CRC-16/CCITT-FALSE used by the telemetry protocol. A 16 entry
+ *              table (one nibble at a time) keeps the flash cost at 32 bytes.
+ *              No target dependencies, the host tool builds this file too.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the telemetry protocol
+ *****************************************************************************/
+
+#include "include/crc16.h"
+
+// CRC of each nibble value, polynomial 0x1021
+static const unsigned short crcNibble[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/******************************************************************************
+ * Name:        usCrc16
+ * Description: Updates "crc" with "len" bytes. Start with CRC16_INIT.
+ *  Parameters: - unsigned short crc:           running CRC
+ *              - const unsigned char *data:    bytes to add
+ *              - int len:                      number of bytes
+ *  Return:     - unsigned short:   updated CRC
+ *****************************************************************************/
+unsigned short usCrc16(unsigned short crc, const unsigned char *data, int len)
+{
+    while (len-- > 0)
+    {
+        crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ (*data >> 4)];
+        crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ (*data & 0x0F)];
+        data++;
+    }
+
+    return crc;
+}
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * File:        crit_report.c
+ * Description: Formats the counters of the kernel critical section profiler
+ *              (see crit_report.h for the line format). Built with
+ *              configUSE_CRITICAL_PROFILER only, the same code prints the
+ *              report on the target UART and in the host file of the
+ *              simulator.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "include/crit_report.h"
+
+#if configUSE_CRITICAL_PROFILER == 1
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        vCritReport
+ * Description: Prints the totals, the histogram and the callers, worst
+ *              offender first. The callers are copied one at a time, a
+ *              caller can take the entry of another one during the report.
+ *  Parameters: - vPutLine: called with each line, without end of line
+ *  Return:     None
+ *****************************************************************************/
+void vCritReport(void (*vPutLine)(const char *line))
+{
+    char line[CRIT_REPORT_LINE];
+    CriticalProfilerStats_t stats;
+    CriticalProfilerSite_t sites[configCRITICAL_PROFILER_SITES], site;
+    UBaseType_t count, i, j;
+
+    vCriticalProfilerGetStats(&stats);
+
+    sprintf(line, "CRIT_BEGIN,%lu", (unsigned long)CRIT_REPORT_HZ);
+    vPutLine(line);
+
+    sprintf(line, "CRIT_TOTAL,%lu,%lu,%lu,%06lX,%lu,%lu", (unsigned long)stats.ulCount,
+            (stats.ulCount == 0) ? 0UL : (unsigned long)(stats.ullTotal / stats.ulCount), (unsigned long)stats.ulMax,
+            (unsigned long)stats.ulMaxCaller, (unsigned long)stats.ulSwitched, (unsigned long)stats.ulLostSections);
+    vPutLine(line);
+
+    for (i = 0; i < criticalprofilerBUCKETS; i++)
+    {
+        if (stats.ulCounts[i] == 0) continue;
+
+        sprintf(line, "CRIT_HIST,%lu,%lu,%lu", (i == 0) ? 0UL : 1UL << i, (2UL << i) - 1, (unsigned long)stats.ulCounts[i]);
+        vPutLine(line);
+    }
+
+    // insertion sort by max, there are only a few callers
+    for (count = 0; count < configCRITICAL_PROFILER_SITES && xCriticalProfilerGetSite(count, &site) != pdFALSE; count++)
+    {
+        for (j = count; j > 0 && sites[j - 1].ulMax < site.ulMax; j--)
+        {
+            sites[j] = sites[j - 1];
+        }
+        sites[j] = site;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        sprintf(line, "CRIT_SITE,%06lX,%lu,%lu,%lu", (unsigned long)sites[i].ulCaller, (unsigned long)sites[i].ulCount,
+                (unsigned long)(sites[i].ullTotal / sites[i].ulCount), (unsigned long)sites[i].ulMax);
+        vPutLine(line);
+    }
+
+    vPutLine("CRIT_END");
+}
+
+#endif /* configUSE_CRITICAL_PROFILER */
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * File:        heap_report.c
+ * Description: Formats the counters of the kernel heap profiler (see
+ *              heap_report.h for the line format). Built with
+ *              configUSE_HEAP_PROFILER only, the same code prints the report
+ *              on the target UART and in the host file of the simulator.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "include/heap_report.h"
+
+#if configUSE_HEAP_PROFILER == 1
+
+/******************************************************************************
+********************* Private static function declarations ********************
+******************************************************************************/
+
+static const char *prvBaseName(const char *file);
+static void prvPutTimes(void (*vPutLine)(const char *line), const char *name, const HeapProfilerTimes_t *times);
+
+/******************************************************************************
+ * Name:        prvBaseName
+ * Description: __FILE__ without its directories, the kernel files are given
+ *              to the compiler as ../../Source/<file>.
+ *  Parameters: - const char *file: __FILE__ of a call site, may be NULL
+ *  Return:     - const char *:     file name
+ *****************************************************************************/
+static const char *prvBaseName(const char *file)
+{
+    const char *p;
+
+    if (file == NULL) return "?";
+
+    for (p = file; *p != '\0'; p++)
+    {
+        if (*p == '/' || *p == '\\') file = p + 1;
+    }
+
+    return file;
+}
+
+/******************************************************************************
+ * Name:        prvPutTimes
+ * Description: Prints one HEAP_TIME line.
+ *  Parameters: - vPutLine:                     line output
+ *              - const char *name:             "malloc" or "free"
+ *              - const HeapProfilerTimes_t *:  times of the calls
+ *  Return:     None
+ *****************************************************************************/
+static void prvPutTimes(void (*vPutLine)(const char *line), const char *name, const HeapProfilerTimes_t *times)
+{
+    char line[HEAP_REPORT_LINE];
+
+    if (times->ulCount == 0)
+    {
+        sprintf(line, "HEAP_TIME,%s,0,0,0,0", name);
+    }
+    else
+    {
+        sprintf(line, "HEAP_TIME,%s,%lu,%lu,%lu,%lu", name, (unsigned long)times->ulCount, (unsigned long)times->ulMin,
+                (unsigned long)(times->ulTotal / times->ulCount), (unsigned long)times->ulMax);
+    }
+    vPutLine(line);
+}
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        vHeapReport
+ * Description: Prints the times, the size histogram, the call sites and the
+ *              live blocks. The tables are read one entry at a time, blocks
+ *              allocated or freed by other tasks during the report may be
+ *              missed or shown twice.
+ *  Parameters: - vPutLine: called with each line, without end of line
+ *  Return:     None
+ *****************************************************************************/
+void vHeapReport(void (*vPutLine)(const char *line))
+{
+    char line[HEAP_REPORT_LINE];
+    HeapProfilerStats_t stats;
+    HeapProfilerSite_t site;
+    HeapProfilerBlock_t block;
+    UBaseType_t i;
+
+    vHeapProfilerGetStats(&stats);
+
+    sprintf(line, "HEAP_BEGIN,%lu", (unsigned long)HEAP_REPORT_HZ);
+    vPutLine(line);
+
+    prvPutTimes(vPutLine, "malloc", &stats.xMallocTimes);
+    prvPutTimes(vPutLine, "free", &stats.xFreeTimes);
+
+    for (i = 0; i < heapprofilerSIZE_BUCKETS; i++)
+    {
+        if (stats.ulSizeCounts[i] == 0) continue;
+
+        sprintf(line, "HEAP_SIZE,%lu,%lu,%lu", (i == 0) ? 0UL : 1UL << i, (2UL << i) - 1, (unsigned long)stats.ulSizeCounts[i]);
+        vPutLine(line);
+    }
+
+    for (i = 0; xHeapProfilerGetSite(i, &site) != pdFALSE; i++)
+    {
+        sprintf(line, "HEAP_SITE,%.24s,%u,%lu,%lu,%lu,%u,%lu,%lu", prvBaseName(site.pcFile), site.usLine,
+                (unsigned long)site.ulAllocations, (unsigned long)site.ulFailures, (unsigned long)site.ulBytes,
+                (unsigned)site.uxLiveBlocks, (unsigned long)site.xLiveBytes, (unsigned long)site.xMaxLiveBytes);
+        vPutLine(line);
+    }
+
+    for (i = 0; xHeapProfilerGetBlock(i, &block) != pdFALSE; i++)
+    {
+        if (block.uxSite == heapprofilerNO_SITE || xHeapProfilerGetSite(block.uxSite, &site) == pdFALSE)
+        {
+            site.pcFile = NULL;
+            site.usLine = 0;
+        }
+
+        sprintf(line, "HEAP_LIVE,%p,%lu,%.24s,%u,%lu", block.pvAddress, (unsigned long)block.xSize,
+                prvBaseName(site.pcFile), site.usLine, (unsigned long)block.xTickAllocated);
+        vPutLine(line);
+    }
+
+    sprintf(line, "HEAP_LOST,%lu,%u,%lu", (unsigned long)stats.ulLostSites, (unsigned)stats.uxUntrackedBlocks,
+            (unsigned long)stats.ulUntrackedFrees);
+    vPutLine(line);
+
+    vPutLine("HEAP_END");
+}
+
+#endif /* configUSE_HEAP_PROFILER */
@@ -5,10 +5,15 @@
 * Serge Hould	December 2016	Add header										- v1.1
 *								Add with function without flow control
 *								Add an ISR 
+* Samson Kaller	October 2026	COMM2_PORT / COMM2_BAUD, functions now use uart.c	- v2
 *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #ifndef COMM2_H
 #define COMM2_H
+
+#define COMM2_PORT  UART_PORT_2     // UART instance used by this library (see uart.h)
+#define COMM2_BAUD  9600UL          // default baud rate of the RS232 port
+
 void initUart2( void);
 void initUart2_wInt( void);
 int putc2( char c);
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * File:        bench.h
+ * Description: Kernel microbenchmark suite. Times the kernel primitives with
+ *              the free running benchmark timer (see initBenchTimer()) and
+ *              reports the results on COMM2_PORT, one line per primitive:
+ *
+ *              BENCH_BEGIN,<timer Hz>,<timer read overhead>
+ *              BENCH,<name>,<runs>,<min>,<avg>,<max>
+ *              ...
+ *              BENCH_HEAP,<free>,<largest free>,<free blocks>,<min ever free>
+ *              HEAP_BEGIN ... HEAP_END
+ *              CRIT_BEGIN ... CRIT_END
+ *              BENCH_END
+ *
+ *              All the times are in timer counts, cycles of fcy on the target,
+ *              with the cost of reading the timer removed. The BENCH_HEAP
+ *              line (BENCH_HEAP_CHURN) gives the state of the heap at the end
+ *              of the heap churn, in bytes: the largest free block against
+ *              the free total shows the fragmentation.
+ *
+ *              Built with HEAP_PROFILER set to 1 (-DHEAP_PROFILER=1, see
+ *              FreeRTOSConfig.h) the report ends with the heap profiler lines
+ *              (see heap_report.h), and heap_malloc / heap_free then include
+ *              the cost of the profiler.
+ *
+ *              Built with CRIT_PROFILER set to 1 the critical section
+ *              profiler lines (see crit_report.h) come next, and every time
+ *              includes the cost of that profiler in the critical sections.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *   "      "       Oct 19 2026     v1.0.1  -   KERNEL_BENCH on the command line for the timers
+ *   "      "       Oct 19 2026     v1.0.2  -   BENCH_DELAYED_TASKS
+ *   "      "       Oct 19 2026     v1.0.3  -   BENCH_HEAP_CHURN
+ *   "      "       Oct 19 2026     v1.0.4  -   Heap profiler report (HEAP_PROFILER)
+ *   "      "       Oct 19 2026     v1.0.5  -   Critical section profiler report (CRIT_PROFILER)
+ *   "      "       Oct 19 2026     v1.0.6  -   BENCH_CONTENTION
+ *   "      "       Oct 19 2026     v1.0.7  -   vBenchTaskSwitchedIn(), vend switch tests
+ *   "      "       Oct 19 2026     v1.0.8  -   Mixed read/write tests in BENCH_CONTENTION
+ *****************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/*****************************************************************************/
+/*********************************** MACROS **********************************/
+/*****************************************************************************/
+
+// Build switch: 1 runs the benchmark instead of the vending machine tasks.
+// Can also be given on the compiler command line (-DKERNEL_BENCH=1), which is
+// needed for FreeRTOSConfig.h to enable the software timers of the benchmark.
+#ifndef KERNEL_BENCH
+#define KERNEL_BENCH        0
+#endif
+
+// Build switch: 1 adds the delay_<n> and wake_<n> tests, up to 1000 delayed
+// tasks that only fit in the heap of the POSIX simulator ("make bench" sets it).
+#ifndef BENCH_DELAYED_TASKS
+#define BENCH_DELAYED_TASKS 0
+#endif
+
+// Build switch: 1 adds the heap_malloc and heap_free tests, which need a heap
+// that frees (heap_2.c, heap_4.c, heap_5.c or heap_6.c, "make bench" links
+// heap_6.c, "make bench BENCH_HEAP=n" heap_n.c). The target links heap_1.c.
+#ifndef BENCH_HEAP_CHURN
+#define BENCH_HEAP_CHURN    0
+#endif
+
+// Build switch: 1 adds the mutex_chain_block, mutex_timeout_to_task,
+// mutex_vend_switches, ceiling_vend_switches, mixed_mutex_op and
+// mixed_rwlock_op tests, eight more tasks, four mutexes and a reader-writer
+// lock ("make bench" sets it).
+#ifndef BENCH_CONTENTION
+#define BENCH_CONTENTION    0
+#endif
+
+#define BENCH_RUNS          1000        // samples per primitive
+#define BENCH_PERIOD_MS     5000        // delay between two runs of the suite
+#define BENCH_PRIORITY      2           // controller task, the waiting peers run one above
+
+/*****************************************************************************/
+/**************************** FUNCTION PROTOTYPES ****************************/
+/*****************************************************************************/
+
+void vStartKernelBench(void);
+void vBenchIsr(void);       // body of the benchmark interrupt, see vTriggerBenchIsr()
+void vBenchTaskSwitchedIn(void *pvTask);    // traceTASK_SWITCHED_IN() of the benchmark, see FreeRTOSConfig.h
+
+#endif /* BENCH_H */
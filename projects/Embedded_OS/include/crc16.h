@@ -0,0 +1,19 @@
+/******************************************************************************
+ * File:        crc16.h
+ * Description: CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), shared by the
+ *              target and the host telemetry tool.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the telemetry protocol
+ *****************************************************************************/
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#define CRC16_INIT  0xFFFF      // start value of a new CRC
+
+unsigned short usCrc16(unsigned short crc, const unsigned char *data, int len);
+
+#endif /* CRC16_H */
@@ -0,0 +1,38 @@
+/******************************************************************************
+ * File:        crit_report.h
+ * Description: Text report of the kernel critical section profiler
+ *              (configUSE_CRITICAL_PROFILER, see
+ *              Source/include/critical_profiler.h), one line per item:
+ *
+ *              CRIT_BEGIN,<timer Hz>
+ *              CRIT_TOTAL,<sections>,<avg>,<max>,<max caller>,<switched>,<lost>
+ *              CRIT_HIST,<from>,<to>,<sections>
+ *              CRIT_SITE,<caller>,<sections>,<avg>,<max>
+ *              CRIT_END
+ *
+ *              Times in counts of configCRITICAL_PROFILER_GET_TIME(), the
+ *              time interrupts stayed masked. Callers are return addresses
+ *              in hex, to be found in the map file. CRIT_HIST lines are only
+ *              given for the non empty buckets of the histogram, CRIT_SITE
+ *              lines are sorted by max, worst offender first. <switched>
+ *              counts the sections ended by a context switch, <lost> the
+ *              ones whose caller is not in the CRIT_SITE lines. The lines
+ *              are given without end of line to a function of the caller,
+ *              which sends them to the UART or writes them to a host file.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#ifndef CRIT_REPORT_H
+#define CRIT_REPORT_H
+
+#define CRIT_REPORT_LINE    80                  // longest report line
+#define CRIT_REPORT_HZ      configCPU_CLOCK_HZ  // counts per second of configCRITICAL_PROFILER_GET_TIME() (benchmark timer)
+#define CRIT_REPORT_KEY     '\x12'              // Ctrl-R on COMM2 prints the report (vTaskTech)
+
+void vCritReport(void (*vPutLine)(const char *line));
+
+#endif /* CRIT_REPORT_H */
@@ -0,0 +1,36 @@
+/******************************************************************************
+ * File:        heap_report.h
+ * Description: Text report of the kernel heap profiler (configUSE_HEAP_PROFILER,
+ *              see Source/include/heap_profiler.h), one line per item:
+ *
+ *              HEAP_BEGIN,<timer Hz>
+ *              HEAP_TIME,<malloc|free>,<calls>,<min>,<avg>,<max>
+ *              HEAP_SIZE,<from>,<to>,<requests>
+ *              HEAP_SITE,<file>,<line>,<allocs>,<fails>,<bytes>,<live blocks>,<live bytes>,<max live bytes>
+ *              HEAP_LIVE,<address>,<size>,<file>,<line>,<tick>
+ *              HEAP_LOST,<lost site calls>,<untracked blocks>,<untracked frees>
+ *              HEAP_END
+ *
+ *              Times in counts of configHEAP_PROFILER_GET_TIME(), sizes in
+ *              bytes. HEAP_SIZE lines are only given for the non empty
+ *              buckets of the size histogram. File names are cut to 24
+ *              characters, "?" for a block whose call site did not fit in
+ *              the profiler table. The lines are given without end of line
+ *              to a function of the caller, which sends them to the UART or
+ *              writes them to a host file.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#ifndef HEAP_REPORT_H
+#define HEAP_REPORT_H
+
+#define HEAP_REPORT_LINE    112                 // longest report line, file names cut to 24 chars
+#define HEAP_REPORT_HZ      configCPU_CLOCK_HZ  // counts per second of configHEAP_PROFILER_GET_TIME() (benchmark timer)
+
+void vHeapReport(void (*vPutLine)(const char *line));
+
+#endif /* HEAP_REPORT_H */
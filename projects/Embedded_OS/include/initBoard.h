@@ -24,6 +24,9 @@ void initOC(void);       // Config OC module with T2
 void initUart2_wInt(void);
 void initADC(void);     // Init ADC
 void initIO(void);
+void initBenchTimer(void);          // Free running 32 bit timer at fcy and interrupt of the kernel benchmark
+uint32_t ulReadBenchTimer(void);
+void vTriggerBenchIsr(void);
 
 
 
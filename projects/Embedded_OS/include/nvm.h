@@ -24,3 +24,7 @@ void lWriteNVM(int address, long data);
 long long llReadNVM(int address);
 void llWriteNVM(int address, long long data);
 
+// block read and write functions, any address
+// NOTE: a written block must not cross a 64 byte page boundary
+void vReadNVMBlock(int address, unsigned char *data, int len);
+void vWriteNVMBlock(int address, const unsigned char *data, int len);
@@ -26,6 +26,10 @@
  *                                              to VendingMachine structure
  *                                          -   Updated function prototypes
  *   "      "       May 14 2019     v1.3.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v1.4.0  -   Added sold counters, sales log NVM layout,
+ *                                              sale_t and iGetSale()
+ *   "      "       Oct 19 2026     v1.5.0  -   Added task stack depths, the tasks are
+ *                                              created statically
  *****************************************************************************/
 
 #ifndef PUBLIC_H
@@ -75,6 +79,13 @@
 #define DRINK_COUNT 4       // total drink count
 #define START_STOCK 5       // starting drink stock
 
+// NVM (25LC256) layout. Balance, credit, cost and stock start at 0x0000 (see vSaveEEPROM)
+#define NVM_SOLD_ADDR       0x0020  // 32-bit sold counter per drink
+#define NVM_SALES_HDR_ADDR  0x0040  // sales log header: next record index, record count
+#define NVM_SALES_ADDR      0x1000  // sales log records
+#define SALES_LOG_SIZE      1024    // number of records kept in the sales log (oldest overwritten)
+#define SALE_RECORD_SIZE    8       // bytes per record, keeps records inside one 64 byte NVM page
+
 // macros used in vTaskTimer for its vTaskDelay and 2Hz counting
 #define TIMER_DELAY_MS      100
 #define TIMER_DELAY_TICKS   (TIMER_DELAY_MS/portTICK_RATE_MS)
@@ -86,6 +97,12 @@
 #define UI_TASK_PRIORITY    2       // Higher priority than vTaskPoll so that vTaskPoll does not pre-empt it
 #define POLL_TASK_PRIORITY  1       // polling task requires lowest priority
 
+// Task stack depths in words, the stacks are static arrays sized at build time
+#define TIMER_TASK_STACK    240
+#define TECH_TASK_STACK     700
+#define UI_TASK_STACK       600
+#define POLL_TASK_STACK     240
+
 // enum for macros used in vTaskTech for tech servicing interface mode
 enum{   MODE_HOME = 1, MODE_STOCK_PRICE, MODE_STOCK_LOAD, MODE_HOME_PRINT, MODE_STOCK_PRICE_PRINT, MODE_STOCK_LOAD_PRINT };
 
@@ -103,9 +120,19 @@ typedef struct
     char name[16];
     float cost;
     int stock;
+    unsigned long sold;     // lifetime count of drinks vended, saved in NVM
     
 } drink_t;
 
+// structure for one record of the NVM sales log
+typedef struct
+{
+    unsigned long time;     // machine time of the sale in 1/10 s
+    unsigned int price;     // price paid in cents
+    char drink;             // index of the drink sold
+    
+} sale_t;
+
 // structure for storing all vending machine related data.
 // Local to vTaskUI and mutex protected
 typedef struct
@@ -116,6 +143,7 @@ typedef struct
     float time;
     float lastTransaction;
     int servicingFlag;
+    unsigned int salesCount;    // number of records in the NVM sales log
     
 } VendingMachine_t;
 
@@ -133,5 +161,6 @@ void vSetVM(float val, char op_type, int i);
 VendingMachine_t vmGetVM();
 
 void vSaveEEPROM(void);
+int iGetSale(unsigned int n, sale_t *sale);
 
 #endif /* PUBLIC_H */
\ No newline at end of file
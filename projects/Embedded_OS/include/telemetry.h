@@ -0,0 +1,28 @@
+/******************************************************************************
+ * File:        telemetry.h
+ * Description: Target side of the binary telemetry/audit protocol (see
+ *              tlm_protocol.h for the frame format).
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// FreeRTOS.h and uart.h must be included before this file
+
+#define TLM_BYTE_TIMEOUT_MS     50      // longest gap allowed between two bytes of a request
+#define TLM_BAUD_SETTLE_MS      50      // time given to the host to switch baud rate after the ACK
+
+// Return codes of iTelemRequest()
+#define TLM_OK                  0
+#define TLM_ERR_TIMEOUT         -1      // request frame incomplete
+#define TLM_ERR_FRAME           -2      // bad length or CRC, frame ignored
+#define TLM_ERR_REQUEST         -3      // valid frame but request refused (NAK sent)
+
+int iTelemRequest(UartPort_t port);
+
+#endif /* TELEMETRY_H */
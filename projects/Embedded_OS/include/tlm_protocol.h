@@ -0,0 +1,67 @@
+/******************************************************************************
+ * File:        tlm_protocol.h
+ * Description: Binary framed telemetry/audit protocol, shared by the target
+ *              (telemetry.c) and the host tool (tools/telemetry_host.c).
+ *
+ *              Frame:  SYNC | LEN | TYPE | SEQ | PAYLOAD (LEN bytes) | CRC16
+ *
+ *              - SYNC is TLM_SYNC. It is not an ASCII char, so the tech console
+ *                can tell a request frame from a menu command.
+ *              - CRC16 (crc16.h) covers LEN, TYPE, SEQ and PAYLOAD and is sent
+ *                LSB first. Multi-byte payload fields are also LSB first.
+ *              - SEQ counts frames sent by the target, so the host can detect
+ *                lost frames. Host requests use SEQ = 0.
+ *
+ *              An audit is requested with TLM_REQ_AUDIT. The target answers with
+ *              TLM_ACK, switches to the requested baud rate, then streams
+ *              TLM_AUDIT_BEGIN, TLM_STATE, one TLM_SLOT per drink, one TLM_SALE
+ *              per record of the NVM sales log and TLM_AUDIT_END, and finally
+ *              returns to its previous baud rate.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created protocol version 1
+ *****************************************************************************/
+
+#ifndef TLM_PROTOCOL_H
+#define TLM_PROTOCOL_H
+
+#define TLM_VERSION         1
+
+#define TLM_SYNC            0xA5    // first byte of every frame
+#define TLM_HDR_SIZE        4       // SYNC, LEN, TYPE, SEQ
+#define TLM_CRC_SIZE        2
+#define TLM_MAX_PAYLOAD     32      // largest payload accepted by either side
+#define TLM_MAX_FRAME       (TLM_HDR_SIZE + TLM_MAX_PAYLOAD + TLM_CRC_SIZE)
+
+// Frame types, host to target
+#define TLM_REQ_AUDIT       0x01    // u32 baud for the audit stream, 0 keeps the current rate
+
+// Frame types, target to host
+#define TLM_ACK             0x02    // u8 request type, u32 baud used for the stream
+#define TLM_NAK             0x03    // u8 request type, u8 reason (TLM_NAK_xxx)
+#define TLM_AUDIT_BEGIN     0x20    // u8 version, u8 slot count, u16 sale count
+#define TLM_STATE           0x21    // u32 time, u32 last transaction (1/10 s), s32 balance,
+                                    // u16 credit (cents), u16 temperature ADC code, u8 servicing flag
+#define TLM_SLOT            0x22    // u8 slot, char name[8], u16 price (cents), s16 stock, u32 sold
+#define TLM_SALE            0x23    // u16 record (0 = oldest), u32 time (1/10 s), u8 slot, u16 price (cents)
+#define TLM_AUDIT_END       0x2F    // u16 frames sent (BEGIN to END), u32 payload+frame bytes, u32 duration (ms)
+
+// Payload sizes
+#define TLM_REQ_AUDIT_LEN   4
+#define TLM_ACK_LEN         5
+#define TLM_NAK_LEN         2
+#define TLM_BEGIN_LEN       4
+#define TLM_STATE_LEN       17
+#define TLM_SLOT_LEN        17
+#define TLM_SALE_LEN        9
+#define TLM_END_LEN         10
+
+#define TLM_NAME_LEN        8       // drink name bytes in TLM_SLOT, zero padded
+
+// NAK reasons
+#define TLM_NAK_TYPE        1       // unknown request type
+#define TLM_NAK_BAUD        2       // baud rate not supported
+
+#endif /* TLM_PROTOCOL_H */
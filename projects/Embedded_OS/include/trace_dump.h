@@ -0,0 +1,43 @@
+/******************************************************************************
+ * File:        trace_dump.h
+ * Description: Binary dump of the kernel trace recorder (configUSE_TRACE_RECORDER,
+ *              see Source/include/trace_recorder.h), shared by the target
+ *              (trace_dump.c) and the host tool (tools/trace_host.c), which
+ *              turns it into a Chrome/Perfetto trace.
+ *
+ *              Dump:   HEADER | OBJECTS | RECORDS
+ *
+ *              - HEADER is TRACE_DUMP_HDR_SIZE bytes:
+ *                  TRACE_DUMP_MAGIC (4 chars), u8 version, u8 objects,
+ *                  u8 name length, u8 0, u32 timer Hz, u32 records written
+ *                  since power up, u32 records in the dump, u16 objects lost
+ *                  because the table was full, u16 0
+ *              - OBJECTS: per object, from ID 1: u8 type, then the name,
+ *                "name length" chars padded with 0, not terminated if full
+ *              - RECORDS: oldest first, TRACE_DUMP_REC_SIZE bytes each:
+ *                  u32 time stamp, u8 event, u8 object ID, u16 parameter
+ *
+ *              Multi-byte fields are LSB first. Event and object codes are
+ *              those of Source/include/trace_events.h. The recorder is
+ *              stopped while the dump is sent, the sending is not traced.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created, dump version 1
+ *****************************************************************************/
+
+#ifndef TRACE_DUMP_H
+#define TRACE_DUMP_H
+
+#define TRACE_DUMP_VERSION  1
+
+#define TRACE_DUMP_MAGIC    "TRCD"
+#define TRACE_DUMP_HDR_SIZE 24
+#define TRACE_DUMP_REC_SIZE 8
+#define TRACE_DUMP_HZ       configCPU_CLOCK_HZ  // counts per second of configTRACE_RECORDER_GET_TIME() (benchmark timer)
+#define TRACE_DUMP_KEY      '\x14'              // Ctrl-T on COMM2 sends the dump (vTaskTech)
+
+void vTraceDump(void (*vPutBytes)(const char *buf, int len));
+
+#endif /* TRACE_DUMP_H */
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * File:        uart.h
+ * Description: Public interface of the instance based UART driver.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created driver for UART1 and UART2
+ *   "      "       Oct 19 2026     v1.1.0  -   Added ulUartGetBaud()
+ *   "      "       Oct 19 2026     v1.2.0  -   RX buffer is a kernel stream buffer
+ *****************************************************************************/
+
+#ifndef UART_H
+#define UART_H
+
+// FreeRTOS.h must be included before this file (TickType_t)
+
+/*****************************************************************************/
+/*********************************** MACROS **********************************/
+/*****************************************************************************/
+
+// Buffer sizes in bytes, per port. The TX ring buffer size must be a power of 2.
+#define UART_RX_BUFF_SIZE   64          // RX stream buffer
+#define UART_TX_BUFF_SIZE   128         // TX ring buffer
+
+#define UART_MAX_BAUD       115200UL    // highest baud rate accepted by iUartSetBaud()
+
+// Flow control options for UartConfig_t.flowControl
+#define UART_FLOW_NONE      0           // UxTX / UxRX only
+#define UART_FLOW_RTS_CTS   1           // UxCTS gates TX and UxRTS is driven by the RX buffer state
+
+// Return codes
+#define UART_OK             0
+#define UART_ERR_PORT       -1          // port does not exist or is not open
+#define UART_ERR_BAUD       -2          // baud rate of 0 or above UART_MAX_BAUD
+
+// UART instances available on the PIC24FJ128GA010
+typedef enum { UART_PORT_1 = 0, UART_PORT_2, UART_PORT_COUNT } UartPort_t;
+
+// Settings used when a port is opened
+typedef struct
+{
+    unsigned long baud;         // baud rate, up to UART_MAX_BAUD
+    char flowControl;           // UART_FLOW_NONE or UART_FLOW_RTS_CTS
+
+} UartConfig_t;
+
+// Per-port counters, reset when the port is opened
+typedef struct
+{
+    unsigned long rxBytes;      // bytes stored in the RX stream buffer
+    unsigned long txBytes;      // bytes written to UxTXREG
+    unsigned int rxDropped;     // bytes lost because the RX stream buffer was full
+    unsigned int overruns;      // hardware FIFO overruns (OERR)
+    unsigned int framingErrors; // bytes received with FERR set (discarded)
+    unsigned int parityErrors;  // bytes received with PERR set (discarded)
+    unsigned int rxHighWater;   // highest RX stream buffer fill level seen
+
+} UartStats_t;
+
+/*****************************************************************************/
+/**************************** FUNCTION PROTOTYPES ****************************/
+/*****************************************************************************/
+
+int iUartOpen(UartPort_t port, const UartConfig_t *config);
+int iUartSetBaud(UartPort_t port, unsigned long baud);
+unsigned long ulUartGetBaud(UartPort_t port);
+
+int iUartWrite(UartPort_t port, const char *buf, int len);
+void vUartPutc(UartPort_t port, char c);
+void vUartPuts(UartPort_t port, const char *str);
+
+int iUartRead(UartPort_t port, char *buf, int len, TickType_t xTicksToWait);
+int iUartGetc(UartPort_t port, char *c, TickType_t xTicksToWait);
+void vUartInjectRx(UartPort_t port, const char *buf, int len);
+
+void vUartGetStats(UartPort_t port, UartStats_t *stats);
+
+#endif /* UART_H */
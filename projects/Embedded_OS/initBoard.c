@@ -8,10 +8,19 @@
  * Samson Kaller    Feb 25 2019     v1.0.0  -   Polishing lab3 code for use as lab4
  *                                              template.
  *   "      "       Mar 04 2019     v1.1.0  -   Added LED initialization
+ *   "      "       Oct 19 2026     v1.2.0  -   Added the benchmark timer (Timer2/3) and
+ *                                              interrupt (Timer5)
+ *   "      "       Oct 19 2026     v1.3.0  -   Benchmark timer also for the critical section
+ *                                              profiler (CRIT_PROFILER)
+ *   "      "       Oct 19 2026     v1.4.0  -   Benchmark timer also for the trace recorder
+ *                                              (TRACE_RECORDER)
  *****************************************************************************/
 
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
 #include "include/initBoard.h"
 #include "include/public.h"
+#include "include/bench.h"
 
 // CONFIG2
 #pragma config POSCMOD = NONE   // Primary Oscillator Select->Primary oscillator disabled
@@ -63,4 +72,81 @@ void initIO(void)
     
     // configure led pins as digital outputs
     TRISA = 0x0;
-}
\ No newline at end of file
+}
+
+#if KERNEL_BENCH || configUSE_CRITICAL_PROFILER == 1 || configUSE_TRACE_RECORDER == 1
+
+/******************************************************************************
+ * Name:        initBenchTimer
+ * Description: Timer2/3 as a single 32 bit timer, 1:1 prescale, free running
+ *              so it counts fcy cycles and wraps every 268s. Timer5 is not
+ *              started, its interrupt is only raised by vTriggerBenchIsr() and
+ *              runs at the kernel priority so it can use the FromISR API
+ *              (KERNEL_BENCH only, the critical section profiler and the
+ *              trace recorder only need the timer).
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void initBenchTimer(void)
+{
+    T2CON = 0;
+    T3CON = 0;
+    T2CONbits.T32 = 1;      // Timer2/3 pair, Timer2 holds the LSW
+    T2CONbits.TCKPS = 0;    // 1:1 prescale
+    TMR3 = 0;
+    TMR2 = 0;
+    PR3 = 0xFFFF;
+    PR2 = 0xFFFF;
+    _T3IE = 0;              // the pair interrupt would come from Timer3
+    T2CONbits.TON = 1;
+
+#if KERNEL_BENCH
+    _T5IP = configKERNEL_INTERRUPT_PRIORITY;
+    _T5IF = 0;
+    _T5IE = 1;
+#endif
+}
+
+/******************************************************************************
+ * Name:        ulReadBenchTimer
+ * Description: Reads the 32 bit benchmark timer. Reading TMR2 latches TMR3 in
+ *              TMR3HLD, so both halves come from the same instant.
+ *  Parameters: None
+ *  Return:     - uint32_t: fcy cycles
+ *****************************************************************************/
+uint32_t ulReadBenchTimer(void)
+{
+    uint16_t lsw;
+
+    lsw = TMR2;
+    return ((uint32_t)TMR3HLD << 16) | lsw;
+}
+
+#endif /* KERNEL_BENCH || configUSE_CRITICAL_PROFILER || configUSE_TRACE_RECORDER */
+
+#if KERNEL_BENCH
+
+/******************************************************************************
+ * Name:        vTriggerBenchIsr
+ * Description: Raises the benchmark interrupt by software.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vTriggerBenchIsr(void)
+{
+    _T5IF = 1;
+}
+
+/******************************************************************************
+ * Name:        _T5Interrupt
+ * Description: Benchmark interrupt, see vBenchIsr().
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void _ISR_NO_PSV _T5Interrupt(void)
+{
+    _T5IF = 0;
+    vBenchIsr();
+}
+
+#endif /* KERNEL_BENCH */
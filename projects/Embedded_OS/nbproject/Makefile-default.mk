@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../../Source/portable/MemMang/heap_1.c ../../Source/portable/MPLAB/PIC24_dsPIC/port.c ../../Source/portable/MPLAB/PIC24_dsPIC/portasm_PIC24.S ../../Source/list.c ../../Source/queue.c ../../Source/tasks.c ../../Source/timers.c ../../Source/croutine.c ../../Source/event_groups.c pmp_lcd.c adc.c COMM2.c initBoard.c common/Tick4.c Lab4_main.c vTaskUI.c vTaskTech.c vTaskPoll.c vTaskTimer.c nvm.c
+SOURCEFILES_QUOTED_IF_SPACED=../../Source/portable/MemMang/heap_1.c ../../Source/portable/MPLAB/PIC24_dsPIC/port.c ../../Source/portable/MPLAB/PIC24_dsPIC/portasm_PIC24.S ../../Source/list.c ../../Source/queue.c ../../Source/tasks.c ../../Source/timers.c ../../Source/croutine.c ../../Source/event_groups.c pmp_lcd.c adc.c COMM2.c initBoard.c Lab4_main.c vTaskUI.c vTaskTech.c vTaskPoll.c vTaskTimer.c nvm.c uart.c crc16.c telemetry.c bench.c ../../Source/stream_buffer.c ../../Source/block_pool.c ../../Source/heap_profiler.c heap_report.c ../../Source/critical_profiler.c crit_report.c ../../Source/trace_recorder.c trace_dump.c ../../Source/rw_lock.c ../../Source/hr_timer.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/897580706/heap_1.o ${OBJECTDIR}/_ext/410575107/port.o ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o ${OBJECTDIR}/_ext/1787047461/list.o ${OBJECTDIR}/_ext/1787047461/queue.o ${OBJECTDIR}/_ext/1787047461/tasks.o ${OBJECTDIR}/_ext/1787047461/timers.o ${OBJECTDIR}/_ext/1787047461/croutine.o ${OBJECTDIR}/_ext/1787047461/event_groups.o ${OBJECTDIR}/pmp_lcd.o ${OBJECTDIR}/adc.o ${OBJECTDIR}/COMM2.o ${OBJECTDIR}/initBoard.o ${OBJECTDIR}/common/Tick4.o ${OBJECTDIR}/Lab4_main.o ${OBJECTDIR}/vTaskUI.o ${OBJECTDIR}/vTaskTech.o ${OBJECTDIR}/vTaskPoll.o ${OBJECTDIR}/vTaskTimer.o ${OBJECTDIR}/nvm.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/897580706/heap_1.o.d ${OBJECTDIR}/_ext/410575107/port.o.d ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o.d ${OBJECTDIR}/_ext/1787047461/list.o.d ${OBJECTDIR}/_ext/1787047461/queue.o.d ${OBJECTDIR}/_ext/1787047461/tasks.o.d ${OBJECTDIR}/_ext/1787047461/timers.o.d ${OBJECTDIR}/_ext/1787047461/croutine.o.d ${OBJECTDIR}/_ext/1787047461/event_groups.o.d ${OBJECTDIR}/pmp_lcd.o.d ${OBJECTDIR}/adc.o.d ${OBJECTDIR}/COMM2.o.d ${OBJECTDIR}/initBoard.o.d ${OBJECTDIR}/common/Tick4.o.d ${OBJECTDIR}/Lab4_main.o.d ${OBJECTDIR}/vTaskUI.o.d ${OBJECTDIR}/vTaskTech.o.d ${OBJECTDIR}/vTaskPoll.o.d ${OBJECTDIR}/vTaskTimer.o.d ${OBJECTDIR}/nvm.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/897580706/heap_1.o ${OBJECTDIR}/_ext/410575107/port.o ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o ${OBJECTDIR}/_ext/1787047461/list.o ${OBJECTDIR}/_ext/1787047461/queue.o ${OBJECTDIR}/_ext/1787047461/tasks.o ${OBJECTDIR}/_ext/1787047461/timers.o ${OBJECTDIR}/_ext/1787047461/croutine.o ${OBJECTDIR}/_ext/1787047461/event_groups.o ${OBJECTDIR}/pmp_lcd.o ${OBJECTDIR}/adc.o ${OBJECTDIR}/COMM2.o ${OBJECTDIR}/initBoard.o ${OBJECTDIR}/Lab4_main.o ${OBJECTDIR}/vTaskUI.o ${OBJECTDIR}/vTaskTech.o ${OBJECTDIR}/vTaskPoll.o ${OBJECTDIR}/vTaskTimer.o ${OBJECTDIR}/nvm.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/crc16.o ${OBJECTDIR}/telemetry.o ${OBJECTDIR}/bench.o ${OBJECTDIR}/_ext/1787047461/stream_buffer.o ${OBJECTDIR}/_ext/1787047461/block_pool.o ${OBJECTDIR}/_ext/1787047461/heap_profiler.o ${OBJECTDIR}/heap_report.o ${OBJECTDIR}/_ext/1787047461/critical_profiler.o ${OBJECTDIR}/crit_report.o ${OBJECTDIR}/_ext/1787047461/trace_recorder.o ${OBJECTDIR}/trace_dump.o ${OBJECTDIR}/_ext/1787047461/rw_lock.o ${OBJECTDIR}/_ext/1787047461/hr_timer.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/897580706/heap_1.o.d ${OBJECTDIR}/_ext/410575107/port.o.d ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o.d ${OBJECTDIR}/_ext/1787047461/list.o.d ${OBJECTDIR}/_ext/1787047461/queue.o.d ${OBJECTDIR}/_ext/1787047461/tasks.o.d ${OBJECTDIR}/_ext/1787047461/timers.o.d ${OBJECTDIR}/_ext/1787047461/croutine.o.d ${OBJECTDIR}/_ext/1787047461/event_groups.o.d ${OBJECTDIR}/pmp_lcd.o.d ${OBJECTDIR}/adc.o.d ${OBJECTDIR}/COMM2.o.d ${OBJECTDIR}/initBoard.o.d ${OBJECTDIR}/Lab4_main.o.d ${OBJECTDIR}/vTaskUI.o.d ${OBJECTDIR}/vTaskTech.o.d ${OBJECTDIR}/vTaskPoll.o.d ${OBJECTDIR}/vTaskTimer.o.d ${OBJECTDIR}/nvm.o.d ${OBJECTDIR}/uart.o.d ${OBJECTDIR}/crc16.o.d ${OBJECTDIR}/telemetry.o.d ${OBJECTDIR}/bench.o.d ${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d ${OBJECTDIR}/_ext/1787047461/block_pool.o.d ${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d ${OBJECTDIR}/heap_report.o.d ${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d ${OBJECTDIR}/crit_report.o.d ${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d ${OBJECTDIR}/trace_dump.o.d ${OBJECTDIR}/_ext/1787047461/rw_lock.o.d ${OBJECTDIR}/_ext/1787047461/hr_timer.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/897580706/heap_1.o ${OBJECTDIR}/_ext/410575107/port.o ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o ${OBJECTDIR}/_ext/1787047461/list.o ${OBJECTDIR}/_ext/1787047461/queue.o ${OBJECTDIR}/_ext/1787047461/tasks.o ${OBJECTDIR}/_ext/1787047461/timers.o ${OBJECTDIR}/_ext/1787047461/croutine.o ${OBJECTDIR}/_ext/1787047461/event_groups.o ${OBJECTDIR}/pmp_lcd.o ${OBJECTDIR}/adc.o ${OBJECTDIR}/COMM2.o ${OBJECTDIR}/initBoard.o ${OBJECTDIR}/common/Tick4.o ${OBJECTDIR}/Lab4_main.o ${OBJECTDIR}/vTaskUI.o ${OBJECTDIR}/vTaskTech.o ${OBJECTDIR}/vTaskPoll.o ${OBJECTDIR}/vTaskTimer.o ${OBJECTDIR}/nvm.o
+OBJECTFILES=${OBJECTDIR}/_ext/897580706/heap_1.o ${OBJECTDIR}/_ext/410575107/port.o ${OBJECTDIR}/_ext/410575107/portasm_PIC24.o ${OBJECTDIR}/_ext/1787047461/list.o ${OBJECTDIR}/_ext/1787047461/queue.o ${OBJECTDIR}/_ext/1787047461/tasks.o ${OBJECTDIR}/_ext/1787047461/timers.o ${OBJECTDIR}/_ext/1787047461/croutine.o ${OBJECTDIR}/_ext/1787047461/event_groups.o ${OBJECTDIR}/pmp_lcd.o ${OBJECTDIR}/adc.o ${OBJECTDIR}/COMM2.o ${OBJECTDIR}/initBoard.o ${OBJECTDIR}/Lab4_main.o ${OBJECTDIR}/vTaskUI.o ${OBJECTDIR}/vTaskTech.o ${OBJECTDIR}/vTaskPoll.o ${OBJECTDIR}/vTaskTimer.o ${OBJECTDIR}/nvm.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/crc16.o ${OBJECTDIR}/telemetry.o ${OBJECTDIR}/bench.o ${OBJECTDIR}/_ext/1787047461/stream_buffer.o ${OBJECTDIR}/_ext/1787047461/block_pool.o ${OBJECTDIR}/_ext/1787047461/heap_profiler.o ${OBJECTDIR}/heap_report.o ${OBJECTDIR}/_ext/1787047461/critical_profiler.o ${OBJECTDIR}/crit_report.o ${OBJECTDIR}/_ext/1787047461/trace_recorder.o ${OBJECTDIR}/trace_dump.o ${OBJECTDIR}/_ext/1787047461/rw_lock.o ${OBJECTDIR}/_ext/1787047461/hr_timer.o
 
 # Source Files
-SOURCEFILES=../../Source/portable/MemMang/heap_1.c ../../Source/portable/MPLAB/PIC24_dsPIC/port.c ../../Source/portable/MPLAB/PIC24_dsPIC/portasm_PIC24.S ../../Source/list.c ../../Source/queue.c ../../Source/tasks.c ../../Source/timers.c ../../Source/croutine.c ../../Source/event_groups.c pmp_lcd.c adc.c COMM2.c initBoard.c common/Tick4.c Lab4_main.c vTaskUI.c vTaskTech.c vTaskPoll.c vTaskTimer.c nvm.c
+SOURCEFILES=../../Source/portable/MemMang/heap_1.c ../../Source/portable/MPLAB/PIC24_dsPIC/port.c ../../Source/portable/MPLAB/PIC24_dsPIC/portasm_PIC24.S ../../Source/list.c ../../Source/queue.c ../../Source/tasks.c ../../Source/timers.c ../../Source/croutine.c ../../Source/event_groups.c pmp_lcd.c adc.c COMM2.c initBoard.c Lab4_main.c vTaskUI.c vTaskTech.c vTaskPoll.c vTaskTimer.c nvm.c uart.c crc16.c telemetry.c bench.c ../../Source/stream_buffer.c ../../Source/block_pool.c ../../Source/heap_profiler.c heap_report.c ../../Source/critical_profiler.c crit_report.c ../../Source/trace_recorder.c trace_dump.c ../../Source/rw_lock.c ../../Source/hr_timer.c
 
 
 CFLAGS=
@@ -178,13 +178,6 @@ ${OBJECTDIR}/initBoard.o: initBoard.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  initBoard.c  -o ${OBJECTDIR}/initBoard.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/initBoard.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
 	@${FIXDEPS} "${OBJECTDIR}/initBoard.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
-${OBJECTDIR}/common/Tick4.o: common/Tick4.c  nbproject/Makefile-${CND_CONF}.mk
-	@${MKDIR} "${OBJECTDIR}/common" 
-	@${RM} ${OBJECTDIR}/common/Tick4.o.d 
-	@${RM} ${OBJECTDIR}/common/Tick4.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  common/Tick4.c  -o ${OBJECTDIR}/common/Tick4.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/common/Tick4.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
-	@${FIXDEPS} "${OBJECTDIR}/common/Tick4.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
-	
 ${OBJECTDIR}/Lab4_main.o: Lab4_main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/Lab4_main.o.d 
@@ -227,6 +220,104 @@ ${OBJECTDIR}/nvm.o: nvm.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  nvm.c  -o ${OBJECTDIR}/nvm.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/nvm.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
 	@${FIXDEPS} "${OBJECTDIR}/nvm.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/uart.o: uart.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/uart.o.d 
+	@${RM} ${OBJECTDIR}/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  uart.c  -o ${OBJECTDIR}/uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/uart.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/uart.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/crc16.o: crc16.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/crc16.o.d 
+	@${RM} ${OBJECTDIR}/crc16.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  crc16.c  -o ${OBJECTDIR}/crc16.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/crc16.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/crc16.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/telemetry.o: telemetry.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  telemetry.c  -o ${OBJECTDIR}/telemetry.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/telemetry.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/telemetry.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/bench.o: bench.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/bench.o.d 
+	@${RM} ${OBJECTDIR}/bench.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  bench.c  -o ${OBJECTDIR}/bench.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/bench.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/bench.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/stream_buffer.o: ../../Source/stream_buffer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/stream_buffer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/stream_buffer.c  -o ${OBJECTDIR}/_ext/1787047461/stream_buffer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/block_pool.o: ../../Source/block_pool.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/block_pool.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/block_pool.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/block_pool.c  -o ${OBJECTDIR}/_ext/1787047461/block_pool.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/block_pool.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/block_pool.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/heap_profiler.o: ../../Source/heap_profiler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/heap_profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/heap_profiler.c  -o ${OBJECTDIR}/_ext/1787047461/heap_profiler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/heap_report.o: heap_report.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/heap_report.o.d 
+	@${RM} ${OBJECTDIR}/heap_report.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  heap_report.c  -o ${OBJECTDIR}/heap_report.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/heap_report.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/heap_report.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/critical_profiler.o: ../../Source/critical_profiler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/critical_profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/critical_profiler.c  -o ${OBJECTDIR}/_ext/1787047461/critical_profiler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/crit_report.o: crit_report.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/crit_report.o.d 
+	@${RM} ${OBJECTDIR}/crit_report.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  crit_report.c  -o ${OBJECTDIR}/crit_report.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/crit_report.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/crit_report.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/trace_recorder.o: ../../Source/trace_recorder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/trace_recorder.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/trace_recorder.c  -o ${OBJECTDIR}/_ext/1787047461/trace_recorder.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/trace_dump.o: trace_dump.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/trace_dump.o.d 
+	@${RM} ${OBJECTDIR}/trace_dump.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  trace_dump.c  -o ${OBJECTDIR}/trace_dump.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/trace_dump.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/trace_dump.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/rw_lock.o: ../../Source/rw_lock.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/rw_lock.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/rw_lock.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/rw_lock.c  -o ${OBJECTDIR}/_ext/1787047461/rw_lock.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/rw_lock.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/rw_lock.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/hr_timer.o: ../../Source/hr_timer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/hr_timer.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/hr_timer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/hr_timer.c  -o ${OBJECTDIR}/_ext/1787047461/hr_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/hr_timer.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/hr_timer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 else
 ${OBJECTDIR}/_ext/897580706/heap_1.o: ../../Source/portable/MemMang/heap_1.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/897580706" 
@@ -312,13 +403,6 @@ ${OBJECTDIR}/initBoard.o: initBoard.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  initBoard.c  -o ${OBJECTDIR}/initBoard.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/initBoard.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
 	@${FIXDEPS} "${OBJECTDIR}/initBoard.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
-${OBJECTDIR}/common/Tick4.o: common/Tick4.c  nbproject/Makefile-${CND_CONF}.mk
-	@${MKDIR} "${OBJECTDIR}/common" 
-	@${RM} ${OBJECTDIR}/common/Tick4.o.d 
-	@${RM} ${OBJECTDIR}/common/Tick4.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE)  common/Tick4.c  -o ${OBJECTDIR}/common/Tick4.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/common/Tick4.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
-	@${FIXDEPS} "${OBJECTDIR}/common/Tick4.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
-	
 ${OBJECTDIR}/Lab4_main.o: Lab4_main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/Lab4_main.o.d 
@@ -361,6 +445,104 @@ ${OBJECTDIR}/nvm.o: nvm.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  nvm.c  -o ${OBJECTDIR}/nvm.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/nvm.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
 	@${FIXDEPS} "${OBJECTDIR}/nvm.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/uart.o: uart.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/uart.o.d 
+	@${RM} ${OBJECTDIR}/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  uart.c  -o ${OBJECTDIR}/uart.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/uart.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/uart.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/crc16.o: crc16.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/crc16.o.d 
+	@${RM} ${OBJECTDIR}/crc16.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  crc16.c  -o ${OBJECTDIR}/crc16.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/crc16.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/crc16.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/telemetry.o: telemetry.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  telemetry.c  -o ${OBJECTDIR}/telemetry.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/telemetry.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/telemetry.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/bench.o: bench.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/bench.o.d 
+	@${RM} ${OBJECTDIR}/bench.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  bench.c  -o ${OBJECTDIR}/bench.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/bench.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/bench.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/stream_buffer.o: ../../Source/stream_buffer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/stream_buffer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/stream_buffer.c  -o ${OBJECTDIR}/_ext/1787047461/stream_buffer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/stream_buffer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/block_pool.o: ../../Source/block_pool.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/block_pool.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/block_pool.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/block_pool.c  -o ${OBJECTDIR}/_ext/1787047461/block_pool.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/block_pool.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/block_pool.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/heap_profiler.o: ../../Source/heap_profiler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/heap_profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/heap_profiler.c  -o ${OBJECTDIR}/_ext/1787047461/heap_profiler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/heap_profiler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/heap_report.o: heap_report.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/heap_report.o.d 
+	@${RM} ${OBJECTDIR}/heap_report.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  heap_report.c  -o ${OBJECTDIR}/heap_report.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/heap_report.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/heap_report.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/critical_profiler.o: ../../Source/critical_profiler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/critical_profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/critical_profiler.c  -o ${OBJECTDIR}/_ext/1787047461/critical_profiler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/critical_profiler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/crit_report.o: crit_report.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/crit_report.o.d 
+	@${RM} ${OBJECTDIR}/crit_report.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  crit_report.c  -o ${OBJECTDIR}/crit_report.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/crit_report.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/crit_report.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/trace_recorder.o: ../../Source/trace_recorder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/trace_recorder.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/trace_recorder.c  -o ${OBJECTDIR}/_ext/1787047461/trace_recorder.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/trace_recorder.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/trace_dump.o: trace_dump.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/trace_dump.o.d 
+	@${RM} ${OBJECTDIR}/trace_dump.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  trace_dump.c  -o ${OBJECTDIR}/trace_dump.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/trace_dump.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/trace_dump.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/rw_lock.o: ../../Source/rw_lock.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/rw_lock.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/rw_lock.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/rw_lock.c  -o ${OBJECTDIR}/_ext/1787047461/rw_lock.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/rw_lock.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/rw_lock.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1787047461/hr_timer.o: ../../Source/hr_timer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1787047461" 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/hr_timer.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1787047461/hr_timer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../../Source/hr_timer.c  -o ${OBJECTDIR}/_ext/1787047461/hr_timer.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1787047461/hr_timer.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD)  -ffunction-sections -fdata-sections -O0 -msmart-io=1 -Wall -msfr-warn=off   -I ../../Source/include -I ../../Source/portable/MPLAB/PIC24_dsPIC -I ../Common/include -I . -Wextra
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1787047461/hr_timer.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 endif
 
 # ------------------------------------------------------------------------------------
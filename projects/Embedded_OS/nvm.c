@@ -194,4 +194,42 @@ void llWriteNVM(int address, long long data) {
         WriteSPI2(i_buff & 0xFF);   // write byte to Serial EEPROM
     } while (sc != 0);              // repeat condition statement
     CSEE = 1;                       // deselect the Serial EEPROM
-}
\ No newline at end of file
+}
+
+// read "len" bytes starting at any address
+void vReadNVMBlock(int address, unsigned char *data, int len) {
+    int i;
+
+    // wait until any work in progress is completed
+    while (ReadSR() & 0x1);         // check WIP
+
+    // perform a sequential read, the address counter of the device auto-increments
+    CSEE = 0;                       // select the Serial EEPROM
+    WriteSPI2(SEE_READ);            // send Read command
+    WriteSPI2(address >> 8);        // address MSB first
+    WriteSPI2(address & 0xff);      // address LSB
+    for (i = 0; i < len; i++)
+        data[i] = WriteSPI2(0);     // send dummy, read data
+    CSEE = 1;                       // deselect Serial EEPROM
+}
+
+// write "len" bytes in a single write cycle
+// NOTE: the block must not cross a 64 byte page boundary
+void vWriteNVMBlock(int address, const unsigned char *data, int len) {
+    int i;
+
+    // wait until any work in progress is completed
+    while (ReadSR() & 0x1);         // check WIP
+
+    // set the write enable latch
+    WriteEnable();
+
+    // perform a page write sequence
+    CSEE = 0;                       // select the Serial EEPROM
+    WriteSPI2(SEE_WRITE);           // write command
+    WriteSPI2(address >> 8);        // address MSB first
+    WriteSPI2(address & 0xff);      // address LSB
+    for (i = 0; i < len; i++)
+        WriteSPI2(data[i]);         // write byte to Serial EEPROM
+    CSEE = 1;                       // deselect the Serial EEPROM
+}
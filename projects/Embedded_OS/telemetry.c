@@ -0,0 +1,243 @@
+/******************************************************************************
+ * File:        telemetry.c
+ * Description: Target side of the binary telemetry/audit protocol. A request
+ *              frame received on the service UART is answered with a full
+ *              audit: machine state, per drink counters and the NVM sales log,
+ *              sent back to back at the baud rate asked for by the host.
+ *
+ *              The functions are called from vTaskTech, which owns COMM2_PORT.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created, protocol version 1
+ *****************************************************************************/
+
+#include <string.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "include/adc.h"
+#include "include/public.h"
+#include "include/uart.h"
+#include "include/crc16.h"
+#include "include/tlm_protocol.h"
+#include "include/telemetry.h"
+
+#define TO_CENTS(x)     ((long)((x) * 100.0F + ((x) < 0 ? -0.5F : 0.5F)))
+#define TO_DS(x)        ((unsigned long)((x) * 10.0F + 0.5F))
+
+// Frames and bytes sent by the audit in progress
+typedef struct
+{
+    UartPort_t port;
+    unsigned char seq;          // SEQ of the next frame
+    unsigned int frames;        // frames sent since TLM_AUDIT_BEGIN
+    unsigned long bytes;        // bytes sent since TLM_AUDIT_BEGIN
+
+} TlmStream_t;
+
+/******************************************************************************
+******************** Private static function declarations *********************
+******************************************************************************/
+
+static void prvSendFrame(TlmStream_t *s, unsigned char type, const unsigned char *payload, int len);
+static unsigned char *prvPut16(unsigned char *p, unsigned int val);
+static unsigned char *prvPut32(unsigned char *p, unsigned long val);
+static void prvSendAudit(UartPort_t port, unsigned long baud);
+
+/******************************************************************************
+ * Name:        prvPut16 / prvPut32
+ * Description: Store a value LSB first in a payload buffer.
+ *  Parameters: - unsigned char *p: destination
+ *              - val:              value to store
+ *  Return:     - unsigned char *:  byte following the stored value
+ *****************************************************************************/
+static unsigned char *prvPut16(unsigned char *p, unsigned int val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    return p + 2;
+}
+
+static unsigned char *prvPut32(unsigned char *p, unsigned long val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    p[2] = val >> 16;
+    p[3] = val >> 24;
+    return p + 4;
+}
+
+/******************************************************************************
+ * Name:        prvSendFrame
+ * Description: Builds a frame around "payload" and queues it in the UART TX
+ *              ring buffer in a single write.
+ *  Parameters: - TlmStream_t *s:           stream the frame belongs to
+ *              - unsigned char type:       frame type (TLM_xxx)
+ *              - const unsigned char *payload: payload bytes
+ *              - int len:                  payload length, up to TLM_MAX_PAYLOAD
+ *  Return:     None
+ *****************************************************************************/
+static void prvSendFrame(TlmStream_t *s, unsigned char type, const unsigned char *payload, int len)
+{
+    unsigned char frame[TLM_MAX_FRAME];
+    unsigned short crc;
+
+    frame[0] = TLM_SYNC;
+    frame[1] = len;
+    frame[2] = type;
+    frame[3] = s->seq++;
+    memcpy(&frame[TLM_HDR_SIZE], payload, len);
+
+    crc = usCrc16(CRC16_INIT, &frame[1], TLM_HDR_SIZE - 1 + len);
+    frame[TLM_HDR_SIZE + len] = crc;
+    frame[TLM_HDR_SIZE + len + 1] = crc >> 8;
+
+    len += TLM_HDR_SIZE + TLM_CRC_SIZE;
+    iUartWrite(s->port, (const char *)frame, len);
+
+    s->frames++;
+    s->bytes += len;
+}
+
+/******************************************************************************
+ * Name:        prvSendAudit
+ * Description: Acknowledges an audit request, then streams the audit at the
+ *              requested baud rate and returns to the previous rate.
+ *  Parameters: - UartPort_t port:      service UART
+ *              - unsigned long baud:   baud rate of the stream, 0 keeps the current one
+ *  Return:     None
+ *****************************************************************************/
+static void prvSendAudit(UartPort_t port, unsigned long baud)
+{
+    TlmStream_t s = { port, 0, 0, 0 };
+    unsigned char payload[TLM_MAX_PAYLOAD], *p;
+    unsigned long oldBaud = ulUartGetBaud(port);
+    VendingMachine_t vm;
+    sale_t sale;
+    TickType_t start;
+    unsigned int n;
+    int i;
+
+    if (baud == 0) baud = oldBaud;
+
+    p = payload;
+    *p++ = TLM_REQ_AUDIT;
+    prvPut32(p, baud);
+    prvSendFrame(&s, TLM_ACK, payload, TLM_ACK_LEN);
+
+    // iUartSetBaud() waits for the ACK to leave the shift register
+    if (baud != oldBaud)
+    {
+        iUartSetBaud(port, baud);
+        vTaskDelay(TLM_BAUD_SETTLE_MS / portTICK_RATE_MS);
+    }
+
+    vm = vmGetVM();     // snapshot, the sales log may still grow while it is sent
+    start = xTaskGetTickCount();
+    s.frames = 0;
+    s.bytes = 0;
+
+    p = payload;
+    *p++ = TLM_VERSION;
+    *p++ = DRINK_COUNT;
+    prvPut16(p, vm.salesCount);
+    prvSendFrame(&s, TLM_AUDIT_BEGIN, payload, TLM_BEGIN_LEN);
+
+    p = prvPut32(payload, TO_DS(vm.time));
+    p = prvPut32(p, TO_DS(vm.lastTransaction));
+    p = prvPut32(p, TO_CENTS(vm.balance));
+    p = prvPut16(p, TO_CENTS(vm.credit));
+    p = prvPut16(p, readADC(5));
+    *p = vm.servicingFlag;
+    prvSendFrame(&s, TLM_STATE, payload, TLM_STATE_LEN);
+
+    for (i = 0; i < DRINK_COUNT; i++)
+    {
+        payload[0] = i;
+        strncpy((char *)&payload[1], vm.drink[i].name, TLM_NAME_LEN);   // zero pads short names
+        p = prvPut16(&payload[1 + TLM_NAME_LEN], TO_CENTS(vm.drink[i].cost));
+        p = prvPut16(p, vm.drink[i].stock);
+        prvPut32(p, vm.drink[i].sold);
+        prvSendFrame(&s, TLM_SLOT, payload, TLM_SLOT_LEN);
+    }
+
+    for (n = 0; n < vm.salesCount && iGetSale(n, &sale); n++)
+    {
+        p = prvPut16(payload, n);
+        p = prvPut32(p, sale.time);
+        *p++ = sale.drink;
+        prvPut16(p, sale.price);
+        prvSendFrame(&s, TLM_SALE, payload, TLM_SALE_LEN);
+    }
+
+    // END counts itself
+    p = prvPut16(payload, s.frames + 1);
+    p = prvPut32(p, s.bytes + TLM_HDR_SIZE + TLM_END_LEN + TLM_CRC_SIZE);
+    prvPut32(p, (unsigned long)(TickType_t)(xTaskGetTickCount() - start) * portTICK_RATE_MS);
+    prvSendFrame(&s, TLM_AUDIT_END, payload, TLM_END_LEN);
+
+    if (baud != oldBaud) iUartSetBaud(port, oldBaud);
+}
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        iTelemRequest
+ * Description: Called once TLM_SYNC has been received on "port". Reads the
+ *              rest of the request frame and serves it. Frames with a bad
+ *              length or CRC are dropped silently, the host retries.
+ *  Parameters: - UartPort_t port:  service UART
+ *  Return:     - int:  TLM_OK or TLM_ERR_xxx
+ *****************************************************************************/
+int iTelemRequest(UartPort_t port)
+{
+    unsigned char frame[TLM_MAX_FRAME];
+    unsigned char payload[TLM_NAK_LEN];
+    TlmStream_t s = { port, 0, 0, 0 };
+    unsigned long baud;
+    int i, len;
+
+    // LEN, TYPE, SEQ, then LEN payload bytes and the CRC
+    for (i = 1, len = TLM_HDR_SIZE; i < len; i++)
+    {
+        if (iUartGetc(port, (char *)&frame[i], TLM_BYTE_TIMEOUT_MS / portTICK_RATE_MS) != 1) return TLM_ERR_TIMEOUT;
+
+        if (i == 1)
+        {
+            if (frame[1] > TLM_MAX_PAYLOAD) return TLM_ERR_FRAME;
+            len = TLM_HDR_SIZE + frame[1] + TLM_CRC_SIZE;
+        }
+    }
+
+    len = frame[1];
+    if (usCrc16(CRC16_INIT, &frame[1], TLM_HDR_SIZE - 1 + len) !=
+        (frame[TLM_HDR_SIZE + len] | (frame[TLM_HDR_SIZE + len + 1] << 8))) return TLM_ERR_FRAME;
+
+    payload[0] = frame[2];
+
+    if (frame[2] != TLM_REQ_AUDIT || len != TLM_REQ_AUDIT_LEN)
+    {
+        payload[1] = TLM_NAK_TYPE;
+        prvSendFrame(&s, TLM_NAK, payload, TLM_NAK_LEN);
+        return TLM_ERR_REQUEST;
+    }
+
+    baud = (unsigned long)frame[4] | ((unsigned long)frame[5] << 8) |
+           ((unsigned long)frame[6] << 16) | ((unsigned long)frame[7] << 24);
+
+    if (baud > UART_MAX_BAUD)
+    {
+        payload[1] = TLM_NAK_BAUD;
+        prvSendFrame(&s, TLM_NAK, payload, TLM_NAK_LEN);
+        return TLM_ERR_REQUEST;
+    }
+
+    prvSendAudit(port, baud);
+
+    return TLM_OK;
+}
@@ -0,0 +1,455 @@
+/******************************************************************************
+ * File:        telemetry_host.c
+ * Description: Host (Linux) side of the telemetry/audit protocol. Requests an
+ *              audit from the vending machine over the service port, decodes
+ *              the frames and reports the link throughput.
+ *
+ *              Build (from this directory):
+ *                  gcc -O2 -Wall -o telemetry_host telemetry_host.c ../crc16.c
+ *
+ *              Usage:
+ *                  telemetry_host [-d /dev/ttyUSB0] [-b 115200] [-c] [-o capture.bin]
+ *                      request an audit, the stream is sent at the -b rate
+ *                  telemetry_host -f capture.bin [-c]
+ *                      decode a capture saved with -o
+ *                  telemetry_host --bench N
+ *                      decode N synthetic sale frames and report the decoder speed
+ *
+ *              -c prints CSV instead of text. The port is opened at 9600 baud
+ *              (COMM2_BAUD) with RTS/CTS flow control.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created, protocol version 1
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/select.h>
+
+#include "../include/crc16.h"
+#include "../include/tlm_protocol.h"
+
+#define LINK_BAUD       9600UL      // rate of the service port outside of an audit
+#define RX_TIMEOUT_MS   2000        // audit aborted after this much silence
+
+// Frame decoder state
+typedef struct
+{
+    unsigned char frame[TLM_MAX_FRAME];
+    int pos;                    // bytes of the current frame received
+    int need;                   // size of the current frame once LEN is known
+    int lastSeq;                // SEQ of the last good frame, -1 before the first
+    unsigned long good;         // frames with a valid CRC
+    unsigned long crcErrors;
+    unsigned long seqErrors;    // frames missing according to SEQ
+    unsigned long skipped;      // bytes discarded while looking for SYNC
+
+} Decoder_t;
+
+static int csv;                 // print CSV instead of text
+static int quiet;               // decode only, used by the benchmark
+static int ended;               // TLM_AUDIT_END received
+
+/******************************************************************************
+ * Name:        get16 / get32
+ * Description: Read a LSB first value from a payload.
+ *****************************************************************************/
+static unsigned int get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned long get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+/******************************************************************************
+ * Name:        now_ms
+ * Description: Monotonic time in ms.
+ *****************************************************************************/
+static double now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/******************************************************************************
+ * Name:        printFrame
+ * Description: Prints one good frame as text or CSV.
+ *  Parameters: - int type:                 frame type
+ *              - const unsigned char *p:   payload
+ *              - int len:                  payload length
+ *****************************************************************************/
+static void printFrame(int type, const unsigned char *p, int len)
+{
+    char name[TLM_NAME_LEN + 1];
+
+    if (type == TLM_AUDIT_END) ended = 1;
+    if (quiet) return;
+
+    switch (type)
+    {
+        case TLM_ACK:
+            if (len < TLM_ACK_LEN) break;
+            if (!csv) printf("ACK request 0x%02X, stream at %lu baud\n", p[0], get32(&p[1]));
+            return;
+
+        case TLM_NAK:
+            if (len < TLM_NAK_LEN) break;
+            fprintf(stderr, "NAK request 0x%02X, reason %d\n", p[0], p[1]);
+            return;
+
+        case TLM_AUDIT_BEGIN:
+            if (len < TLM_BEGIN_LEN) break;
+            if (csv) printf("begin,%d,%d,%u\n", p[0], p[1], get16(&p[2]));
+            else printf("Audit v%d: %d slots, %u sales\n", p[0], p[1], get16(&p[2]));
+            return;
+
+        case TLM_STATE:
+            if (len < TLM_STATE_LEN) break;
+            if (csv) printf("state,%.1f,%.1f,%.2f,%.2f,%u,%d\n", get32(p) / 10.0, get32(&p[4]) / 10.0,
+                            (int)get32(&p[8]) / 100.0, get16(&p[12]) / 100.0, get16(&p[14]), p[16]);
+            else printf("Time %.1f s, last sale %.1f s, balance %.2f$, credit %.2f$, temp ADC %u, servicing %d\n",
+                        get32(p) / 10.0, get32(&p[4]) / 10.0, (int)get32(&p[8]) / 100.0,
+                        get16(&p[12]) / 100.0, get16(&p[14]), p[16]);
+            return;
+
+        case TLM_SLOT:
+            if (len < TLM_SLOT_LEN) break;
+            memcpy(name, &p[1], TLM_NAME_LEN);
+            name[TLM_NAME_LEN] = '\0';
+            if (csv) printf("slot,%d,%s,%.2f,%d,%lu\n", p[0], name, get16(&p[9]) / 100.0,
+                            (short)get16(&p[11]), get32(&p[13]));
+            else printf("Slot %d %-8s price %.2f$ stock %d sold %lu\n", p[0], name, get16(&p[9]) / 100.0,
+                        (short)get16(&p[11]), get32(&p[13]));
+            return;
+
+        case TLM_SALE:
+            if (len < TLM_SALE_LEN) break;
+            if (csv) printf("sale,%u,%.1f,%d,%.2f\n", get16(p), get32(&p[2]) / 10.0, p[6], get16(&p[7]) / 100.0);
+            else printf("Sale %5u at %9.1f s slot %d %.2f$\n", get16(p), get32(&p[2]) / 10.0, p[6], get16(&p[7]) / 100.0);
+            return;
+
+        case TLM_AUDIT_END:
+            if (len < TLM_END_LEN) break;
+            if (csv) printf("end,%u,%lu,%lu\n", get16(p), get32(&p[2]), get32(&p[6]));
+            else printf("Audit end: %u frames, %lu bytes in %lu ms (target)\n", get16(p), get32(&p[2]), get32(&p[6]));
+            return;
+    }
+
+    fprintf(stderr, "Unknown frame 0x%02X, %d bytes\n", type, len);
+}
+
+/******************************************************************************
+ * Name:        decode
+ * Description: Feeds received bytes to the frame decoder. Resynchronises on
+ *              the next SYNC byte after a bad frame.
+ *  Parameters: - Decoder_t *d:             decoder state
+ *              - const unsigned char *buf: received bytes
+ *              - int n:                    number of bytes
+ *  Return:     - int:  type of the last good frame seen, 0 if none
+ *****************************************************************************/
+static int decode(Decoder_t *d, const unsigned char *buf, int n)
+{
+    int i, len, last = 0;
+    unsigned short crc;
+
+    for (i = 0; i < n; i++)
+    {
+        if (d->pos == 0 && buf[i] != TLM_SYNC)
+        {
+            d->skipped++;
+            continue;
+        }
+
+        d->frame[d->pos++] = buf[i];
+
+        if (d->pos == 2)
+        {
+            if (d->frame[1] > TLM_MAX_PAYLOAD)
+            {
+                d->pos = 0;
+                d->crcErrors++;
+                continue;
+            }
+            d->need = TLM_HDR_SIZE + d->frame[1] + TLM_CRC_SIZE;
+        }
+
+        if (d->pos < TLM_HDR_SIZE || d->pos < d->need) continue;
+
+        len = d->frame[1];
+        crc = usCrc16(CRC16_INIT, &d->frame[1], TLM_HDR_SIZE - 1 + len);
+        d->pos = 0;
+
+        if (crc != get16(&d->frame[TLM_HDR_SIZE + len]))
+        {
+            d->crcErrors++;
+            continue;
+        }
+
+        if (d->lastSeq >= 0) d->seqErrors += (unsigned char)(d->frame[3] - d->lastSeq - 1);
+        d->lastSeq = d->frame[3];
+        d->good++;
+
+        last = d->frame[2];
+        printFrame(last, &d->frame[TLM_HDR_SIZE], len);
+    }
+
+    return last;
+}
+
+/******************************************************************************
+ * Name:        speed
+ * Description: Converts a baud rate to a termios speed.
+ *****************************************************************************/
+static speed_t speed(unsigned long baud)
+{
+    switch (baud)
+    {
+        case 9600:   return B9600;
+        case 19200:  return B19200;
+        case 38400:  return B38400;
+        case 57600:  return B57600;
+        case 115200: return B115200;
+    }
+    return 0;
+}
+
+/******************************************************************************
+ * Name:        setBaud
+ * Description: Configures the serial port: raw 8N1, RTS/CTS, "baud".
+ *  Return:     - int:  0, or -1 on error
+ *****************************************************************************/
+static int setBaud(int fd, unsigned long baud)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) < 0) return -1;
+
+    cfmakeraw(&tio);
+    tio.c_cflag |= CRTSCTS | CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, speed(baud));
+    cfsetospeed(&tio, speed(baud));
+
+    return tcsetattr(fd, TCSADRAIN, &tio);
+}
+
+/******************************************************************************
+ * Name:        audit
+ * Description: Requests an audit streamed at "baud" and decodes it.
+ *  Return:     - int:  exit status
+ *****************************************************************************/
+static int audit(const char *dev, unsigned long baud, FILE *capture)
+{
+    unsigned char req[TLM_HDR_SIZE + TLM_REQ_AUDIT_LEN + TLM_CRC_SIZE], buf[256];
+    Decoder_t d = { .lastSeq = -1 };
+    unsigned long rxBytes = 0;
+    double start = 0, last;
+    unsigned short crc;
+    struct timeval tv;
+    fd_set fds;
+    int fd, n, type;
+
+    fd = open(dev, O_RDWR | O_NOCTTY);
+    if (fd < 0 || setBaud(fd, LINK_BAUD) < 0)
+    {
+        perror(dev);
+        return 1;
+    }
+    tcflush(fd, TCIOFLUSH);
+
+    req[0] = TLM_SYNC;
+    req[1] = TLM_REQ_AUDIT_LEN;
+    req[2] = TLM_REQ_AUDIT;
+    req[3] = 0;
+    req[4] = baud;
+    req[5] = baud >> 8;
+    req[6] = baud >> 16;
+    req[7] = baud >> 24;
+    crc = usCrc16(CRC16_INIT, &req[1], TLM_HDR_SIZE - 1 + TLM_REQ_AUDIT_LEN);
+    req[8] = crc;
+    req[9] = crc >> 8;
+
+    if (write(fd, req, sizeof(req)) != sizeof(req))
+    {
+        perror("write");
+        return 1;
+    }
+
+    last = now_ms();
+    while (!ended && now_ms() - last < RX_TIMEOUT_MS)
+    {
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        tv.tv_sec = 0;
+        tv.tv_usec = 100000;
+        if (select(fd + 1, &fds, NULL, NULL, &tv) <= 0) continue;
+
+        n = read(fd, buf, sizeof(buf));
+        if (n <= 0) continue;
+
+        last = now_ms();
+        if (capture) fwrite(buf, 1, n, capture);
+
+        if (start != 0) rxBytes += n;
+        type = decode(&d, buf, n);
+
+        // target switches baud rate right after the ACK
+        if (type == TLM_ACK && start == 0)
+        {
+            tcdrain(fd);
+            if (baud != LINK_BAUD && setBaud(fd, baud) < 0) perror("baud");
+            start = now_ms();
+        }
+        else if (type == TLM_NAK) break;
+    }
+
+    if (baud != LINK_BAUD) setBaud(fd, LINK_BAUD);
+    close(fd);
+
+    if (!ended)
+    {
+        fprintf(stderr, "Audit incomplete\n");
+        return 1;
+    }
+
+    // 10 bits per byte on the line (8N1)
+    last = now_ms() - start;
+    fprintf(stderr, "%lu bytes in %.0f ms: %.0f bytes/s, %.0f%% of the %lu baud line rate\n",
+            rxBytes, last, rxBytes * 1000.0 / last, rxBytes * 1000.0 / last * 10 * 100 / baud, baud);
+    fprintf(stderr, "%lu frames, %lu CRC errors, %lu missing, %lu bytes skipped\n",
+            d.good, d.crcErrors, d.seqErrors, d.skipped);
+
+    return d.crcErrors || d.seqErrors;
+}
+
+/******************************************************************************
+ * Name:        decodeFile
+ * Description: Decodes a capture saved with -o.
+ *  Return:     - int:  exit status
+ *****************************************************************************/
+static int decodeFile(const char *path)
+{
+    unsigned char buf[4096];
+    Decoder_t d = { .lastSeq = -1 };
+    FILE *f = fopen(path, "rb");
+    size_t n;
+
+    if (!f)
+    {
+        perror(path);
+        return 1;
+    }
+
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) decode(&d, buf, n);
+    fclose(f);
+
+    fprintf(stderr, "%lu frames, %lu CRC errors, %lu missing, %lu bytes skipped\n",
+            d.good, d.crcErrors, d.seqErrors, d.skipped);
+
+    return d.crcErrors || d.seqErrors;
+}
+
+/******************************************************************************
+ * Name:        bench
+ * Description: Decodes "count" synthetic TLM_SALE frames from memory and
+ *              reports the decoder speed against the fastest link rate.
+ *  Return:     - int:  exit status
+ *****************************************************************************/
+static int bench(unsigned long count)
+{
+    enum { FRAME = TLM_HDR_SIZE + TLM_SALE_LEN + TLM_CRC_SIZE };
+    unsigned char *buf = malloc(count * FRAME), *p;
+    Decoder_t d = { .lastSeq = -1 };
+    unsigned short crc;
+    unsigned long i;
+    double t;
+
+    if (!buf) return 1;
+
+    for (i = 0, p = buf; i < count; i++, p += FRAME)
+    {
+        p[0] = TLM_SYNC;
+        p[1] = TLM_SALE_LEN;
+        p[2] = TLM_SALE;
+        p[3] = i;
+        p[4] = i;
+        p[5] = i >> 8;
+        memset(&p[6], 0, 4);
+        p[6] = i;
+        p[10] = i % 4;
+        p[11] = 150 & 0xFF;
+        p[12] = 150 >> 8;
+        crc = usCrc16(CRC16_INIT, &p[1], TLM_HDR_SIZE - 1 + TLM_SALE_LEN);
+        p[13] = crc;
+        p[14] = crc >> 8;
+    }
+
+    quiet = 1;
+    t = now_ms();
+    decode(&d, buf, count * FRAME);
+    t = now_ms() - t;
+    free(buf);
+
+    printf("%lu frames (%lu bytes) in %.2f ms: %.1f MB/s, %.0fx the %lu baud line rate\n",
+           d.good, count * FRAME, t, count * FRAME / t / 1000.0,
+           count * FRAME / t * 1000.0 / (115200 / 10), 115200UL);
+
+    return d.good != count || d.crcErrors;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dev = "/dev/ttyUSB0", *file = NULL;
+    unsigned long baud = 115200;
+    FILE *capture = NULL;
+    int i, ret;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-c")) csv = 1;
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc) dev = argv[++i];
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc) baud = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) file = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+        {
+            capture = fopen(argv[++i], "wb");
+            if (!capture)
+            {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--bench") && i + 1 < argc) return bench(strtoul(argv[++i], NULL, 0));
+        else
+        {
+            fprintf(stderr, "usage: %s [-d dev] [-b baud] [-c] [-o capture] | -f capture [-c] | --bench N\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (file) return decodeFile(file);
+
+    if (!speed(baud))
+    {
+        fprintf(stderr, "Unsupported baud rate %lu\n", baud);
+        return 2;
+    }
+
+    ret = audit(dev, baud, capture);
+    if (capture) fclose(capture);
+
+    return ret;
+}
@@ -0,0 +1,583 @@
+/******************************************************************************
+ * File:        trace_host.c
+ * Description: Host (Linux) side of the kernel trace recorder. Gets a dump of
+ *              the recorder (trace_dump.h) from the vending machine over the
+ *              service port or from a file written by the simulator, prints
+ *              a summary and converts it to a Chrome/Perfetto trace (JSON),
+ *              to open in ui.perfetto.dev or chrome://tracing:
+ *
+ *              - one track per task, a slice each time it runs
+ *              - kernel events as instants on the track of the running task,
+ *                FromISR events on an "ISR" track
+ *              - the number of items of each queue as a counter
+ *              - the marks of the application as async slices
+ *
+ *              Build (from this directory):
+ *                  gcc -O2 -Wall -o trace_host trace_host.c
+ *
+ *              Usage:
+ *                  trace_host [-d /dev/ttyUSB0] [-w dump.bin] [-o trace.json]
+ *                      request a dump with TRACE_DUMP_KEY, -w saves it
+ *                  trace_host -f dump.bin [-o trace.json]
+ *                      convert a dump saved with -w or by "sim -r"
+ *
+ *              The port is opened at 9600 baud (COMM2_BAUD) with RTS/CTS
+ *              flow control. Without -o only the summary is printed.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created, dump version 1
+ *****************************************************************************/
+
+#define _GNU_SOURCE             // memmem()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/select.h>
+
+#include "../include/trace_dump.h"
+#include "../../../Source/include/trace_events.h"
+
+#define RX_TIMEOUT_MS   2000        // dump aborted after this much silence
+#define MAX_NAME        32          // longest object name kept
+#define MAX_EVENT       64          // event codes known, see trace_events.h
+
+// Event flags
+#define EV_ISR          0x01        // recorded from an interrupt, shown on the ISR track
+#define EV_QUEUE        0x02        // object is a queue, param is its number of items
+#define EV_ADD          0x04        // the queue gains an item
+#define EV_REMOVE       0x08        // the queue loses an item
+
+typedef struct
+{
+    const char *name;
+    int flags;
+
+} EventInfo_t;
+
+typedef struct
+{
+    int type;                   // traceobjectXXX
+    char name[MAX_NAME];        // given by the target, or made up from the type and ID
+
+} Object_t;
+
+typedef struct
+{
+    double us;                  // time since the first record
+    int event;
+    int object;
+    unsigned int param;
+
+} Record_t;
+
+typedef struct
+{
+    unsigned long hz;
+    unsigned long written;      // records written by the target since power up
+    unsigned long lostObjects;
+    int objects;
+    long records;
+    Object_t *obj;              // obj[0] stands for ID 0, unknown objects
+    Record_t *rec;
+
+} Trace_t;
+
+static const EventInfo_t events[MAX_EVENT] =
+{
+    [traceeventTASK_SWITCHED_IN]            = { "switched in", 0 },
+    [traceeventTASK_READY]                  = { "ready", 0 },
+    [traceeventTASK_DELAY]                  = { "delay", 0 },
+    [traceeventTASK_SUSPEND]                = { "suspend", 0 },
+    [traceeventTASK_RESUME]                 = { "resume", 0 },
+    [traceeventTASK_PRIORITY_SET]           = { "priority set", 0 },
+    [traceeventTASK_PRIORITY_INHERIT]       = { "priority inherit", 0 },
+    [traceeventTASK_PRIORITY_DISINHERIT]    = { "priority disinherit", 0 },
+    [traceeventTASK_DELETE]                 = { "delete", 0 },
+    [traceeventQUEUE_SEND]                  = { "send", EV_QUEUE | EV_ADD },
+    [traceeventQUEUE_SEND_FAILED]           = { "send failed", EV_QUEUE },
+    [traceeventQUEUE_RECEIVE]               = { "receive", EV_QUEUE | EV_REMOVE },
+    [traceeventQUEUE_RECEIVE_FAILED]        = { "receive failed", EV_QUEUE },
+    [traceeventQUEUE_PEEK]                  = { "peek", EV_QUEUE },
+    [traceeventQUEUE_BLOCK_ON_SEND]         = { "block on send", EV_QUEUE },
+    [traceeventQUEUE_BLOCK_ON_RECEIVE]      = { "block on receive", EV_QUEUE },
+    [traceeventQUEUE_SEND_FROM_ISR]         = { "send from ISR", EV_ISR | EV_QUEUE | EV_ADD },
+    [traceeventQUEUE_SEND_FROM_ISR_FAILED]  = { "send from ISR failed", EV_ISR | EV_QUEUE },
+    [traceeventQUEUE_RECEIVE_FROM_ISR]      = { "receive from ISR", EV_ISR | EV_QUEUE | EV_REMOVE },
+    [traceeventQUEUE_RECEIVE_FROM_ISR_FAILED] = { "receive from ISR failed", EV_ISR | EV_QUEUE },
+    [traceeventNOTIFY]                      = { "notify", 0 },
+    [traceeventNOTIFY_FROM_ISR]             = { "notify from ISR", EV_ISR },
+    [traceeventNOTIFY_WAIT_BLOCK]           = { "block on notification", 0 },
+    [traceeventNOTIFY_WAIT]                 = { "notification wait end", 0 },
+    [traceeventEVENT_GROUP_SET]             = { "set bits", 0 },
+    [traceeventEVENT_GROUP_SET_FROM_ISR]    = { "set bits from ISR", EV_ISR },
+    [traceeventEVENT_GROUP_WAIT_BLOCK]      = { "block on bits", 0 },
+    [traceeventEVENT_GROUP_WAIT_END]        = { "bits wait end", 0 },
+    [traceeventMARK_BEGIN]                  = { "begin", 0 },
+    [traceeventMARK_END]                    = { "end", 0 },
+    [traceeventMARK]                        = { "mark", 0 },
+};
+
+static const char *typeNames[] =
+{
+    "Object", "Task", "Queue", "Mutex", "CountingSemaphore", "BinarySemaphore",
+    "RecursiveMutex", "EventGroup", "Mark"
+};
+
+/******************************************************************************
+ * Name:        get16 / get32
+ * Description: Read a LSB first value from the dump.
+ *****************************************************************************/
+static unsigned int get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned long get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+/******************************************************************************
+ * Name:        now_ms
+ * Description: Monotonic time in ms.
+ *****************************************************************************/
+static double now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/******************************************************************************
+ * Name:        dumpSize
+ * Description: Size of the dump starting at "p", once its header is known.
+ *  Return:     - long: bytes, or -1 if the header is not a version 1 dump
+ *****************************************************************************/
+static long dumpSize(const unsigned char *p)
+{
+    if (memcmp(p, TRACE_DUMP_MAGIC, 4) != 0 || p[4] != TRACE_DUMP_VERSION) return -1;
+
+    return TRACE_DUMP_HDR_SIZE + p[5] * (1L + p[6]) + (long)get32(&p[16]) * TRACE_DUMP_REC_SIZE;
+}
+
+/******************************************************************************
+ * Name:        parse
+ * Description: Decodes a dump into "t": object names, and records with their
+ *              time stamps unwrapped and converted to us.
+ *  Return:     - int:  0, or -1 if the dump is not valid
+ *****************************************************************************/
+static int parse(Trace_t *t, const unsigned char *p, long len)
+{
+    unsigned long ticks, last = 0;
+    unsigned long long total = 0;
+    int i, nameLen, n;
+    long r;
+
+    if (len < TRACE_DUMP_HDR_SIZE || dumpSize(p) < 0 || dumpSize(p) > len)
+    {
+        fprintf(stderr, "Not a complete trace dump version %d\n", TRACE_DUMP_VERSION);
+        return -1;
+    }
+
+    t->objects = p[5];
+    nameLen = p[6];
+    t->hz = get32(&p[8]);
+    t->written = get32(&p[12]);
+    t->records = get32(&p[16]);
+    t->lostObjects = get16(&p[20]);
+    t->obj = calloc(t->objects + 1, sizeof(Object_t));
+    t->rec = calloc(t->records + 1, sizeof(Record_t));
+    if (!t->obj || !t->rec || t->hz == 0) return -1;
+
+    strcpy(t->obj[0].name, "?");
+    p += TRACE_DUMP_HDR_SIZE;
+
+    for (i = 1; i <= t->objects; i++)
+    {
+        t->obj[i].type = p[0];
+        n = nameLen < MAX_NAME - 1 ? nameLen : MAX_NAME - 1;
+        memcpy(t->obj[i].name, p + 1, n);       // calloc() gave the terminator
+        if (t->obj[i].name[0] == 0)
+        {
+            snprintf(t->obj[i].name, MAX_NAME, "%s#%d",
+                     typeNames[t->obj[i].type < (int)(sizeof(typeNames) / sizeof(typeNames[0])) ? t->obj[i].type : 0], i);
+        }
+        p += 1 + nameLen;
+    }
+
+    // time stamps wrap every 2^32 counts, records are never that far apart
+    for (r = 0; r < t->records; r++, p += TRACE_DUMP_REC_SIZE)
+    {
+        ticks = get32(p);
+        if (r > 0) total += (ticks - last) & 0xFFFFFFFFUL;
+        last = ticks;
+
+        t->rec[r].us = total * 1e6 / t->hz;
+        t->rec[r].event = p[4] < MAX_EVENT ? p[4] : 0;
+        t->rec[r].object = p[5] <= t->objects ? p[5] : 0;
+        t->rec[r].param = get16(&p[6]);
+    }
+
+    return 0;
+}
+
+/******************************************************************************
+ * Name:        putName
+ * Description: Writes an object name as a JSON string.
+ *****************************************************************************/
+static void putName(FILE *f, const char *prefix, const char *name)
+{
+    fputc('"', f);
+    if (prefix) fprintf(f, "%s ", prefix);
+    for (; *name; name++)
+    {
+        if (*name == '"' || *name == '\\') fputc('\\', f);
+        if ((unsigned char)*name >= ' ') fputc(*name, f);
+    }
+    fputc('"', f);
+}
+
+/******************************************************************************
+ * Name:        writeJson
+ * Description: Writes the trace in the Chrome trace event format, times in us.
+ *              The task running before the first switch is not known, its
+ *              events go to track 0 with those of the interrupts.
+ *  Return:     - int:  0, or -1 on error
+ *****************************************************************************/
+static int writeJson(const Trace_t *t, const char *path)
+{
+    const Object_t *o;
+    const Record_t *r;
+    double start = 0;
+    int running = 0, priority = 0, i, flags, tid;
+    long n;
+    FILE *f;
+
+    if ((f = fopen(path, "w")) == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"FreeRTOS\"}},\n");
+    fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ISR\"}}");
+
+    for (i = 1; i <= t->objects; i++)
+    {
+        if (t->obj[i].type != traceobjectTASK) continue;
+
+        fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", i);
+        putName(f, NULL, t->obj[i].name);
+        fprintf(f, "}}");
+    }
+
+    for (n = 0; n < t->records; n++)
+    {
+        r = &t->rec[n];
+        o = &t->obj[r->object];
+        flags = events[r->event].flags;
+        tid = (flags & EV_ISR) ? 0 : running;
+
+        switch (r->event)
+        {
+            case traceeventTASK_SWITCHED_IN:
+                if (running)
+                {
+                    fprintf(f, ",\n{\"name\":");
+                    putName(f, NULL, t->obj[running].name);
+                    fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"priority\":%d}}",
+                            running, start, r->us - start, priority);
+                }
+                running = r->object;
+                priority = r->param;
+                start = r->us;
+                break;
+
+            case traceeventMARK_BEGIN:
+            case traceeventMARK_END:
+                fprintf(f, ",\n{\"name\":");
+                putName(f, NULL, o->name);
+                fprintf(f, ",\"cat\":\"mark\",\"ph\":\"%s\",\"id\":%d,\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%u}}",
+                        r->event == traceeventMARK_BEGIN ? "b" : "e", r->object, tid, r->us, r->param);
+                break;
+
+            case 0:
+                break;      // unknown event
+
+            default:
+                fprintf(f, ",\n{\"name\":");
+                putName(f, events[r->event].name, o->name);
+                fprintf(f, ",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"param\":%u}}",
+                        tid, r->us, r->param);
+
+                if (flags & EV_QUEUE)
+                {
+                    fprintf(f, ",\n{\"name\":");
+                    putName(f, NULL, o->name);
+                    fprintf(f, ",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"items\":%d}}", r->us,
+                            (int)r->param + ((flags & EV_ADD) ? 1 : 0) - ((flags & EV_REMOVE) ? 1 : 0));
+                }
+                break;
+        }
+    }
+
+    // the task still running at the end of the trace
+    if (running && t->records > 0)
+    {
+        fprintf(f, ",\n{\"name\":");
+        putName(f, NULL, t->obj[running].name);
+        fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"priority\":%d}}",
+                running, start, t->rec[t->records - 1].us - start, priority);
+    }
+
+    fprintf(f, "\n]}\n");
+
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+/******************************************************************************
+ * Name:        summary
+ * Description: Prints the run time and switches of each task and the
+ *              durations of the marks.
+ *****************************************************************************/
+static void summary(const Trace_t *t)
+{
+    double *run, *begin, *min, *max, *sum, span, d;
+    long *switches, *count, n;
+    int running = 0, header = 0, i;
+    const Record_t *r;
+
+    run = calloc(t->objects + 1, sizeof(double));
+    begin = calloc(t->objects + 1, sizeof(double));
+    min = calloc(t->objects + 1, sizeof(double));
+    max = calloc(t->objects + 1, sizeof(double));
+    sum = calloc(t->objects + 1, sizeof(double));
+    switches = calloc(t->objects + 1, sizeof(long));
+    count = calloc(t->objects + 1, sizeof(long));
+    if (!run || !begin || !min || !max || !sum || !switches || !count) return;
+
+    span = t->records > 0 ? t->rec[t->records - 1].us : 0;
+
+    printf("%ld records over %.3f ms at %lu Hz, %lu older records overwritten",
+           t->records, span / 1000, t->hz, t->written - t->records);
+    if (t->lostObjects) printf(", %lu objects without an ID", t->lostObjects);
+    printf("\n");
+
+    for (i = 0; i <= t->objects; i++) begin[i] = -1;
+
+    for (n = 0; n < t->records; n++)
+    {
+        r = &t->rec[n];
+
+        if (r->event == traceeventTASK_SWITCHED_IN)
+        {
+            if (running) run[running] += r->us - begin[0];
+            running = r->object;
+            switches[running]++;
+            begin[0] = r->us;
+        }
+        else if (r->event == traceeventMARK_BEGIN && r->object)
+        {
+            begin[r->object] = r->us;
+        }
+        else if (r->event == traceeventMARK_END && r->object && begin[r->object] >= 0)
+        {
+            d = r->us - begin[r->object];
+            if (count[r->object] == 0 || d < min[r->object]) min[r->object] = d;
+            if (d > max[r->object]) max[r->object] = d;
+            sum[r->object] += d;
+            count[r->object]++;
+            begin[r->object] = -1;
+        }
+    }
+    if (running) run[running] += span - begin[0];
+
+    printf("\n%-16s %12s %7s %10s\n", "Task", "Run time ms", "%", "Switches");
+    for (i = 1; i <= t->objects; i++)
+    {
+        if (t->obj[i].type != traceobjectTASK) continue;
+
+        printf("%-16s %12.3f %6.2f%% %10ld\n", t->obj[i].name, run[i] / 1000,
+               span > 0 ? 100 * run[i] / span : 0.0, switches[i]);
+    }
+
+    for (i = 1; i <= t->objects; i++)
+    {
+        if (t->obj[i].type != traceobjectMARK || count[i] == 0) continue;
+
+        if (!header++) printf("\n%-16s %8s %10s %10s %10s\n", "Mark", "Count", "Min ms", "Avg ms", "Max ms");
+        printf("%-16s %8ld %10.3f %10.3f %10.3f\n", t->obj[i].name, count[i],
+               min[i] / 1000, sum[i] / count[i] / 1000, max[i] / 1000);
+    }
+
+    free(run); free(begin); free(min); free(max); free(sum); free(switches); free(count);
+}
+
+/******************************************************************************
+ * Name:        setPort
+ * Description: Configures the serial port: raw 8N1, RTS/CTS, 9600 baud.
+ *  Return:     - int:  0, or -1 on error
+ *****************************************************************************/
+static int setPort(int fd)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) < 0) return -1;
+
+    cfmakeraw(&tio);
+    tio.c_cflag |= CRTSCTS | CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, B9600);
+    cfsetospeed(&tio, B9600);
+
+    return tcsetattr(fd, TCSADRAIN, &tio);
+}
+
+/******************************************************************************
+ * Name:        request
+ * Description: Requests a dump on the service port and receives it, skipping
+ *              anything sent before its header.
+ *  Return:     - long: size of the dump in *buf, or -1 on error
+ *****************************************************************************/
+static long request(const char *dev, unsigned char **buf)
+{
+    long len = 0, size = 4096, need = -1, n;
+    char key = TRACE_DUMP_KEY;
+    unsigned char *p, *magic;
+    struct timeval tv;
+    double last;
+    fd_set fds;
+    int fd;
+
+    fd = open(dev, O_RDWR | O_NOCTTY);
+    if (fd < 0 || setPort(fd) < 0)
+    {
+        perror(dev);
+        return -1;
+    }
+    tcflush(fd, TCIOFLUSH);
+
+    if (write(fd, &key, 1) != 1 || (p = malloc(size)) == NULL)
+    {
+        perror("write");
+        return -1;
+    }
+
+    last = now_ms();
+    while ((need < 0 || len < need) && now_ms() - last < RX_TIMEOUT_MS)
+    {
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        tv.tv_sec = 0;
+        tv.tv_usec = 100000;
+        if (select(fd + 1, &fds, NULL, NULL, &tv) <= 0) continue;
+
+        if (len == size && (p = realloc(p, size *= 2)) == NULL) return -1;
+        n = read(fd, p + len, size - len);
+        if (n <= 0) continue;
+
+        last = now_ms();
+        len += n;
+
+        if (need < 0 && len >= TRACE_DUMP_HDR_SIZE)
+        {
+            // drop what came before the header
+            magic = memmem(p, len, TRACE_DUMP_MAGIC, 4);
+            if (magic == NULL) magic = p + len - 3;
+            len -= magic - p;
+            memmove(p, magic, len);
+            if (len >= TRACE_DUMP_HDR_SIZE) need = dumpSize(p);
+        }
+    }
+    close(fd);
+
+    if (need < 0 || len < need)
+    {
+        fprintf(stderr, "Dump incomplete, %ld bytes received\n", len);
+        return -1;
+    }
+
+    fprintf(stderr, "%ld bytes received\n", need);
+    *buf = p;
+    return need;
+}
+
+/******************************************************************************
+ * Name:        readFile
+ * Description: Reads a whole dump file.
+ *  Return:     - long: size of the dump in *buf, or -1 on error
+ *****************************************************************************/
+static long readFile(const char *path, unsigned char **buf)
+{
+    long len;
+    FILE *f;
+
+    if ((f = fopen(path, "rb")) == NULL || fseek(f, 0, SEEK_END) != 0 || (len = ftell(f)) < 0)
+    {
+        perror(path);
+        return -1;
+    }
+    rewind(f);
+
+    if ((*buf = malloc(len + 1)) == NULL || (long)fread(*buf, 1, len, f) != len)
+    {
+        perror(path);
+        return -1;
+    }
+    fclose(f);
+
+    return len;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dev = "/dev/ttyUSB0", *file = NULL, *json = NULL, *save = NULL;
+    Trace_t trace;
+    unsigned char *buf;
+    long len;
+    FILE *f;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-d") && i + 1 < argc) dev = argv[++i];
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) file = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) json = argv[++i];
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc) save = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [-d dev] [-w dump] [-o trace.json] | -f dump [-o trace.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    len = file ? readFile(file, &buf) : request(dev, &buf);
+    if (len < 0) return 1;
+
+    if (save)
+    {
+        if ((f = fopen(save, "wb")) == NULL || fwrite(buf, 1, len, f) != (size_t)len || fclose(f) != 0)
+        {
+            perror(save);
+            return 1;
+        }
+    }
+
+    if (parse(&trace, buf, len) < 0) return 1;
+
+    summary(&trace);
+
+    if (json && writeJson(&trace, json) < 0) return 1;
+
+    return 0;
+}
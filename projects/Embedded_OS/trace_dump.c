@@ -0,0 +1,114 @@
+/******************************************************************************
+ * File:        trace_dump.c
+ * Description: Sends the records and the object table of the kernel trace
+ *              recorder (see trace_dump.h for the format). Built with
+ *              configUSE_TRACE_RECORDER only, the same code sends the dump
+ *              on the target UART and writes it to a host file in the
+ *              simulator.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *****************************************************************************/
+
+#include <string.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "include/trace_dump.h"
+
+#if configUSE_TRACE_RECORDER == 1
+
+/******************************************************************************
+********************* Private static function declarations ********************
+******************************************************************************/
+
+static char *prvPut16(char *p, unsigned int val);
+static char *prvPut32(char *p, unsigned long val);
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        vTraceDump
+ * Description: Stops the recorder, sends the header, the object table and the
+ *              records, oldest first, then restarts the recorder if it was
+ *              running.
+ *  Parameters: - vPutBytes: called with each part of the dump
+ *  Return:     None
+ *****************************************************************************/
+void vTraceDump(void (*vPutBytes)(const char *buf, int len))
+{
+    char buf[TRACE_DUMP_HDR_SIZE], *p;
+    TraceRecorderInfo_t info;
+    TraceRecorderObject_t object;
+    TraceRecorderRecord_t record;
+    UBaseType_t i;
+
+    vTraceRecorderStop();
+    vTraceRecorderGetInfo(&info);
+
+    memcpy(buf, TRACE_DUMP_MAGIC, 4);
+    buf[4] = TRACE_DUMP_VERSION;
+    buf[5] = (char)info.uxObjects;
+    buf[6] = configTRACE_RECORDER_NAME_LEN;
+    buf[7] = 0;
+    p = prvPut32(&buf[8], TRACE_DUMP_HZ);
+    p = prvPut32(p, info.ulWritten);
+    p = prvPut32(p, info.uxRecords);
+    p = prvPut16(p, info.uxLostObjects);
+    prvPut16(p, 0);
+    vPutBytes(buf, TRACE_DUMP_HDR_SIZE);
+
+    for (i = 1; i <= info.uxObjects; i++)
+    {
+        xTraceRecorderGetObject(i, &object);
+        buf[0] = object.ucType;
+        vPutBytes(buf, 1);
+        vPutBytes(object.cName, configTRACE_RECORDER_NAME_LEN);
+    }
+
+    for (i = 0; i < info.uxRecords; i++)
+    {
+        xTraceRecorderGetRecord(i, &record);
+        p = prvPut32(buf, record.ulTimeStamp);
+        *p++ = record.ucEvent;
+        *p++ = record.ucObject;
+        prvPut16(p, record.usParam);
+        vPutBytes(buf, TRACE_DUMP_REC_SIZE);
+    }
+
+    if (info.xRecording != pdFALSE) vTraceRecorderStart();
+}
+
+/******************************************************************************
+**************************** Private static functions *************************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        prvPut16 / prvPut32
+ * Description: Store a value LSB first in a dump buffer.
+ *  Parameters: - char *p:  destination
+ *              - val:      value to store
+ *  Return:     - char *:   byte following the stored value
+ *****************************************************************************/
+static char *prvPut16(char *p, unsigned int val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    return p + 2;
+}
+
+static char *prvPut32(char *p, unsigned long val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    p[2] = val >> 16;
+    p[3] = val >> 24;
+    return p + 4;
+}
+
+#endif /* configUSE_TRACE_RECORDER */
@@ -0,0 +1,583 @@
+/******************************************************************************
+ * File:        uart.c
+ * Description: Interrupt driven UART driver, parameterised by port instance.
+ *              Every port owns its own RX stream buffer, TX ring buffer, baud
+ *              rate, flow control setting and statistics, so UART1 and UART2
+ *              can run concurrently (tech console, telemetry link, payment
+ *              peripherals).
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created driver for UART1 and UART2.
+ *                                              Replaces the hard-coded UART2 code
+ *                                              of COMM2.c and the RX ISR of vTaskTech.c
+ *   "      "       Oct 19 2026     v1.1.0  -   Added ulUartGetBaud()
+ *   "      "       Oct 19 2026     v1.2.0  -   RX path moved to a kernel stream buffer,
+ *                                              one write per interrupt instead of
+ *                                              one per char plus a semaphore give
+ *   "      "       Oct 19 2026     v1.3.0  -   RX stream buffer and TX semaphore created
+ *                                              statically in the port structure
+ *   "      "       Oct 19 2026     v1.4.0  -   Polled iUartWrite() before the scheduler
+ *                                              starts
+ *****************************************************************************/
+
+#include <string.h>
+#include <xc.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "../../Source/include/semphr.h"
+#include "../../Source/include/stream_buffer.h"
+#include "include/public.h"
+#include "include/uart.h"
+
+/*****************************************************************************/
+/*********************************** MACROS **********************************/
+/*****************************************************************************/
+
+// UxMODE bits
+#define U_UARTEN        0x8000      // enable the UART peripheral
+#define U_UEN_RTS_CTS   0x0200      // UEN = 10, UxTX, UxRX, UxCTS and UxRTS pins are used
+#define U_BRGH          0x0008      // high speed baud rate generator (4 clocks per bit)
+
+// UxSTA bits
+#define U_UTXEN         0x0400      // enable transmission
+#define U_UTXBF         0x0200      // TX FIFO full
+#define U_TRMT          0x0100      // TX shift register and FIFO empty
+#define U_PERR          0x0008      // parity error on the char at the top of the RX FIFO
+#define U_FERR          0x0004      // framing error on the char at the top of the RX FIFO
+#define U_OERR          0x0002      // RX FIFO overrun
+#define U_URXDA         0x0001      // RX FIFO has data
+
+#define TX_MASK     (UART_TX_BUFF_SIZE - 1)
+
+#if (UART_TX_BUFF_SIZE & TX_MASK)
+#error UART_TX_BUFF_SIZE must be a power of 2
+#endif
+
+#define RX_FIFO_DEPTH   4           // UxRXREG FIFO, chars gathered per stream buffer write
+
+// UART special function registers. UART1 and UART2 share the same layout,
+// starting at U1MODE and U2MODE respectively.
+typedef struct
+{
+    unsigned int MODE;
+    unsigned int STA;
+    unsigned int TXREG;
+    unsigned int RXREG;
+    unsigned int BRG;
+
+} UartRegs_t;
+
+// Driver state for one port. TX ring buffer indexes run freely and are masked
+// on access; the ISR only writes txTail and tasks only write txHead. The RX ISR
+// is the only writer of the RX stream buffer (see vUartInjectRx()).
+typedef struct
+{
+    volatile UartRegs_t *regs;
+
+    StreamBufferHandle_t xRxStream; // written by the RX ISR, wakes the reader on the first byte
+    StaticStreamBuffer_t xRxStreamBuffer;
+    uint8_t rxStorage[UART_RX_BUFF_SIZE + 1];   // a stream buffer keeps one byte free
+
+    char txBuff[UART_TX_BUFF_SIZE];
+    volatile unsigned int txHead, txTail;
+
+    xSemaphoreHandle xTxSem;    // given by the TX ISR when space is freed
+    StaticSemaphore_t xTxSemBuffer;
+
+    UartStats_t stats;
+    unsigned long baud;
+    char flowControl;
+    volatile char rxThrottled;  // RX interrupt held off until the stream buffer has room
+    char open;
+
+} Uart_t;
+
+static Uart_t uart[UART_PORT_COUNT];
+
+/******************************************************************************
+********************* Private static function declarations ********************
+******************************************************************************/
+
+static void prvSetRxInt(UartPort_t port, int enable);
+static void prvSetTxInt(UartPort_t port, int enable);
+static void prvKickTx(UartPort_t port);
+static void prvRxHandler(UartPort_t port);
+static void prvTxHandler(UartPort_t port);
+static unsigned int prvBrg(unsigned long baud);
+
+/******************************************************************************
+ * Name:        prvSetRxInt
+ * Description: Enables or disables the RX interrupt of a port.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - int enable:       1 to enable, 0 to disable
+ *  Return:     None
+ *****************************************************************************/
+static void prvSetRxInt(UartPort_t port, int enable)
+{
+    if (port == UART_PORT_1) _U1RXIE = enable;
+    else _U2RXIE = enable;
+}
+
+/******************************************************************************
+ * Name:        prvSetTxInt
+ * Description: Enables or disables the TX interrupt of a port.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - int enable:       1 to enable, 0 to disable
+ *  Return:     None
+ *****************************************************************************/
+static void prvSetTxInt(UartPort_t port, int enable)
+{
+    if (port == UART_PORT_1) _U1TXIE = enable;
+    else _U2TXIE = enable;
+}
+
+/******************************************************************************
+ * Name:        prvKickTx
+ * Description: Starts the TX interrupt chain after bytes were queued. The flag
+ *              is set by software so the ISR runs even if the TX FIFO drained
+ *              while the interrupt was disabled.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     None
+ *****************************************************************************/
+static void prvKickTx(UartPort_t port)
+{
+    taskENTER_CRITICAL();
+
+    if (port == UART_PORT_1)
+    {
+        if (!_U1TXIE) { _U1TXIF = 1; _U1TXIE = 1; }
+    }
+    else
+    {
+        if (!_U2TXIE) { _U2TXIF = 1; _U2TXIE = 1; }
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+/******************************************************************************
+ * Name:        prvBrg
+ * Description: Computes UxBRG for BRGH = 1, rounded to the nearest divisor.
+ *              UxBRG = Fcy / (4 * baud) - 1
+ *  Parameters: - unsigned long baud:   baud rate
+ *  Return:     - unsigned int:         UxBRG value
+ *****************************************************************************/
+static unsigned int prvBrg(unsigned long baud)
+{
+    return (unsigned int)(((configCPU_CLOCK_HZ / 4) + (baud / 2)) / baud - 1);
+}
+
+/******************************************************************************
+ * Name:        prvRxHandler
+ * Description: Common RX ISR body. Gathers the chars of the hardware FIFO and
+ *              writes them to the port's stream buffer in one call, which wakes
+ *              a reader blocked in iUartRead(). With flow control, a full
+ *              stream buffer holds the interrupt off so the hardware FIFO fills
+ *              and UxRTS is de-asserted.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     None
+ *****************************************************************************/
+static void prvRxHandler(UartPort_t port)
+{
+    Uart_t *u = &uart[port];
+    volatile UartRegs_t *regs = u->regs;
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+    char chunk[RX_FIFO_DEPTH];
+    unsigned int sta, space, level, n = 0;
+    char c;
+
+    // this ISR is the only writer, the space can only grow while it runs
+    space = xStreamBufferSpacesAvailable(u->xRxStream);
+
+    while ((sta = regs->STA) & U_URXDA)
+    {
+        // stream buffer full
+        if (n >= space)
+        {
+            if (u->flowControl == UART_FLOW_RTS_CTS)
+            {
+                u->rxThrottled = 1;
+                prvSetRxInt(port, 0);
+                break;
+            }
+
+            c = regs->RXREG;
+            u->stats.rxDropped++;
+            continue;
+        }
+
+        // error flags apply to the char at the top of the FIFO, so they are read before UxRXREG
+        c = regs->RXREG;
+
+        if (sta & U_FERR) { u->stats.framingErrors++; continue; }
+        if (sta & U_PERR) { u->stats.parityErrors++; continue; }
+
+        chunk[n++] = c;
+
+        // chars kept arriving while the FIFO was drained
+        if (n == RX_FIFO_DEPTH)
+        {
+            xStreamBufferSendFromISR(u->xRxStream, chunk, n, &xHigherPriorityTaskWoken);
+            u->stats.rxBytes += n;
+            space -= n;
+            n = 0;
+        }
+    }
+
+    if (n > 0)
+    {
+        xStreamBufferSendFromISR(u->xRxStream, chunk, n, &xHigherPriorityTaskWoken);
+        u->stats.rxBytes += n;
+    }
+
+    level = xStreamBufferBytesAvailable(u->xRxStream);
+    if (level > u->stats.rxHighWater) u->stats.rxHighWater = level;
+
+    // clearing OERR resets the FIFO, so it is only done once the FIFO was drained
+    if (regs->STA & U_OERR)
+    {
+        regs->STA &= ~U_OERR;
+        u->stats.overruns++;
+    }
+
+    if (xHigherPriorityTaskWoken != pdFALSE) taskYIELD();
+}
+
+/******************************************************************************
+ * Name:        prvTxHandler
+ * Description: Common TX ISR body. Fills the hardware FIFO from the ring buffer
+ *              and disables the interrupt once the ring buffer is empty.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     None
+ *****************************************************************************/
+static void prvTxHandler(UartPort_t port)
+{
+    Uart_t *u = &uart[port];
+    volatile UartRegs_t *regs = u->regs;
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+    char freed = 0;
+
+    while (!(regs->STA & U_UTXBF) && u->txTail != u->txHead)
+    {
+        regs->TXREG = u->txBuff[u->txTail & TX_MASK];
+        u->txTail++;
+        u->stats.txBytes++;
+        freed = 1;
+    }
+
+    if (u->txTail == u->txHead) prvSetTxInt(port, 0);
+
+    if (freed) xSemaphoreGiveFromISR(u->xTxSem, &xHigherPriorityTaskWoken);
+
+    if (xHigherPriorityTaskWoken != pdFALSE) taskYIELD();
+}
+
+/******************************************************************************
+ * Name:        _U1RXInterrupt / _U2RXInterrupt / _U1TXInterrupt / _U2TXInterrupt
+ * Description: UART ISRs, forward to the common handlers.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void _ISR_NO_PSV _U1RXInterrupt(void)
+{
+    _U1RXIF = 0;
+    prvRxHandler(UART_PORT_1);
+}
+
+void _ISR_NO_PSV _U2RXInterrupt(void)
+{
+    _U2RXIF = 0;
+    prvRxHandler(UART_PORT_2);
+}
+
+void _ISR_NO_PSV _U1TXInterrupt(void)
+{
+    _U1TXIF = 0;
+    prvTxHandler(UART_PORT_1);
+}
+
+void _ISR_NO_PSV _U2TXInterrupt(void)
+{
+    _U2TXIF = 0;
+    prvTxHandler(UART_PORT_2);
+}
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        iUartOpen
+ * Description: Configures a port and enables its RX/TX interrupts. Must be called
+ *              before the port is used, normally from main() before the scheduler
+ *              starts. Interrupts run at configKERNEL_INTERRUPT_PRIORITY so the
+ *              ISRs may use the FreeRTOS FromISR API.
+ *  Parameters: - UartPort_t port:              UART instance
+ *              - const UartConfig_t *config:   baud rate and flow control
+ *  Return:     - int:  UART_OK, UART_ERR_PORT or UART_ERR_BAUD
+ *****************************************************************************/
+int iUartOpen(UartPort_t port, const UartConfig_t *config)
+{
+    Uart_t *u;
+
+    if (port >= UART_PORT_COUNT) return UART_ERR_PORT;
+    if (config->baud == 0 || config->baud > UART_MAX_BAUD) return UART_ERR_BAUD;
+
+    u = &uart[port];
+    u->regs = (volatile UartRegs_t *)((port == UART_PORT_1) ? &U1MODE : &U2MODE);
+
+    // kernel objects are only created once, a port can be re-opened with new settings
+    if (u->xRxStream == NULL) u->xRxStream = xStreamBufferCreateStatic(UART_RX_BUFF_SIZE, 1, u->rxStorage, &u->xRxStreamBuffer);
+    if (u->xTxSem == NULL) u->xTxSem = xSemaphoreCreateBinaryStatic(&u->xTxSemBuffer);
+
+    prvSetRxInt(port, 0);
+    prvSetTxInt(port, 0);
+
+    xStreamBufferReset(u->xRxStream);
+    u->txHead = u->txTail = 0;
+    u->rxThrottled = 0;
+    u->flowControl = config->flowControl;
+    u->baud = config->baud;
+    memset(&u->stats, 0, sizeof(u->stats));
+
+    u->regs->MODE = 0;
+    u->regs->BRG = prvBrg(config->baud);
+    u->regs->MODE = U_UARTEN | U_BRGH | ((config->flowControl == UART_FLOW_RTS_CTS) ? U_UEN_RTS_CTS : 0);
+    u->regs->STA = U_UTXEN;     // UTXISEL = 00 and URXISEL = 00: interrupt on every char
+
+    if (port == UART_PORT_1)
+    {
+        _U1RXIP = configKERNEL_INTERRUPT_PRIORITY;
+        _U1TXIP = configKERNEL_INTERRUPT_PRIORITY;
+        _U1RXIF = 0;
+        _U1TXIF = 0;
+    }
+    else
+    {
+        _U2RXIP = configKERNEL_INTERRUPT_PRIORITY;
+        _U2TXIP = configKERNEL_INTERRUPT_PRIORITY;
+        _U2RXIF = 0;
+        _U2TXIF = 0;
+    }
+
+    u->open = 1;
+    prvSetRxInt(port, 1);       // TX interrupt is enabled on demand by prvKickTx()
+
+    return UART_OK;
+}
+
+/******************************************************************************
+ * Name:        iUartSetBaud
+ * Description: Changes the baud rate of an open port at run time. Waits for the
+ *              TX ring buffer and shift register to drain so no byte is sent
+ *              at a mixed rate.
+ *  Parameters: - UartPort_t port:      UART instance
+ *              - unsigned long baud:   new baud rate, up to UART_MAX_BAUD
+ *  Return:     - int:  UART_OK, UART_ERR_PORT or UART_ERR_BAUD
+ *****************************************************************************/
+int iUartSetBaud(UartPort_t port, unsigned long baud)
+{
+    Uart_t *u;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+    if (baud == 0 || baud > UART_MAX_BAUD) return UART_ERR_BAUD;
+
+    u = &uart[port];
+
+    while (u->txTail != u->txHead || !(u->regs->STA & U_TRMT))
+    {
+        if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) vTaskDelay(1);
+    }
+
+    taskENTER_CRITICAL();
+    u->regs->BRG = prvBrg(baud);
+    u->baud = baud;
+    taskEXIT_CRITICAL();
+
+    return UART_OK;
+}
+
+/******************************************************************************
+ * Name:        ulUartGetBaud
+ * Description: Returns the baud rate a port is running at.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     - unsigned long:    baud rate, 0 if the port is not open
+ *****************************************************************************/
+unsigned long ulUartGetBaud(UartPort_t port)
+{
+    if (port >= UART_PORT_COUNT || !uart[port].open) return 0;
+
+    return uart[port].baud;
+}
+
+/******************************************************************************
+ * Name:        iUartWrite
+ * Description: Queues "len" bytes for transmission. Blocks while the TX ring
+ *              buffer is full. Bytes written by different tasks to the same
+ *              port are not kept together, one task should own each port.
+ *              Before the scheduler starts the bytes are written to UxTXREG
+ *              by polling instead: the IPL stays raised from the first task
+ *              creation (uxCriticalNesting starts non zero), the TX interrupt
+ *              could not drain the ring buffer.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *buf:  bytes to send
+ *              - int len:          number of bytes
+ *  Return:     - int:  number of bytes queued, or UART_ERR_PORT
+ *****************************************************************************/
+int iUartWrite(UartPort_t port, const char *buf, int len)
+{
+    Uart_t *u;
+    int i;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+
+    u = &uart[port];
+
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+    {
+        for (i = 0; i < len; i++)
+        {
+            while (u->regs->STA & U_UTXBF);     // TX FIFO full
+            u->regs->TXREG = buf[i];
+            u->stats.txBytes++;
+        }
+
+        return len;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        // ring buffer full, let the ISR drain it
+        while ((unsigned int)(u->txHead - u->txTail) >= UART_TX_BUFF_SIZE)
+        {
+            prvKickTx(port);
+            if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) xSemaphoreTake(u->xTxSem, portMAX_DELAY);
+        }
+
+        u->txBuff[u->txHead & TX_MASK] = buf[i];
+        u->txHead++;
+    }
+
+    prvKickTx(port);
+
+    return len;
+}
+
+/******************************************************************************
+ * Name:        vUartPutc
+ * Description: Queues a single char for transmission.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - char c:           char to send
+ *  Return:     None
+ *****************************************************************************/
+void vUartPutc(UartPort_t port, char c)
+{
+    iUartWrite(port, &c, 1);
+}
+
+/******************************************************************************
+ * Name:        vUartPuts
+ * Description: Queues a null terminated string for transmission.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *str:  string to send
+ *  Return:     None
+ *****************************************************************************/
+void vUartPuts(UartPort_t port, const char *str)
+{
+    iUartWrite(port, str, strlen(str));
+}
+
+/******************************************************************************
+ * Name:        iUartRead
+ * Description: Reads up to "len" received bytes. Blocks up to xTicksToWait for
+ *              the first byte, then returns whatever is available.
+ *  Parameters: - UartPort_t port:          UART instance
+ *              - char *buf:                destination buffer
+ *              - int len:                  maximum number of bytes to read
+ *              - TickType_t xTicksToWait:  block time if no byte is available
+ *  Return:     - int:  number of bytes read (0 on timeout), or UART_ERR_PORT
+ *****************************************************************************/
+int iUartRead(UartPort_t port, char *buf, int len, TickType_t xTicksToWait)
+{
+    Uart_t *u;
+    int n;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+
+    u = &uart[port];
+
+    n = xStreamBufferReceive(u->xRxStream, buf, len, xTicksToWait);
+
+    // room was made, let the ISR drain the hardware FIFO again
+    if (u->rxThrottled)
+    {
+        taskENTER_CRITICAL();
+        u->rxThrottled = 0;
+        prvSetRxInt(port, 1);
+        taskEXIT_CRITICAL();
+    }
+
+    return n;
+}
+
+/******************************************************************************
+ * Name:        iUartGetc
+ * Description: Reads a single received char.
+ *  Parameters: - UartPort_t port:          UART instance
+ *              - char *c:                  destination
+ *              - TickType_t xTicksToWait:  block time if no char is available
+ *  Return:     - int:  1 if a char was read, 0 on timeout, or UART_ERR_PORT
+ *****************************************************************************/
+int iUartGetc(UartPort_t port, char *c, TickType_t xTicksToWait)
+{
+    return iUartRead(port, c, 1, xTicksToWait);
+}
+
+/******************************************************************************
+ * Name:        vUartInjectRx
+ * Description: Places bytes in the RX stream buffer as if they had been received.
+ *              The RX interrupt is held off so injected sequences are never
+ *              interleaved with received chars, and the ISR and this function
+ *              are never writing to the stream buffer at the same time. Bytes
+ *              that do not fit are dropped.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *buf:  bytes to inject
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+void vUartInjectRx(UartPort_t port, const char *buf, int len)
+{
+    Uart_t *u;
+    int n;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return;
+
+    u = &uart[port];
+
+    prvSetRxInt(port, 0);
+
+    n = xStreamBufferSend(u->xRxStream, buf, len, 0);
+    u->stats.rxDropped += len - n;
+
+    if (!u->rxThrottled) prvSetRxInt(port, 1);
+}
+
+/******************************************************************************
+ * Name:        vUartGetStats
+ * Description: Copies the statistics of a port.
+ *  Parameters: - UartPort_t port:      UART instance
+ *              - UartStats_t *stats:   destination
+ *  Return:     None
+ *****************************************************************************/
+void vUartGetStats(UartPort_t port, UartStats_t *stats)
+{
+    if (port >= UART_PORT_COUNT) return;
+
+    taskENTER_CRITICAL();
+    *stats = uart[port].stats;
+    taskEXIT_CRITICAL();
+}
@@ -10,6 +10,7 @@
  *   "      "       Mar 11 2019     v1.1.0  -   Renamed task to vTaskPollPBs
  *   "      "       Mar 21 2019     v1.2.0  -   Renamed task to vTaskPoll
  *   "      "       May 14 2019     v1.2.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v1.3.0  -   vTaskPoll created statically
  *****************************************************************************/
 
 #include <string.h>
@@ -25,6 +26,10 @@
 #include "include/public.h"
 #include "include/Tick4.h"
 
+// vTaskPoll stack and TCB
+static StackType_t xTaskPollStack[POLL_TASK_STACK];
+static StaticTask_t xTaskPollTCB;
+
 /******************************************************************************
 ********************* Private static function declarations ********************
 ******************************************************************************/
@@ -115,16 +120,17 @@ static void vTaskPoll( void *pvParameters )
 
 /******************************************************************************
  * Name:        vTaskPoll
- * Description: Calls vTaskCreate() to create vTaskPoll.
+ * Description: Calls xTaskCreateStatic() to create vTaskPoll.
  *  Parameters: None
  *  Return:     None
  *****************************************************************************/
 void vStartTaskPoll(void)
 {
-     xTaskCreate(	vTaskPoll,                  /* Pointer to the function that implements the task. */
+     xTaskCreateStatic(	vTaskPoll,                  /* Pointer to the function that implements the task. */
 					( char * ) "vTaskPoll",     /* Text name for the task.  This is to facilitate debugging only. */
-					240,                        /* Stack depth in words. */
+					POLL_TASK_STACK,            /* Stack depth in words. */
 					NULL,                       /* We are not using the task parameter. */
 					POLL_TASK_PRIORITY,         /* This task will run at specified priority. */
-					NULL );                     /* We are not using the task handle. */
+					xTaskPollStack,             /* Stack of the task. */
+					&xTaskPollTCB );            /* TCB of the task, the handle is not used. */
 }
\ No newline at end of file
@@ -20,6 +20,17 @@
  *   "      "       Apr 08 2019     v1.5.0  -   vTechTask done
  *   "      "       Apr 16 2019     v2.0.0  -   Implemented saving in EEPROM NVM
  *   "      "       May 14 2019     v2.0.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v2.1.0  -   Moved UART2 RX ISR to the uart.c driver,
+ *                                              xQueueTech replaced by the driver's RX buffer
+ *                                          -   Serves binary telemetry requests (telemetry.c)
+ *   "      "       Oct 19 2026     v2.1.1  -   Fixed txtBuff overflows in vTaskTech(),
+ *                                              xyPutString() and printInfo() found by
+ *                                              the host build
+ *   "      "       Oct 19 2026     v2.2.0  -   vTaskTech created statically
+ *   "      "       Oct 19 2026     v2.3.0  -   Ctrl-R prints the critical section profiler
+ *                                              report (CRIT_PROFILER)
+ *   "      "       Oct 19 2026     v2.4.0  -   Ctrl-T sends the trace recorder dump
+ *                                              (TRACE_RECORDER)
  *****************************************************************************/
 
 #include <string.h>
@@ -35,9 +46,15 @@
 #include "include/public.h"
 #include "include/Tick4.h"
 #include "include/COMM2.h"
+#include "include/uart.h"
+#include "include/tlm_protocol.h"
+#include "include/telemetry.h"
+#include "include/crit_report.h"
+#include "include/trace_dump.h"
 
-// Local Queue for storing incoming characters from UART RX ISR
-static xQueueHandle xQueueTech;
+// vTaskTech stack and TCB
+static StackType_t xTaskTechStack[TECH_TASK_STACK];
+static StaticTask_t xTaskTechTCB;
 
 /******************************************************************************
 ************************ Private function declarations ************************
@@ -48,28 +65,12 @@ static void printBorder(void);
 static void printInfo(char mode);
 static void updateMode(void);
 static void clearMsg(void);
-
-/******************************************************************************
- * Name:        _U2XInterrupt
- * Description: UART2 Rx ISR.
- *  Parameters: None
- *  Return:     None
- *****************************************************************************/
-void _ISR_NO_PSV _U2RXInterrupt(void)
-{
-    char cChar;
-
-	/* Get the character and post it on the queue of Rxed characters.
-	If the post causes a task to wake force a context switch as the woken task
-	may have a higher priority than the task we have interrupted. */
-	while( U2STAbits.URXDA )
-	{
-		cChar = U2RXREG;
-        xQueueSendFromISR(xQueueTech, &cChar, 0);
-	}
-
-    IFS1bits.U2RXIF = 0;
-}
+#if configUSE_CRITICAL_PROFILER == 1
+static void putReportLine(const char *line);
+#endif
+#if configUSE_TRACE_RECORDER == 1
+static void putTraceBytes(const char *buf, int len);
+#endif
 
 /******************************************************************************
  * Name:        vTaskTech
@@ -91,9 +92,9 @@ static void vTaskTech( void *pvParameters )
     /* Local Variables */
     VendingMachine_t temp;      // temporary variable for mutex-protected Vending Machine Data from vTaskUI
     
-    char    rxChar,                 // stores a char received from xQueueTech
+    char    rxChar,                 // stores a char received from the UART2 RX buffer
             rxBuff[SIZE_RX_BUFF],   // array to store consecutive rxChar values and build a string
-            txtBuff[16],            // string buffer for output to TeraTerm
+            txtBuff[48],            // string buffer for output to TeraTerm
             mode = MODE_HOME,       // stores the current mode of the Tech Servicing State Machine
             lastmode = 0;           // stores the last mode of the State machine
     
@@ -110,8 +111,33 @@ static void vTaskTech( void *pvParameters )
     
     for ( ;; )
     {
-        /* Block and wait to receive a char from the xQueueTech, filled by UART Rx interrupt */
-        xQueueReceive(xQueueTech, &rxChar, portMAX_DELAY);
+        /* Block and wait to receive a char from the UART2 RX buffer, filled by UART Rx interrupt */
+        iUartGetc(COMM2_PORT, &rxChar, portMAX_DELAY);
+
+        // binary telemetry request from a host tool, served without entering servicing mode
+        if ((unsigned char)rxChar == TLM_SYNC)
+        {
+            iTelemRequest(COMM2_PORT);
+            continue;
+        }
+
+#if configUSE_CRITICAL_PROFILER == 1
+        // critical section profiler report, also served without entering servicing mode
+        if (rxChar == CRIT_REPORT_KEY)
+        {
+            vCritReport(putReportLine);
+            continue;
+        }
+#endif
+
+#if configUSE_TRACE_RECORDER == 1
+        // binary trace recorder dump for tools/trace_host, also served without entering servicing mode
+        if (rxChar == TRACE_DUMP_KEY)
+        {
+            vTraceDump(putTraceBytes);
+            continue;
+        }
+#endif
 
         // if startFlag is not set, initializes the tech servicing menu interface on first loop
         if (!startFlag)
@@ -128,12 +154,11 @@ static void vTaskTech( void *pvParameters )
             i = 0;              // reset rxBuff index
             rxBuff[i] = '\0';   // reset rxBuff index by storing null byte in first element
             
-            rxChar = '\r';                          // 
-            xQueueSend(xQueueTech, &rxChar, 0);     // sends return char to refresh menu info
+            vUartInjectRx(COMM2_PORT, "\r", 1);    // sends return char to refresh menu info
         }
         else
         {
-            /* Switch case for char received by xQueueTech */
+            /* Switch case for char received from the UART2 RX buffer */
             switch (rxChar)
             {
                 // default case will accept any char and if it is between 0-9, A-Z, a-z, or a '.' will be stored in rxBuff array
@@ -313,7 +338,7 @@ static void vTaskTech( void *pvParameters )
                                         xyPutString(48, 13, "machine. When finished, press");
                                         xyPutString(48, 14, "any key to continue.");
 
-                                        xQueueReceive(xQueueTech, &rxChar, portMAX_DELAY);  // block and wait for user input
+                                        iUartGetc(COMM2_PORT, &rxChar, portMAX_DELAY);  // block and wait for user input
 
                                         vSetVM(0, EMPTY_BALANCE, 0);    // clear balance from VendingMachine data struct from vTaskUI
 
@@ -393,7 +418,7 @@ static void vTaskTech( void *pvParameters )
                                             xyPutString(48, 16, "changes");
                                             xyPutString(48, 18, "");
 
-                                            xQueueReceive(xQueueTech, &rxChar, portMAX_DELAY);  // blocks and waits for confirmation
+                                            iUartGetc(COMM2_PORT, &rxChar, portMAX_DELAY);  // blocks and waits for confirmation
 
                                             // if yes
                                             if (rxChar == 'Y' || rxChar == 'y')
@@ -470,7 +495,7 @@ static void vTaskTech( void *pvParameters )
                                             xyPutString(48, 16, "changes");
                                             xyPutString(48, 18, "");
 
-                                            xQueueReceive(xQueueTech, &rxChar, portMAX_DELAY);  // blocks and waits for confirmation
+                                            iUartGetc(COMM2_PORT, &rxChar, portMAX_DELAY);  // blocks and waits for confirmation
 
                                             // if yes, updates stock 
                                             if (rxChar == 'Y' || rxChar == 'y')
@@ -531,8 +556,8 @@ static void vTaskTech( void *pvParameters )
  *****************************************************************************/
 static void xyPutString(int x, int y, char* str)
 {
-    // buffer for 
-    char txtBuff[8];
+    // buffer for the cursor move code, "\033[yyy;xxxH"
+    char txtBuff[20];
     
     // VT100 Escape code character "\033" followed by move cursor command code "[Y;XH"
     sprintf(txtBuff, "\033[%d;%dH", y, x);
@@ -580,7 +605,7 @@ static void printBorder(void)
 static void printInfo(char mode)
 {
     int i;                      // counter variable for for() loops
-    char txtBuff[8];            // string buffer to print to terminal
+    char txtBuff[32];           // string buffer to print to terminal
     VendingMachine_t temp;      // temporary variable for mutex-protected Vending Machine Data from vTaskUI
     
     xyPutString(3, 3, "Explorer 16/32 Vending Machine Service App - by Samson Kaller");
@@ -716,16 +741,9 @@ static void printInfo(char mode)
  *****************************************************************************/
 static void updateMode(void)
 {
-    char rx;        // variable to add to queue
-    
-    _U2RXIE = 0;    // disable UART RX interrupt (this would disrupt updateMode operation if a char is transmitted between 0x7F and '\r')
-    
-    rx = 0x7F;
-    xQueueSendFromISR(xQueueTech, &rx, 0);  // send delete char to queue (0x7F)
-    rx = '\r';
-    xQueueSendFromISR(xQueueTech, &rx, 0);  // send '\r' char to queue
-    
-    _U2RXIE = 1;    // re-enable UART RX interrupt
+    // send delete char (0x7F) followed by '\r' to the RX buffer. The driver holds off the
+    // RX interrupt so a received char can't be placed between the two
+    vUartInjectRx(COMM2_PORT, "\x7F\r", 2);
 }
 
 /******************************************************************************
@@ -746,21 +764,47 @@ static void clearMsg(void)
 *************************** Public function declarations **********************
 ******************************************************************************/
 
+#if configUSE_CRITICAL_PROFILER == 1
+/******************************************************************************
+ * Name:        putReportLine
+ * Description: Output of the critical section profiler report, on COMM2_PORT.
+ *  Parameters: - const char *line: report line without end of line
+ *  Return:     None
+ *****************************************************************************/
+static void putReportLine(const char *line)
+{
+    vUartPuts(COMM2_PORT, line);
+    vUartPuts(COMM2_PORT, "\r\n");
+}
+#endif
+
+#if configUSE_TRACE_RECORDER == 1
+/******************************************************************************
+ * Name:        putTraceBytes
+ * Description: Output of the trace recorder dump, on COMM2_PORT.
+ *  Parameters: - const char *buf:  part of the dump
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+static void putTraceBytes(const char *buf, int len)
+{
+    iUartWrite(COMM2_PORT, buf, len);
+}
+#endif
+
 /******************************************************************************
  * Name:        vStartTaskTech
- * Description: Calls vTaskCreate() to create vTaskTech.
+ * Description: Calls xTaskCreateStatic() to create vTaskTech.
  *  Parameters: None
  *  Return:     None
  *****************************************************************************/
 void vStartTaskTech(void)
 {
-    xTaskCreate(	vTaskTech,              /* Pointer to the function that implements the task. */
+    xTaskCreateStatic(	vTaskTech,              /* Pointer to the function that implements the task. */
 					( char * ) "vTaskTech", /* Text name for the task.  This is to facilitate debugging only. */
-					700,                    /* Stack depth in words. */
+					TECH_TASK_STACK,        /* Stack depth in words. */
 					NULL,                   /* We are not using the task parameter. */
 					TECH_TASK_PRIORITY,     /* This task will run at specified priority. */
-					NULL );                 /* We are not using the task handle. */
-    
-    // Create xQueueTech Queue. Length is 16 chars
-    xQueueTech = xQueueCreate(16, sizeof(char));
+					xTaskTechStack,         /* Stack of the task. */
+					&xTaskTechTCB );        /* TCB of the task, the handle is not used. */
 }
\ No newline at end of file
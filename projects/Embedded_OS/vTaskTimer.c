@@ -8,6 +8,7 @@
  * Samson Kaller    Feb 25 2019     v1.0.0  -   Created vTaskTimer for dedicated
  *                                              timer functionality
  *   "      "       May 14 2019     v1.0.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v1.1.0  -   vTaskTimer created statically
  *****************************************************************************/
 
 #include <string.h>
@@ -23,6 +24,10 @@
 #include "include/public.h"
 #include "include/Tick4.h"
 
+// vTaskTimer stack and TCB
+static StackType_t xTaskTimerStack[TIMER_TASK_STACK];
+static StaticTask_t xTaskTimerTCB;
+
 /******************************************************************************
 ********************* Private static function declarations ********************
 ******************************************************************************/
@@ -59,16 +64,17 @@ static void vTaskTimer( void *pvParameters )
 
 /******************************************************************************
  * Name:        vTaskTimer
- * Description: Calls vTaskCreate() to create vTaskPoll.
+ * Description: Calls xTaskCreateStatic() to create vTaskTimer.
  *  Parameters: None
  *  Return:     None
  *****************************************************************************/
 void vStartTaskTimer(void)
 {
-     xTaskCreate(	vTaskTimer,                 /* Pointer to the function that implements the task. */
+     xTaskCreateStatic(	vTaskTimer,                 /* Pointer to the function that implements the task. */
 					( char * ) "vTaskTimer",    /* Text name for the task.  This is to facilitate debugging only. */
-					240,                        /* Stack depth in words. */
+					TIMER_TASK_STACK,           /* Stack depth in words. */
 					NULL,                       /* We are not using the task parameter. */
 					TIMER_TASK_PRIORITY,        /* This task will run at specified priority. */
-					NULL );                     /* We are not using the task handle. */
+					xTaskTimerStack,            /* Stack of the task. */
+					&xTaskTimerTCB );           /* TCB of the task, the handle is not used. */
 }
\ No newline at end of file
@@ -22,6 +22,15 @@
  *                                          -   Created vSaveEEPROM()
  *                                          -   Created vGetEEPROM()
  *   "      "       May 14 2019     v2.0.1  -   Added comments for Vending Machine Project
+ *   "      "       Oct 19 2026     v2.1.0  -   Added sold counters and NVM sales log,
+ *                                              vLogSale() and iGetSale()
+ *   "      "       Oct 19 2026     v2.2.0  -   vTaskUI, xQueueUI and xMutexVM created
+ *                                              statically
+ *   "      "       Oct 19 2026     v2.3.0  -   xQueueUI and xMutexVM in the queue registry,
+ *                                              vend marks for the trace recorder
+ *   "      "       Oct 19 2026     v2.4.0  -   xMutexVM is a priority ceiling mutex
+ *   "      "       Oct 19 2026     v2.4.1  -   xMutexVM back to priority inheritance, it is
+ *                                              held for NVM writes
  *****************************************************************************/
 
 #include <string.h>
@@ -41,31 +50,53 @@
  * includes stock count as well as their name and prices, starting balance, credit,
  * current time, last transaction time, and a flag for if Tech Servicing task is running
  */
-                                                // Name - Cost - Stock
+                                                // Name - Cost - Stock - Sold
 static VendingMachine_t vendMachine =   {   {   
-                                                { "BEER",   0,     0 },
-                                                { "MILK",   0,     0 },
-                                                { "ICET",   0,     0 },
-                                                { "COKE",   0,     0 }
+                                                { "BEER",   0,     0,     0 },
+                                                { "MILK",   0,     0,     0 },
+                                                { "ICET",   0,     0,     0 },
+                                                { "COKE",   0,     0,     0 }
                                             },
                                             0,  // Starting balance
                                             0,  // Starting credit
                                             0,  // Time (seconds)
                                             0,  // Last Transaction time
-                                            0   // Servicing Flag
+                                            0,  // Servicing Flag
+                                            0   // Sales log record count
                                         };
 
+// index of the next record to write in the NVM sales log
+static unsigned int salesHead;
+
 // local queue for storing char data incoming to vTaskUI
 static xQueueHandle xQueueUI;
+static StaticQueue_t xQueueUIBuffer;
+static uint8_t ucQueueUIStorage[4 * sizeof(char)];
 
 // Local mutex to protect Vending machine data stuct variable
 static xSemaphoreHandle xMutexVM;
+static StaticSemaphore_t xMutexVMBuffer;
+
+// vTaskUI stack and TCB
+static StackType_t xTaskUIStack[UI_TASK_STACK];
+static StaticTask_t xTaskUITCB;
+
+#if configUSE_TRACE_RECORDER == 1
+// trace recorder mark of a vend, from SM_TRY_VENDING to SM_VEND_SUCCESS or SM_VEND_FAIL
+static UBaseType_t uxVendMark;
+#define VEND_MARK_BEGIN(i)  vTraceRecorderMarkBegin(uxVendMark, i)
+#define VEND_MARK_END(i)    vTraceRecorderMarkEnd(uxVendMark, i)
+#else
+#define VEND_MARK_BEGIN(i)
+#define VEND_MARK_END(i)
+#endif
 
 /******************************************************************************
 ********************* Private static function declarations ********************
 ******************************************************************************/
 
 static void vGetEEPROM(void);
+static void vLogSale(int i);
 
 /******************************************************************************
  * Name:        vTaskUI
@@ -173,6 +204,7 @@ static void vTaskUI( void *pvParameters )
             // tries vending drink selected by "i". vSetVM() will send a VEND_SUCCESS or VEND_FAIL message to queue upon success/fail
             case SM_TRY_VENDING:
             
+                VEND_MARK_BEGIN(i);
                 temp = vmGetVM();
                 vSetVM(0, SELL_DRINK, i);
             
@@ -196,6 +228,7 @@ static void vTaskUI( void *pvParameters )
             
                 vSetVM(0, CLEAR_CREDIT, 0);
                 vSetVM(0, TRANSACTION_TIME, 0);
+                VEND_MARK_END(i);
                 
             break;
             
@@ -228,6 +261,7 @@ static void vTaskUI( void *pvParameters )
                     LCDL2Home();
                     LCDPutString("OUT OF STOCK!   ");
                 }
+                VEND_MARK_END(i);
             
             break;
             
@@ -316,9 +350,10 @@ void vSaveEEPROM(void)
  *****************************************************************************/
 static void vGetEEPROM(void)
 {
-    int i;          // counter for loop
-    int data;       // stores data from NVM
-    int addr;       // address to read in NVM
+    int i;                  // counter for loop
+    int data;               // stores data from NVM
+    int addr;               // address to read in NVM
+    unsigned char hdr[4];   // sales log header
     
     // directly accesses vendingMachine data securely using same Mutex as vSetVM() and vmGetVM()
     xSemaphoreTake(xMutexVM, portMAX_DELAY);
@@ -343,32 +378,100 @@ static void vGetEEPROM(void)
         addr += 0x2;
         data = iReadNVM(addr);
         vendMachine.drink[i].stock = data;
+        
+        // sold counters, an erased NVM (0xFFFFFFFF) starts from 0
+        vendMachine.drink[i].sold = lReadNVM(NVM_SOLD_ADDR + 4 * i);
+        if (vendMachine.drink[i].sold == 0xFFFFFFFFUL) vendMachine.drink[i].sold = 0;
+    }
+    
+    // sales log header, reset if it holds invalid values (erased NVM)
+    vReadNVMBlock(NVM_SALES_HDR_ADDR, hdr, sizeof(hdr));
+    salesHead = (hdr[0] << 8) | hdr[1];
+    vendMachine.salesCount = (hdr[2] << 8) | hdr[3];
+    
+    if (salesHead >= SALES_LOG_SIZE || vendMachine.salesCount > SALES_LOG_SIZE)
+    {
+        salesHead = 0;
+        vendMachine.salesCount = 0;
     }
     
     xSemaphoreGive(xMutexVM);
 }
 
+/******************************************************************************
+ * Name:        vLogSale
+ * Description: Appends a record for drink "i" to the NVM sales log and saves the
+ *              drink's sold counter. The oldest record is overwritten once the log
+ *              holds SALES_LOG_SIZE records. Must be called with xMutexVM taken.
+ *  Parameters: - int i:    index of the drink sold
+ *  Return:     None
+ *****************************************************************************/
+static void vLogSale(int i)
+{
+    unsigned char rec[SALE_RECORD_SIZE];    // record as stored in NVM, MSB first
+    unsigned char hdr[4];                   // sales log header as stored in NVM
+    unsigned long time;                     // machine time in 1/10 s
+    unsigned int price;                     // price in cents
+    
+    time = (unsigned long)(vendMachine.time * 10 + 0.5F);
+    price = (unsigned int)(100 * vendMachine.drink[i].cost + 0.5F);
+    
+    rec[0] = time >> 24;
+    rec[1] = time >> 16;
+    rec[2] = time >> 8;
+    rec[3] = time;
+    rec[4] = price >> 8;
+    rec[5] = price;
+    rec[6] = i;
+    rec[7] = 0;
+    vWriteNVMBlock(NVM_SALES_ADDR + salesHead * SALE_RECORD_SIZE, rec, SALE_RECORD_SIZE);
+    
+    salesHead = (salesHead + 1) % SALES_LOG_SIZE;
+    if (vendMachine.salesCount < SALES_LOG_SIZE) vendMachine.salesCount++;
+    
+    hdr[0] = salesHead >> 8;
+    hdr[1] = salesHead;
+    hdr[2] = vendMachine.salesCount >> 8;
+    hdr[3] = vendMachine.salesCount;
+    vWriteNVMBlock(NVM_SALES_HDR_ADDR, hdr, sizeof(hdr));
+    
+    lWriteNVM(NVM_SOLD_ADDR + 4 * i, vendMachine.drink[i].sold);
+}
+
 /******************************************************************************
 *************************** Public function declarations **********************
 ******************************************************************************/
 
 /******************************************************************************
  * Name:        vStartTaskUI
- * Description: Calls vTaskCreate() to create vTaskUI.
+ * Description: Calls xTaskCreateStatic() to create vTaskUI, creates xQueueUI
+ *              and xMutexVM in their static buffers.
  *  Parameters: None
  *  Return:     None
  *****************************************************************************/
 void vStartTaskUI(void)
 {
-     xTaskCreate(	vTaskUI,                /* Pointer to the function that implements the task. */
+     xTaskCreateStatic(	vTaskUI,                /* Pointer to the function that implements the task. */
 					( char * ) "vTaskUI",   /* Text name for the task.  This is to facilitate debugging only. */
-					600,                    /* Stack depth in words. */
+					UI_TASK_STACK,          /* Stack depth in words. */
 					NULL,                   /* We are not using the task parameter. */
 					UI_TASK_PRIORITY,       /* This task will run at specified priority. */
-					NULL );                 /* We are not using the task handle. */
+					xTaskUIStack,           /* Stack of the task. */
+					&xTaskUITCB );          /* TCB of the task, the handle is not used. */
      
-     xQueueUI = xQueueCreate(4, sizeof(char));
-     xMutexVM = xSemaphoreCreateMutex();
+     xQueueUI = xQueueCreateStatic(4, sizeof(char), ucQueueUIStorage, &xQueueUIBuffer);
+     // priority inheritance, not a ceiling: vSaveEEPROM(), vLogSale() and vSetVM() write the NVM
+     // holding it, each iWriteNVM() polls for about 5 ms, and a ceiling would run every holder above
+     // vTaskTech and vTaskPoll for all of it, contended or not. Other users (vTaskTimer among them)
+     // do block on it, the holder is then raised to their priority only for that time.
+     xMutexVM = xSemaphoreCreateMutexStatic(&xMutexVMBuffer);
+
+     // names given to kernel aware tools, the trace recorder among them (nothing without a queue registry)
+     vQueueAddToRegistry(xQueueUI, "qUI");
+     vQueueAddToRegistry(xMutexVM, "mVM");
+#if configUSE_TRACE_RECORDER == 1
+     uxVendMark = uxTraceRecorderAddObject(traceobjectMARK, "vend");
+#endif
      
      vGetEEPROM();
 }
@@ -438,8 +541,11 @@ void vSetVM(float val, char op_type, int i)
                 if (vendMachine.drink[i].stock > 0)
                 {
                     vendMachine.drink[i].stock -= 1;
+                    vendMachine.drink[i].sold += 1;
                     vendMachine.balance += vendMachine.drink[i].cost;
                     vendMachine.credit -= vendMachine.drink[i].cost;
+                    
+                    vLogSale(i);    // append the sale to the NVM sales log
                 
                     vQueueUICtrl(SM_VEND_SUCCESS);
                     break;                          // breaks after success to avoid sending VEND_FAIL message by default
@@ -505,4 +611,38 @@ VendingMachine_t vmGetVM()
     xSemaphoreGive(xMutexVM);
     
     return(_VM);
-}
\ No newline at end of file
+}
+
+/******************************************************************************
+ * Name:        iGetSale
+ * Description: Mutex protected read of one record of the NVM sales log.
+ *              Record 0 is the oldest sale still in the log.
+ *  Parameters: - unsigned int n:   record number, 0 to salesCount - 1
+ *              - sale_t *sale:     destination for the record
+ *  Return:     - int:  1 if the record exists, 0 otherwise
+ *****************************************************************************/
+int iGetSale(unsigned int n, sale_t *sale)
+{
+    unsigned char rec[SALE_RECORD_SIZE];    // record as stored in NVM, MSB first
+    unsigned int index;                     // position of the record in the log
+    
+    xSemaphoreTake(xMutexVM, portMAX_DELAY);
+    
+    if (n >= vendMachine.salesCount)
+    {
+        xSemaphoreGive(xMutexVM);
+        return 0;
+    }
+    
+    // oldest record sits at salesHead once the log has wrapped, at 0 before
+    index = (salesHead + SALES_LOG_SIZE - vendMachine.salesCount + n) % SALES_LOG_SIZE;
+    vReadNVMBlock(NVM_SALES_ADDR + index * SALE_RECORD_SIZE, rec, SALE_RECORD_SIZE);
+    
+    xSemaphoreGive(xMutexVM);
+    
+    sale->time = ((unsigned long)rec[0] << 24) | ((unsigned long)rec[1] << 16) | ((unsigned long)rec[2] << 8) | rec[3];
+    sale->price = (rec[4] << 8) | rec[5];
+    sale->drink = rec[6];
+    
+    return 1;
+}
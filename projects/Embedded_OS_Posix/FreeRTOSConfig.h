@@ -0,0 +1,172 @@
+/******************************************************************************
+ * File:        FreeRTOSConfig.h
+ * Description: FreeRTOS configuration of the POSIX simulator. Same scheduling
+ *              settings as ../Embedded_OS/FreeRTOSConfig.h (priorities, tick
+ *              rate, 16 bit ticks, preemption) so the tasks behave the same,
+ *              the differences are marked "sim".
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *   "      "       Oct 19 2026     v1.1.0  -   INCLUDE_xTaskGetIdleTaskHandle for virtual time
+ *   "      "       Oct 19 2026     v1.2.0  -   configUSE_ZERO_COPY_QUEUES
+ *   "      "       Oct 19 2026     v1.3.0  -   Software timers for KERNEL_BENCH, configUSE_TIMER_WHEEL
+ *   "      "       Oct 19 2026     v1.4.0  -   configUSE_DELAYED_TASK_BUCKETS, bench heap for BENCH_DELAYED_TASKS
+ *   "      "       Oct 19 2026     v1.5.0  -   configUSE_EVENT_LIST_BUCKETS
+ *   "      "       Oct 19 2026     v1.6.0  -   configUSE_EVENT_GROUP_BIT_INDEX, configUSE_EVENT_GROUP_DIRECT_ISR
+ *   "      "       Oct 19 2026     v1.7.0  -   Static allocation only as on the target, the heap for KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.8.0  -   Heap profiler for HEAP_PROFILER
+ *   "      "       Oct 19 2026     v1.9.0  -   Critical section profiler for CRIT_PROFILER
+ *   "      "       Oct 19 2026     v1.10.0 -   Trace recorder for TRACE_RECORDER
+ *   "      "       Oct 19 2026     v1.11.0 -   configUSE_CEILING_MUTEXES, context switch count for KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.12.0 -   configUSE_OBJECT_NOTIFY_BITS, queue sets for KERNEL_BENCH
+ *   "      "       Oct 19 2026     v1.13.0 -   configUSE_QUEUE_BATCH
+ *   "      "       Oct 19 2026     v1.14.0 -   configUSE_HR_TIMER
+ *****************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html.
+ *----------------------------------------------------------*/
+
+#define configUSE_MUTEXES               1
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK				1
+#define configUSE_TICK_HOOK				1       // sim: drives the peripheral stand-ins
+#define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
+#define configCPU_CLOCK_HZ				( ( unsigned long ) 16000000 )  /* fcy of the target, used by the baud rate maths only */
+#define configMAX_PRIORITIES			( 5 )
+#define configMINIMAL_STACK_SIZE		( 115 )
+#if defined(BENCH_DELAYED_TASKS) && BENCH_DELAYED_TASKS
+#define configTOTAL_HEAP_SIZE			( ( size_t ) 2097152 )  // sim: the 1000 delayed tasks of the benchmark
+#else
+#define configTOTAL_HEAP_SIZE			( ( size_t ) 65536 )    // sim: stack words are 8 bytes on the host
+#endif
+#define configMAX_TASK_NAME_LEN			( 16 )  // sim: full names in the run time stats
+#define configUSE_TRACE_FACILITY		1       // sim: run time stats printed at exit
+#define configUSE_16_BIT_TICKS			1
+#define configIDLE_SHOULD_YIELD			1
+#define configCHECK_FOR_STACK_OVERFLOW  0       // sim: tasks run on their thread stack, not the FreeRTOS one
+#define configUSE_ZERO_COPY_QUEUES      1
+
+/* As on the target: every kernel object of the vending machine is created
+statically and heap_1.c compiles to nothing. The benchmark keeps the heap. */
+#define configSUPPORT_STATIC_ALLOCATION 1
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#else
+#define configSUPPORT_DYNAMIC_ALLOCATION 0
+#endif
+
+/* Software timers, only used by the benchmark: the timer service task does not
+fit in the heap next to the vending machine tasks. KERNEL_BENCH has to be given
+on the compiler command line for this to see it. */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configUSE_TIMERS                1
+#define configTIMER_TASK_PRIORITY       ( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH        5
+#define configTIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#define INCLUDE_xTimerPendFunctionCall  1       /* deferred xEventGroupSetBitsFromISR() */
+#endif
+#define configUSE_TIMER_WHEEL           1       /* hierarchical timing wheel, 0 for the sorted timer lists (compare with KERNEL_BENCH) */
+#define configUSE_DELAYED_TASK_BUCKETS  0       /* 1 for bucketed delayed task lists, only worth it with many delayed tasks (compare with KERNEL_BENCH) */
+#define configUSE_EVENT_LIST_BUCKETS    1       /* O(1) priority ordered queue/semaphore waiters, 0 for the sorted event lists */
+#define configUSE_EVENT_GROUP_BIT_INDEX 1       /* only test the tasks waiting for the bits being set (compare with KERNEL_BENCH) */
+#define configUSE_EVENT_GROUP_DIRECT_ISR 1      /* xEventGroupSetBitsFromISR() without the timer task (compare with KERNEL_BENCH) */
+#define configUSE_CEILING_MUTEXES       1       /* xSemaphoreCreateMutexWithCeiling(), the holder runs at the ceiling (ceiling_vend_switches of KERNEL_BENCH) */
+#define configUSE_OBJECT_NOTIFY_BITS    1       /* vQueueSetNotifyBits(): wait on several objects with xTaskNotifyWait() instead of a queue set */
+#define configUSE_QUEUE_BATCH           1       /* uxQueueSendMultiple() / uxQueueReceiveMultiple(): many items per critical section */
+#define configUSE_HR_TIMER              1       /* vTaskDelayUs(), microsecond timeouts and one-shot callbacks on a compare timer */
+
+/* Queue sets, only used by the benchmark to compare with the notification
+bits. */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH
+#define configUSE_QUEUE_SETS            1
+#endif
+
+/* Context switch count of the benchmark (bench.c), not with the trace recorder
+that has its own traceTASK_SWITCHED_IN(). */
+#if defined(KERNEL_BENCH) && KERNEL_BENCH && !(defined(TRACE_RECORDER) && TRACE_RECORDER)
+void vBenchTaskSwitchedIn( void *pvTask );
+#define traceTASK_SWITCHED_IN()         vBenchTaskSwitchedIn( pxCurrentTCB )
+#endif
+
+/* Heap profiler (heap_profiler.c), HEAP_PROFILER has to be set to 1 on the
+compiler command line with KERNEL_BENCH, the only build with a heap. Times in
+counts of the benchmark timer. */
+#if defined(HEAP_PROFILER) && HEAP_PROFILER
+#define configUSE_HEAP_PROFILER         1
+#define configHEAP_PROFILER_SITES       16
+#define configHEAP_PROFILER_BLOCKS      2500    // sim: room for the delayed tasks of BENCH_DELAYED_TASKS
+uint32_t ulReadBenchTimer( void );
+#define configHEAP_PROFILER_GET_TIME()  ulReadBenchTimer()
+#endif
+
+/* Critical section profiler (critical_profiler.c), CRIT_PROFILER has to be set
+to 1 on the compiler command line, with or without KERNEL_BENCH. Times in
+counts of the benchmark timer. */
+#if defined(CRIT_PROFILER) && CRIT_PROFILER
+#define configUSE_CRITICAL_PROFILER     1
+#define configCRITICAL_PROFILER_SITES   16      // sim: the host also times the thread calls of the port
+uint32_t ulReadBenchTimer( void );
+#define configCRITICAL_PROFILER_GET_TIME()  ulReadBenchTimer()
+/* sim: callers as offsets in the executable, "addr2line -f -e sim <caller>" */
+extern char __executable_start[];
+#define configCRITICAL_PROFILER_GET_CALLER() ( ( uint32_t ) ( ( size_t ) __builtin_return_address( 0 ) - ( size_t ) __executable_start ) )
+#endif
+
+/* Trace recorder (trace_recorder.c), TRACE_RECORDER has to be set to 1 on the
+compiler command line. Time stamps in counts of configCPU_CLOCK_HZ of simulated
+time, so a virtual time run gives the timeline of the target. */
+#if defined(TRACE_RECORDER) && TRACE_RECORDER
+#define configUSE_TRACE_RECORDER        1
+#define configTRACE_RECORDER_RECORDS    65536   // sim: 512KB, a whole demo run
+#define configTRACE_RECORDER_OBJECTS    32
+#define configQUEUE_REGISTRY_SIZE       8
+uint32_t ulSimTraceTime( void );
+#define configTRACE_RECORDER_GET_TIME() ulSimTraceTime()
+#endif
+
+/* sim: run time stats, counted in us of host time. */
+#define configGENERATE_RUN_TIME_STATS			1
+unsigned long ulSimRunTimeCounter( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()	ulSimRunTimeCounter()
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES           0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet		1
+#define INCLUDE_uxTaskPriorityGet		0
+#define INCLUDE_vTaskDelete				0
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetSchedulerState	1
+#define INCLUDE_xTaskGetIdleTaskHandle	1       // sim: needed by the virtual time mode
+
+#define configKERNEL_INTERRUPT_PRIORITY	0x01
+
+/* sim: stop on the first failed assertion instead of hanging. */
+#define configASSERT( x )	if( ( x ) == 0 ) { fprintf( stderr, "configASSERT failed: %s:%d\n", __FILE__, __LINE__ ); abort(); }
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,37 @@
+/******************************************************************************
+ * File:        adc.c
+ * Description: Host stand-in of the ADC. The potentiometer (temperature
+ *              input of the vending machine) is set by the simulator script,
+ *              the other channels read 0.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#include "../../Source/include/FreeRTOS.h"
+#include "include/adc.h"
+#include "include/uart.h"
+#include "include/sim.h"
+
+static volatile int potCode = SIM_POT_DEFAULT;
+
+// nothing to initialize
+void initADC(void)
+{
+}
+
+// reads "ch" channel from ADC, 10-bit unsigned result
+int readADC(int ch)
+{
+    return (ch == SIM_POT_CHANNEL) ? potCode : 0;
+}
+
+// sets the ADC code of the potentiometer, clipped to 10 bits
+void vSimSetPot(int code)
+{
+    if (code < 0) code = 0;
+    if (code > 1023) code = 1023;
+    potCode = code;
+}
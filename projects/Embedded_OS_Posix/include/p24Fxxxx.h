@@ -0,0 +1,16 @@
+/******************************************************************************
+ * File:        p24Fxxxx.h
+ * Description: Host stand-in for the PIC24F generic device header, see xc.h.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#ifndef P24FXXXX_H
+#define P24FXXXX_H
+
+#include <xc.h>
+
+#endif /* P24FXXXX_H */
@@ -0,0 +1,16 @@
+/******************************************************************************
+ * File:        pmp.h
+ * Description: Host stand-in for the PIC24 peripheral library PMP header.
+ *              pmp_lcd.c of the simulator models the LCD controller itself,
+ *              so nothing from the PMP library is needed.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#ifndef PMP_H
+#define PMP_H
+
+#endif /* PMP_H */
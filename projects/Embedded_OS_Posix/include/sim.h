@@ -0,0 +1,58 @@
+/******************************************************************************
+ * File:        sim.h
+ * Description: Interface between the host stand-ins of the Explorer16
+ *              peripherals and the simulator main loop. Everything here is
+ *              simulator only, the application never calls these functions.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *   "      "       Oct 19 2026     v1.1.0  -   Added vSimUartEcho()
+ *****************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdio.h>
+
+// FreeRTOS.h and uart.h must be included before this file
+
+/*****************************************************************************/
+/*********************************** MACROS **********************************/
+/*****************************************************************************/
+
+#define SIM_NVM_SIZE        0x8000      // 25LC256, 32 KBytes
+#define SIM_NVM_PAGE_SIZE   64          // page write wraps inside a 64 byte page
+#define SIM_POT_CHANNEL     5           // ADC channel of the Explorer16 potentiometer
+#define SIM_POT_DEFAULT     400         // ADC code of the pot at power up (about 3.5 deg C)
+#define SIM_RX_FIFO_SIZE    4096        // host side buffer of the bytes read from a pty
+
+/*****************************************************************************/
+/**************************** FUNCTION PROTOTYPES ****************************/
+/*****************************************************************************/
+
+// pmp_lcd.c
+void vSimLcdOpen(FILE *out, int redraw);
+void vSimLcdTick(unsigned long ms);
+
+// nvm.c
+int iSimNvmOpen(const char *path);
+
+// adc.c
+void vSimSetPot(int code);
+
+// uart.c
+void vSimUartTick(void);
+void vSimUartRx(UartPort_t port, const char *buf, int len);
+const char *pcSimUartPty(UartPort_t port);
+void vSimUartEcho(UartPort_t port, FILE *out);
+void vSimUartReport(FILE *out);
+
+// script.c
+int iSimScriptLoad(const char *path);
+void vSimScriptTick(unsigned long ms);
+int iSimScriptDone(void);
+unsigned long ulSimScriptPasses(void);
+
+#endif /* SIM_H */
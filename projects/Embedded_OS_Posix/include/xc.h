@@ -0,0 +1,56 @@
+/******************************************************************************
+ * File:        xc.h
+ * Description: Host stand-in for the XC16 device header. Only declares the
+ *              special function registers used by the application tasks
+ *              (push buttons and LEDs on PORTA/PORTD) and the builtins they call.
+ *              The registers are plain variables defined in initBoard.c, the
+ *              simulator drives the button inputs from its script.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#ifndef XC_H
+#define XC_H
+
+// The interrupt attributes of the PIC24 ISRs mean nothing on the host
+#define __interrupt__
+#define no_auto_psv
+
+// 16-bit I/O port, readable as a word or bit by bit like the PIC24 SFRs
+typedef union
+{
+    unsigned int w;
+    struct
+    {
+        unsigned b0:1, b1:1, b2:1, b3:1, b4:1, b5:1, b6:1, b7:1;
+        unsigned b8:1, b9:1, b10:1, b11:1, b12:1, b13:1, b14:1, b15:1;
+    } bits;
+
+} SimPort_t;
+
+extern volatile SimPort_t simPORTA, simTRISA, simPORTD, simTRISD;
+
+#define PORTA       (simPORTA.w)
+#define TRISA       (simTRISA.w)
+#define PORTD       (simPORTD.w)
+#define TRISD       (simTRISD.w)
+
+#define _RA0        simPORTA.bits.b0
+#define _RA1        simPORTA.bits.b1
+#define _RA2        simPORTA.bits.b2
+#define _RA3        simPORTA.bits.b3
+#define _RA4        simPORTA.bits.b4
+#define _RA5        simPORTA.bits.b5
+#define _RA6        simPORTA.bits.b6
+#define _RA7        simPORTA.bits.b7
+#define _RD6        simPORTD.bits.b6
+#define _RD7        simPORTD.bits.b7
+#define _RD13       simPORTD.bits.b13
+
+#define Nop()       __asm volatile("")
+#define ClrWdt()    ((void)0)   // no watchdog in the simulator
+
+#endif /* XC_H */
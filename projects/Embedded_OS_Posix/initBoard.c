@@ -0,0 +1,118 @@
+/******************************************************************************
+ * File:        initBoard.c
+ * Description: Host stand-in of the board initialization. Defines the port
+ *              registers declared by include/xc.h.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *   "      "       Oct 19 2026     v1.1.0  -   Benchmark timer and interrupt stand-ins
+ *   "      "       Oct 19 2026     v1.2.0  -   Benchmark timer also for the critical section
+ *                                              profiler (CRIT_PROFILER)
+ *****************************************************************************/
+
+#include <time.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "include/initBoard.h"
+#include "include/public.h"
+#include "include/bench.h"
+
+#define BENCH_INTERRUPT     portFIRST_APP_INTERRUPT     // simulated interrupt standing in for Timer5
+
+static volatile unsigned long ulBenchIsrCount;              // benchmark interrupts handled
+
+// Port registers. The push buttons pull their input low when pressed.
+volatile SimPort_t simPORTA, simTRISA, simPORTD, simTRISD;
+
+/******************************************************************************
+ * Name:        OSCILLATOR_Initialize
+ * Description: Nothing to do, the simulated tick is timed by the host clock.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void OSCILLATOR_Initialize(void)
+{
+}
+
+/******************************************************************************
+ * Name:        initIO
+ * Description: Releases all the push buttons and turns the LEDs off.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void initIO(void)
+{
+    TRISD = 0xFFFF;     // push buttons are inputs
+    PORTD = 0xFFFF;     // and read high when released
+
+    TRISA = 0x0;        // LEDs are outputs
+    PORTA = 0x0;
+}
+
+#if KERNEL_BENCH || configUSE_CRITICAL_PROFILER == 1
+
+/******************************************************************************
+ * Name:        ulReadBenchTimer
+ * Description: Host clock scaled to the fcy of the target, so the report has
+ *              the same units. The figures are those of the host, they only
+ *              check the benchmark itself.
+ *  Parameters: None
+ *  Return:     - uint32_t: counts of configCPU_CLOCK_HZ
+ *****************************************************************************/
+uint32_t ulReadBenchTimer(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec * 1000000000ULL + now.tv_nsec) * (configCPU_CLOCK_HZ / 1000000UL) / 1000);
+}
+
+#endif /* KERNEL_BENCH || configUSE_CRITICAL_PROFILER */
+
+#if KERNEL_BENCH
+
+/******************************************************************************
+ * Name:        prvBenchInterrupt
+ * Description: Handler of the simulated benchmark interrupt.
+ *  Parameters: None
+ *  Return:     - uint32_t: 0, vBenchIsr() asks for the context switch itself
+ *****************************************************************************/
+static uint32_t prvBenchInterrupt(void)
+{
+    ulBenchIsrCount++;
+    vBenchIsr();
+    return 0;
+}
+
+/******************************************************************************
+ * Name:        initBenchTimer
+ * Description: Installs the benchmark interrupt handler. The timer is the
+ *              host clock, nothing to start.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void initBenchTimer(void)
+{
+    vPortSetInterruptHandler(BENCH_INTERRUPT, prvBenchInterrupt);
+}
+
+/******************************************************************************
+ * Name:        vTriggerBenchIsr
+ * Description: Raises the simulated benchmark interrupt and waits until it is
+ *              handled, as the target enters the ISR right after setting
+ *              _T5IF. The simulated interrupts are otherwise asynchronous.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vTriggerBenchIsr(void)
+{
+    unsigned long count = ulBenchIsrCount;
+
+    vPortGenerateSimulatedInterrupt(BENCH_INTERRUPT);
+    while (ulBenchIsrCount == count);
+}
+
+#endif /* KERNEL_BENCH */
@@ -0,0 +1,446 @@
+/*****************************************************************************
+ * File:        main.c
+ * Description: Main source file of the POSIX simulator. Runs the vending
+ *              machine tasks of ../Embedded_OS unchanged on the host, with
+ *              the Explorer16 peripherals replaced by host stand-ins:
+ *
+ *              - LCD:          printed on stdout or to a log file (pmp_lcd.c)
+ *              - S3-S6, pot:   driven by a stimulus script (script.c)
+ *              - UART2:        a pseudo terminal (uart.c)
+ *              - 25LC256:      an image file (nvm.c)
+ *
+ *              Usage: sim [-s script] [-e eeprom.bin] [-l lcd.log] [-q]
+ *                         [-p pty link] [-t ms] [-v] [-o] [-m heap.txt]
+ *                         [-c crit.txt] [-r trace.bin]
+ *
+ *              The run time stats of every task (host time spent in the
+ *              Running state) and the UART counters are printed at exit.
+ *
+ *              With -v the tick runs on virtual time: blocked periods take no
+ *              host time and two runs of the same script give the same LCD
+ *              log, for soak tests.
+ *
+ *              Built with KERNEL_BENCH set to 1 ("make bench") it runs the
+ *              kernel benchmark instead, -o shows its report. Built with
+ *              BENCH_HEAP set to 5 it gives heap_5.c its region. Built with
+ *              HEAP_PROFILER set to 1 as well, -m writes the heap profiler
+ *              report (heap_report.h) to a file at exit. Built with
+ *              CRIT_PROFILER set to 1, -c writes the critical section
+ *              profiler report (crit_report.h) to a file at exit. Built
+ *              with TRACE_RECORDER set to 1, -r writes the trace recorder
+ *              dump (trace_dump.h) to a file at exit, time stamped in
+ *              simulated time, for tools/trace_host.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *   "      "       Oct 19 2026     v1.1.0  -   -v virtual time option, host time and script
+ *                                              passes printed at exit
+ *   "      "       Oct 19 2026     v1.2.0  -   -o option, KERNEL_BENCH build
+ *   "      "       Oct 19 2026     v1.3.0  -   Heap region of the BENCH_HEAP=5 build
+ *   "      "       Oct 19 2026     v1.4.0  -   Memory of the idle and timer tasks given
+ *                                              to the kernel, nothing is allocated
+ *   "      "       Oct 19 2026     v1.5.0  -   -m heap profiler report
+ *   "      "       Oct 19 2026     v1.6.0  -   -c critical section profiler report
+ *   "      "       Oct 19 2026     v1.7.0  -   -r trace recorder dump, ulSimTraceTime()
+ *****************************************************************************/
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+
+//Library includes
+#include "include/pmp_lcd.h"
+#include "include/adc.h"
+#include "include/COMM2.h"
+#include "include/public.h"
+#include "include/initBoard.h"
+#include "include/nvm.h"
+#include "include/uart.h"
+#include "include/sim.h"
+#include "include/bench.h"
+#include "include/heap_report.h"
+#include "include/crit_report.h"
+#include "include/trace_dump.h"
+
+#define DEFAULT_NVM_FILE    "25lc256.bin"
+#define MAX_TASKS           8
+
+static unsigned long ulSimTime;         // ms since the scheduler started, does not wrap like the tick count
+static unsigned long ulRunTime;         // -t option, 0 to run until the script quits
+static int virtualTime;                 // -v option
+
+#if defined(BENCH_HEAP) && BENCH_HEAP == 5
+static uint8_t ucBenchHeap[configTOTAL_HEAP_SIZE];     // heap_5.c has no array of its own
+static const HeapRegion_t xBenchHeapRegions[] = { { ucBenchHeap, sizeof(ucBenchHeap) }, { NULL, 0 } };
+#endif
+static struct timespec xStartTime;
+static FILE *heapReport;                // -m option
+static FILE *critReport;                // -c option
+static FILE *traceDump;                 // -r option
+
+/* Prototypes for the standard FreeRTOS callback/hook functions implemented within this file. */
+void vApplicationIdleHook(void);
+void vApplicationTickHook(void);
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize);
+#if configUSE_TIMERS == 1
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize);
+#endif
+
+/******************************************************************************
+ * Name:        prvPrintRunTimeStats
+ * Description: Prints the time each task spent in the Running state. Same
+ *              figures as vTaskGetRunTimeStats(), which is left out without
+ *              dynamic allocation (it frees its buffer).
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+static void prvPrintRunTimeStats(void)
+{
+    TaskStatus_t status[MAX_TASKS];
+    uint32_t total;
+    UBaseType_t n, i;
+
+    n = uxTaskGetSystemState(status, MAX_TASKS, &total);
+    if (total == 0) total = 1;
+
+    printf("%-16s %12s %7s\n", "Task", "Run time us", "%");
+    for (i = 0; i < n; i++)
+    {
+        printf("%-16s %12lu %6.2f%%\n", status[i].pcTaskName, (unsigned long)status[i].ulRunTimeCounter,
+               100.0 * status[i].ulRunTimeCounter / total);
+    }
+}
+
+#if configUSE_HEAP_PROFILER == 1
+/******************************************************************************
+ * Name:        prvPutHeapLine
+ * Description: Output of the heap profiler report, to the -m file.
+ *  Parameters: - const char *line: report line without end of line
+ *  Return:     None
+ *****************************************************************************/
+static void prvPutHeapLine(const char *line)
+{
+    fprintf(heapReport, "%s\n", line);
+}
+#endif
+
+#if configUSE_CRITICAL_PROFILER == 1
+/******************************************************************************
+ * Name:        prvPutCritLine
+ * Description: Output of the critical section profiler report, to the -c
+ *              file.
+ *  Parameters: - const char *line: report line without end of line
+ *  Return:     None
+ *****************************************************************************/
+static void prvPutCritLine(const char *line)
+{
+    fprintf(critReport, "%s\n", line);
+}
+#endif
+
+#if configUSE_TRACE_RECORDER == 1
+/******************************************************************************
+ * Name:        prvPutTraceBytes
+ * Description: Output of the trace recorder dump, to the -r file.
+ *  Parameters: - const char *buf:  part of the dump
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+static void prvPutTraceBytes(const char *buf, int len)
+{
+    fwrite(buf, 1, len, traceDump);
+}
+#endif
+
+/******************************************************************************
+ * Name:        prvUsage
+ * Description: Prints the command line options and exits.
+ *  Parameters: - const char *name: program name
+ *  Return:     None
+ *****************************************************************************/
+static void prvUsage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-s script] [-e eeprom.bin] [-l lcd.log] [-q] [-p link] [-t ms] [-v] [-o] [-m file] [-c file] [-r file]\n"
+            "  -s script     stimulus script (buttons, pot, UART2 input)\n"
+            "  -e file       25LC256 image, default " DEFAULT_NVM_FILE "\n"
+            "  -l file       write the LCD screens to a log file instead of the terminal\n"
+            "  -q            no LCD output\n"
+            "  -p link       create a symlink to the UART2 pty\n"
+            "  -t ms         stop after ms of simulated time\n"
+            "  -v            virtual time, as fast as the host allows and repeatable\n"
+            "  -o            copy the UART2 output to stdout\n"
+            "  -m file       write the heap profiler report at exit (HEAP_PROFILER build)\n"
+            "  -c file       write the critical section profiler report at exit (CRIT_PROFILER build)\n"
+            "  -r file       write the trace recorder dump at exit (TRACE_RECORDER build)\n", name);
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *scriptFile = NULL, *nvmFile = DEFAULT_NVM_FILE, *lcdFile = NULL, *ptyLink = NULL, *heapFile = NULL;
+    const char *critFile = NULL, *traceFile = NULL;
+    int quiet = 0, echo = 0, opt;
+    FILE *lcd = stdout;
+    unsigned long hostTime;
+
+    while ((opt = getopt(argc, argv, "s:e:l:qp:t:vom:c:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's': scriptFile = optarg; break;
+            case 'e': nvmFile = optarg; break;
+            case 'l': lcdFile = optarg; break;
+            case 'q': quiet = 1; break;
+            case 'p': ptyLink = optarg; break;
+            case 't': ulRunTime = strtoul(optarg, NULL, 0); break;
+            case 'v': virtualTime = 1; break;
+            case 'o': echo = 1; break;
+            case 'm': heapFile = optarg; break;
+            case 'c': critFile = optarg; break;
+            case 'r': traceFile = optarg; break;
+            default: prvUsage(argv[0]);
+        }
+    }
+
+#if defined(BENCH_HEAP) && BENCH_HEAP == 5
+    vPortDefineHeapRegions(xBenchHeapRegions);     // before anything is allocated
+#endif
+
+    if (scriptFile != NULL && iSimScriptLoad(scriptFile) < 0) return 1;
+
+    if (iSimNvmOpen(nvmFile) != 0)
+    {
+        perror(nvmFile);
+        return 1;
+    }
+
+    if (lcdFile != NULL && (lcd = fopen(lcdFile, "w")) == NULL)
+    {
+        perror(lcdFile);
+        return 1;
+    }
+    vSimLcdOpen(quiet ? NULL : lcd, lcdFile == NULL && isatty(fileno(stdout)));
+
+    if (heapFile != NULL && (heapReport = fopen(heapFile, "w")) == NULL)
+    {
+        perror(heapFile);
+        return 1;
+    }
+#if configUSE_HEAP_PROFILER != 1
+    if (heapReport != NULL) fprintf(stderr, "%s: heap profiler not built (make bench HEAP_PROFILER=1)\n", heapFile);
+#endif
+
+    if (critFile != NULL && (critReport = fopen(critFile, "w")) == NULL)
+    {
+        perror(critFile);
+        return 1;
+    }
+#if configUSE_CRITICAL_PROFILER != 1
+    if (critReport != NULL) fprintf(stderr, "%s: critical section profiler not built (make CRIT_PROFILER=1)\n", critFile);
+#endif
+
+    if (traceFile != NULL && (traceDump = fopen(traceFile, "wb")) == NULL)
+    {
+        perror(traceFile);
+        return 1;
+    }
+#if configUSE_TRACE_RECORDER != 1
+    if (traceDump != NULL) fprintf(stderr, "%s: trace recorder not built (make TRACE_RECORDER=1)\n", traceFile);
+#endif
+
+    /* Initialize Oscillator, IOs, and peripherals  */
+    OSCILLATOR_Initialize();
+    initIO();                   // Pushbuttons / LEDs init
+    LCDInit();                  // LCD peripheral
+    initADC();                  // Analog to Digital converter, for reading potentiometer
+    initUart2_wInt();           // UART serial interface with interrupt on RX
+    InitNVM();                  // Non-volatile memory EEPROM
+
+    if (echo) vSimUartEcho(COMM2_PORT, stdout);
+
+    if (ptyLink != NULL && pcSimUartPty(COMM2_PORT) != NULL)
+    {
+        unlink(ptyLink);
+        if (symlink(pcSimUartPty(COMM2_PORT), ptyLink) != 0) perror(ptyLink);
+    }
+
+#if KERNEL_BENCH
+    vStartKernelBench();
+#else
+    /* Tasks creation */
+    vStartTaskUI();
+    vStartTaskPoll();
+    vStartTaskTech();
+    vStartTaskTimer();
+#endif
+
+    /* Finally start the scheduler, returns when the simulation ends. */
+    vPortSetVirtualTime(virtualTime);
+    clock_gettime(CLOCK_MONOTONIC, &xStartTime);
+    vTaskStartScheduler();
+    hostTime = ulSimRunTimeCounter() / 1000;
+
+    vSimLcdTick(ulSimTime);     // last screen
+    if (lcd != stdout) fclose(lcd);
+    if (ptyLink != NULL) unlink(ptyLink);
+
+    printf("\n%lu ms simulated in %lu ms%s\n", ulSimTime, hostTime, virtualTime ? " (virtual time)" : "");
+    if (ulSimScriptPasses() > 1) printf("%lu script passes\n", ulSimScriptPasses());
+    printf("\n");
+    prvPrintRunTimeStats();
+    vSimUartReport(stdout);
+
+    if (heapReport != NULL)
+    {
+#if configUSE_HEAP_PROFILER == 1
+        vHeapReport(prvPutHeapLine);
+#endif
+        fclose(heapReport);
+    }
+
+    if (critReport != NULL)
+    {
+#if configUSE_CRITICAL_PROFILER == 1
+        vCritReport(prvPutCritLine);
+#endif
+        fclose(critReport);
+    }
+
+    if (traceDump != NULL)
+    {
+#if configUSE_TRACE_RECORDER == 1
+        vTraceDump(prvPutTraceBytes);
+#endif
+        fclose(traceDump);
+    }
+
+    return 0;
+}
+
+/******************************************************************************
+ * Name:        vApplicationIdleHook
+ * Description: Heartbeat LED as on the target, then gives the host CPU back
+ *              until the next tick instead of the crude blocking delay. In
+ *              virtual time the next tick is raised as soon as the idle task
+ *              runs, there is nothing to wait for.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationIdleHook(void)
+{
+    ClrWdt();
+    _RA0 ^= 1;      // toggle LED
+    if (!virtualTime) usleep(1000000 / configTICK_RATE_HZ);   // cut short by the next simulated interrupt
+}
+
+/******************************************************************************
+ * Name:        vApplicationTickHook
+ * Description: Runs the peripheral stand-ins once per tick: script, UART
+ *              shift registers and LCD output. Ends the simulation once the
+ *              script quits or the -t time is reached.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationTickHook(void)
+{
+    ulSimTime++;
+
+    vSimScriptTick(ulSimTime);
+    vSimUartTick();
+    vSimLcdTick(ulSimTime);
+
+    if (iSimScriptDone() || (ulRunTime != 0 && ulSimTime >= ulRunTime)) vTaskEndScheduler();
+}
+
+/******************************************************************************
+ * Name:        vApplicationGetIdleTaskMemory
+ * Description: Gives vTaskStartScheduler() the stack and TCB of the idle task,
+ *              as on the target.
+ *  Parameters: - ppxIdleTaskTCBBuffer:     set to the TCB
+ *              - ppxIdleTaskStackBuffer:   set to the stack
+ *              - pusIdleTaskStackSize:     set to the stack depth in words
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize)
+{
+    static StackType_t xIdleTaskStack[configMINIMAL_STACK_SIZE];
+    static StaticTask_t xIdleTaskTCB;
+
+    *ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+    *ppxIdleTaskStackBuffer = xIdleTaskStack;
+    *pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if configUSE_TIMERS == 1
+/******************************************************************************
+ * Name:        vApplicationGetTimerTaskMemory
+ * Description: Gives the kernel the stack and TCB of the timer task.
+ *  Parameters: - ppxTimerTaskTCBBuffer:    set to the TCB
+ *              - ppxTimerTaskStackBuffer:  set to the stack
+ *              - pusTimerTaskStackSize:    set to the stack depth in words
+ *  Return:     None
+ *****************************************************************************/
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize)
+{
+    static StackType_t xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+    static StaticTask_t xTimerTaskTCB;
+
+    *ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+    *ppxTimerTaskStackBuffer = xTimerTaskStack;
+    *pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
+/******************************************************************************
+ * Name:        ulSimRunTimeCounter
+ * Description: Time base of the run time stats (portGET_RUN_TIME_COUNTER_VALUE)
+ *  Parameters: None
+ *  Return:     - unsigned long:    us since the scheduler started
+ *****************************************************************************/
+unsigned long ulSimRunTimeCounter(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - xStartTime.tv_sec) * 1000000UL + (now.tv_nsec - xStartTime.tv_nsec) / 1000;
+}
+
+#if configUSE_TRACE_RECORDER == 1
+/******************************************************************************
+ * Name:        ulSimTraceTime
+ * Description: Time base of the trace recorder (configTRACE_RECORDER_GET_TIME),
+ *              simulated time in counts of configCPU_CLOCK_HZ as on the
+ *              target, in virtual time too: the ms of the current tick plus
+ *              the host time since that tick was first seen, held below the
+ *              next ms so the time stamps never go back.
+ *  Parameters: None
+ *  Return:     - uint32_t: counts of configCPU_CLOCK_HZ since the scheduler started
+ *****************************************************************************/
+uint32_t ulSimTraceTime(void)
+{
+    static unsigned long tickTime = ~0UL;   // ulSimTime of tickStart
+    static unsigned long tickStart;         // host us when that tick was first seen
+    unsigned long us;
+
+    us = ulSimRunTimeCounter();
+    if (ulSimTime != tickTime)
+    {
+        tickTime = ulSimTime;
+        tickStart = us;
+    }
+
+    us -= tickStart;
+    if (us > 999) us = 999;
+
+    return (uint32_t)(ulSimTime * (configCPU_CLOCK_HZ / 1000) + us * (configCPU_CLOCK_HZ / 1000000));
+}
+#endif
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * File:        nvm.c
+ * Description: Host stand-in of the 25LC256 serial EEPROM, backed by a 32 KB
+ *              image file. Byte order, word alignment of the 16/32/64 bit
+ *              functions and the page wrap of writes crossing a 64 byte page
+ *              follow the SPI driver and the device, so an image can be
+ *              compared with a dump of a real board. Integers have the size
+ *              they have on the PIC24 (int 16 bit, long 32 bit).
+ *
+ *              Every write is written through to the file, reads come from
+ *              the copy in memory.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../Source/include/FreeRTOS.h"
+#include "include/nvm.h"
+#include "include/uart.h"
+#include "include/sim.h"
+
+static unsigned char image[SIM_NVM_SIZE];
+static int imageFd = -1;
+
+/******************************************************************************
+ * Name:        prvRead
+ * Description: Sequential read, the address counter rolls over at the end of
+ *              the array.
+ *  Parameters: - int address:          first byte
+ *              - unsigned char *data:  destination
+ *              - int len:              number of bytes
+ *  Return:     None
+ *****************************************************************************/
+static void prvRead(int address, unsigned char *data, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++)
+        data[i] = image[(address + i) & (SIM_NVM_SIZE - 1)];
+}
+
+/******************************************************************************
+ * Name:        prvWrite
+ * Description: Page write. Bytes past the end of the page wrap to its start,
+ *              as they do in the device. The changed page is written to the
+ *              image file.
+ *  Parameters: - int address:                  first byte
+ *              - const unsigned char *data:    bytes to write
+ *              - int len:                      number of bytes
+ *  Return:     None
+ *****************************************************************************/
+static void prvWrite(int address, const unsigned char *data, int len)
+{
+    int page = address & (SIM_NVM_SIZE - 1) & ~(SIM_NVM_PAGE_SIZE - 1);
+    int i;
+
+    for (i = 0; i < len; i++)
+        image[page + ((address + i) & (SIM_NVM_PAGE_SIZE - 1))] = data[i];
+
+    if (imageFd >= 0 && pwrite(imageFd, &image[page], SIM_NVM_PAGE_SIZE, page) != SIM_NVM_PAGE_SIZE)
+    {
+        close(imageFd);     // keep running on the copy in memory
+        imageFd = -1;
+    }
+}
+
+/******************************************************************************
+ * Name:        iSimNvmOpen
+ * Description: Loads the EEPROM image from "path", or starts from an erased
+ *              device (all 0xFF) if the file does not exist or is short.
+ *  Parameters: - const char *path:     image file, NULL to keep it in memory only
+ *  Return:     - int:  0, or -1 if the file cannot be opened
+ *****************************************************************************/
+int iSimNvmOpen(const char *path)
+{
+    ssize_t n;
+
+    memset(image, 0xFF, sizeof(image));
+
+    if (path == NULL) return 0;
+
+    imageFd = open(path, O_RDWR | O_CREAT, 0644);
+    if (imageFd < 0) return -1;
+
+    n = pread(imageFd, image, sizeof(image), 0);
+    if (n < (ssize_t)sizeof(image))
+    {
+        if (n < 0) n = 0;
+        memset(&image[n], 0xFF, sizeof(image) - n);
+        if (pwrite(imageFd, image, sizeof(image), 0) != sizeof(image)) return -1;
+    }
+
+    return 0;
+}
+
+// initialise the Serial EEPROM
+void InitNVM(void)
+{
+}
+
+// read a 16-bit value starting at an even address
+int iReadNVM(int address)
+{
+    unsigned char b[2];
+
+    prvRead(address & ~1, b, 2);
+    return (int16_t)((b[0] << 8) | b[1]);
+}
+
+// write a 16-bit value of type int starting at an even address
+void iWriteNVM(int address, int data)
+{
+    unsigned char b[2];
+
+    b[0] = data >> 8;
+    b[1] = data;
+    prvWrite(address & ~1, b, 2);
+}
+
+// read a 32-bit value starting at an even address
+long lReadNVM(int address)
+{
+    unsigned char b[4];
+
+    prvRead(address & ~1, b, 4);
+    return (int32_t)(((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3]);
+}
+
+// write a 32-bit value of type long starting at an even address
+void lWriteNVM(int address, long data)
+{
+    unsigned char b[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        b[i] = data >> (24 - 8 * i);
+    prvWrite(address & ~1, b, 4);
+}
+
+// read a 64-bit value starting at an even address
+long long llReadNVM(int address)
+{
+    unsigned char b[8];
+    unsigned long long v = 0;
+    int i;
+
+    prvRead(address & ~1, b, 8);
+    for (i = 0; i < 8; i++)
+        v = (v << 8) | b[i];
+    return (long long)v;
+}
+
+// write a 64-bit value of type long long starting at an even address
+void llWriteNVM(int address, long long data)
+{
+    unsigned char b[8];
+    int i;
+
+    for (i = 0; i < 8; i++)
+        b[i] = data >> (56 - 8 * i);
+    prvWrite(address & ~1, b, 8);
+}
+
+// read "len" bytes starting at any address
+void vReadNVMBlock(int address, unsigned char *data, int len)
+{
+    prvRead(address, data, len);
+}
+
+// write "len" bytes in a single write cycle
+// NOTE: the block must not cross a 64 byte page boundary
+void vWriteNVMBlock(int address, const unsigned char *data, int len)
+{
+    prvWrite(address, data, len);
+}
@@ -0,0 +1,248 @@
+/******************************************************************************
+ * File:        pmp_lcd.c
+ * Description: Host stand-in of the Explorer16 LCD. Models the display RAM and
+ *              address counter of the HD44780 controller, so the commands sent
+ *              by the real driver functions have the same effect, and prints
+ *              the 2 x 16 visible characters whenever they change.
+ *
+ *              Tasks only update the model, printing is done from the tick
+ *              hook: a line 1 / line 2 update made in one go shows up as a
+ *              single new screen, and no task ever holds the stdio lock.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "../../Source/include/FreeRTOS.h"
+#include "include/pmp_lcd.h"
+#include "include/uart.h"
+#include "include/sim.h"
+
+#define LCD_COLS        16          // visible characters per line
+#define LCD_LINE_LEN    40          // display RAM per line
+#define LCD_LINE2       0x40        // display RAM address of line 2
+
+// HD44780 instructions
+#define LCD_CLEAR       0x01
+#define LCD_HOME        0x02
+#define LCD_ENTRY       0x04        // bit 1: increment address
+#define LCD_DISPLAY     0x08        // bit 2: display on
+#define LCD_OTHER       0x70        // shift, function set, CGRAM address: no visible effect
+#define LCD_SET_DDRAM   0x80
+
+unsigned long _uLCDloops;
+
+static char ddram[2][LCD_LINE_LEN];
+static unsigned char addr;          // address counter, 0x00-0x27 and 0x40-0x67
+static char increment = 1;
+static char displayOn;
+static volatile char dirty;
+
+static char shown[2][LCD_COLS + 1];
+static FILE *lcdOut;
+static int lcdRedraw;
+static int lcdDrawn;
+
+/******************************************************************************
+ * Name:        prvCommand
+ * Description: Executes an instruction written to the LCD command register.
+ *  Parameters: - unsigned char cmd:    instruction
+ *  Return:     None
+ *****************************************************************************/
+static void prvCommand(unsigned char cmd)
+{
+    if (cmd & LCD_SET_DDRAM)
+    {
+        addr = cmd & 0x7F;
+        if ((addr & ~LCD_LINE2) >= LCD_LINE_LEN) addr &= LCD_LINE2;
+    }
+    else if (cmd & LCD_OTHER)
+    {
+    }
+    else if (cmd & LCD_DISPLAY)
+    {
+        displayOn = (cmd & 0x04) != 0;
+        dirty = 1;
+    }
+    else if (cmd & LCD_ENTRY)
+    {
+        increment = (cmd & 0x02) != 0;
+    }
+    else if (cmd & LCD_HOME)
+    {
+        addr = 0;
+    }
+    else if (cmd & LCD_CLEAR)
+    {
+        memset(ddram, ' ', sizeof(ddram));
+        addr = 0;
+        increment = 1;
+        dirty = 1;
+    }
+}
+
+/******************************************************************************
+ * Name:        prvData
+ * Description: Stores a char at the address counter and moves the counter,
+ *              which runs from the end of a line to the start of the other.
+ *  Parameters: - char c:   char written to the LCD data register
+ *  Return:     None
+ *****************************************************************************/
+static void prvData(char c)
+{
+    int line = (addr & LCD_LINE2) ? 1 : 0;
+    int col = addr & ~LCD_LINE2;
+
+    ddram[line][col] = c;
+    dirty = 1;
+
+    if (increment)
+    {
+        if (++col == LCD_LINE_LEN) { col = 0; line ^= 1; }
+    }
+    else
+    {
+        if (col-- == 0) { col = LCD_LINE_LEN - 1; line ^= 1; }
+    }
+
+    addr = (line ? LCD_LINE2 : 0) | col;
+}
+
+void pmp_Init(void)
+{
+}
+
+void LCDInit(void)
+{
+    pmp_Init();
+    prvCommand(0b00111000);         // Set the default function
+    prvCommand(0b00001100);         // Display on
+    prvCommand(0b00000001);         // Clear the display
+    prvCommand(0b00000110);         // Set the entry mode
+    LCDClear();
+    LCDHome();
+}
+
+void LCDHome(void)
+{
+    prvCommand(0b00000010);
+}
+
+void LCDL1Home(void)
+{
+    prvCommand(0b10000000);
+}
+
+void LCDL2Home(void)
+{
+    prvCommand(0b11000000);
+}
+
+void LCDClear(void)
+{
+    prvCommand(0b00000001);
+}
+
+void LCDPut(char A)
+{
+    prvData(A);
+}
+
+void Wait(unsigned int B)
+{
+    (void)B;
+}
+
+void DisplayMSG(char *array)
+{
+    unsigned char i = 0, line = 1;
+
+    LCDL1Home();
+    while (*array)           // Continue display characters from STRING untill NULL character appears.
+    {
+        LCDPut(*array++);  // Display selected character from the STRING.
+        if (i > 19 && line == 1)
+        {
+            LCDL2Home();
+            line++;
+        }
+        i++;
+    }
+}
+
+void LCDPutString(char *array)
+{
+    while (*array)           // Continue display characters from STRING untill NULL character appears.
+    {
+        LCDPut(*array++);  // Display selected character from the STRING.
+    }
+}
+
+void LCDPos2(unsigned char row)
+{
+    prvCommand(0b11000000 | row);
+}
+
+void LCDPos1(unsigned char row)
+{
+    prvCommand(0b10000000 | row);
+}
+
+/******************************************************************************
+ * Name:        vSimLcdOpen
+ * Description: Selects where the LCD screens are printed.
+ *  Parameters: - FILE *out:    terminal or log file, NULL for no output
+ *              - int redraw:   1 to redraw the screen in place (terminal),
+ *                              0 to print one time stamped line per screen
+ *  Return:     None
+ *****************************************************************************/
+void vSimLcdOpen(FILE *out, int redraw)
+{
+    lcdOut = out;
+    lcdRedraw = redraw;
+}
+
+/******************************************************************************
+ * Name:        vSimLcdTick
+ * Description: Called from the tick hook, prints the visible characters if
+ *              they changed since the last call.
+ *  Parameters: - unsigned long ms: simulated time since the scheduler started
+ *  Return:     None
+ *****************************************************************************/
+void vSimLcdTick(unsigned long ms)
+{
+    char now[2][LCD_COLS + 1];
+    int i, j;
+
+    if (!dirty || lcdOut == NULL) return;
+    dirty = 0;
+
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < LCD_COLS; j++)
+        {
+            now[i][j] = (displayOn && ddram[i][j] >= ' ' && ddram[i][j] < 0x7F) ? ddram[i][j] : ' ';
+        }
+        now[i][LCD_COLS] = '\0';
+    }
+
+    if (memcmp(now, shown, sizeof(now)) == 0) return;
+    memcpy(shown, now, sizeof(now));
+
+    if (lcdRedraw)
+    {
+        if (lcdDrawn) fputs("\033[2F", lcdOut);     // back to the start of the screen
+        fprintf(lcdOut, "|%s|\033[K\n|%s|\033[K\n", now[0], now[1]);
+    }
+    else
+    {
+        fprintf(lcdOut, "%9lu ms |%s|%s|\n", ms, now[0], now[1]);
+    }
+
+    fflush(lcdOut);
+    lcdDrawn = 1;
+}
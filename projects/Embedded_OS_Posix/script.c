@@ -0,0 +1,287 @@
+/******************************************************************************
+ * File:        script.c
+ * Description: Stimulus script of the simulator: push buttons, potentiometer
+ *              and UART2 input, applied at given times by the tick hook so a
+ *              run is repeatable. One command per line:
+ *
+ *                  <time> pot <adc code>           set the potentiometer, 0-1023
+ *                  <time> press <S3|S4|S5|S6> [ms] hold a button down, 200 ms by default
+ *                  <time> uart <text>              send text to UART2, C escapes
+ *                                                  (\r \n \t \\ \xNN) are allowed
+ *                  <time> quit                     end the simulation
+ *                  <time> mark                     start of the repeated part
+ *                  <time> repeat [count]           go back to the mark (or the
+ *                                                  first command) until the part
+ *                                                  ran count times, 0 or no count
+ *                                                  repeats forever
+ *
+ *              <time> is in ms since the scheduler started, or "+ms" after
+ *              the previous command. Lines starting with # are comments.
+ *              A repeated part is replayed with the same spacing, shifted to
+ *              the time the repeat command was reached.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created
+ *   "      "       Oct 19 2026     v1.1.0  -   mark / repeat commands for soak tests
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../Source/include/FreeRTOS.h"
+#include "include/public.h"
+#include "include/uart.h"
+#include "include/COMM2.h"
+#include "include/sim.h"
+
+#define SCRIPT_LINE_LEN     256
+#define PRESS_DEFAULT_MS    200     // longer than POLL_DELAY_MS so vTaskPoll sees the press
+
+enum { CMD_POT, CMD_PRESS, CMD_UART, CMD_QUIT, CMD_MARK, CMD_REPEAT };
+enum { BTN_S3, BTN_S4, BTN_S5, BTN_S6, BTN_COUNT };
+
+// One script command
+typedef struct
+{
+    unsigned long time;     // ms since the scheduler started
+    char cmd;               // CMD_xxx
+    char button;            // BTN_xxx of CMD_PRESS
+    long arg;               // pot code, hold time of CMD_PRESS, or count of CMD_REPEAT
+    char *text;             // bytes of CMD_UART
+    int len;
+
+} ScriptCmd_t;
+
+static ScriptCmd_t *script;
+static int scriptLen, scriptNext;
+static int scriptMark;                      // first command of the repeated part
+static unsigned long scriptOffset;          // added to the command times, grows on each repeat
+static unsigned long passes = 1;            // runs of the repeated part
+static unsigned long release[BTN_COUNT];    // time a held button is released, 0 if released
+static char quit;
+
+/******************************************************************************
+ * Name:        prvSetButton
+ * Description: Drives the input of a push button, low while it is pressed.
+ *  Parameters: - int button:   BTN_xxx
+ *              - int pressed:  1 to press, 0 to release
+ *  Return:     None
+ *****************************************************************************/
+static void prvSetButton(int button, int pressed)
+{
+    switch (button)
+    {
+        case BTN_S3: S3 = !pressed; break;
+        case BTN_S4: S4 = !pressed; break;
+        case BTN_S5: S5 = !pressed; break;
+        case BTN_S6: S6 = !pressed; break;
+    }
+}
+
+/******************************************************************************
+ * Name:        prvUnescape
+ * Description: Replaces the C escapes of a string by the bytes they stand for.
+ *  Parameters: - char *s:  string, modified in place
+ *  Return:     - int:      number of bytes, the result may contain '\0'
+ *****************************************************************************/
+static int prvUnescape(char *s)
+{
+    char *start = s, *out = s, *end;
+    char hex[3] = { 0 };
+
+    while (*s)
+    {
+        if (*s != '\\' || s[1] == '\0') { *out++ = *s++; continue; }
+
+        s++;
+        switch (*s)
+        {
+            case 'r': *out++ = '\r'; s++; break;
+            case 'n': *out++ = '\n'; s++; break;
+            case 't': *out++ = '\t'; s++; break;
+            case 'x':
+                hex[0] = s[1];
+                hex[1] = hex[0] ? s[2] : '\0';
+                *out++ = (char)strtol(hex, &end, 16);
+                s += 1 + (end - hex);
+                break;
+            default:  *out++ = *s++; break;
+        }
+    }
+
+    return out - start;
+}
+
+/******************************************************************************
+ * Name:        iSimScriptLoad
+ * Description: Reads a script file.
+ *  Parameters: - const char *path: script file
+ *  Return:     - int:  number of commands, or -1 (error printed on stderr)
+ *****************************************************************************/
+int iSimScriptLoad(const char *path)
+{
+    char line[SCRIPT_LINE_LEN], name[16], *p, *end;
+    unsigned long time = 0;
+    ScriptCmd_t *c;
+    FILE *f;
+    int n = 0, mark = 0;
+
+    f = fopen(path, "r");
+    if (f == NULL) { perror(path); return -1; }
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        n++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        p = line + strspn(line, " \t");
+        if (*p == '\0' || *p == '#') continue;
+
+        // time, absolute or relative to the previous command
+        if (*p == '+') time += strtoul(p + 1, &end, 10);
+        else time = strtoul(p, &end, 10);
+        if (end == p || (*p == '+' && end == p + 1)) goto error;
+
+        p = end + strspn(end, " \t");
+        if (sscanf(p, "%15s", name) != 1) goto error;
+        p += strlen(name);
+        p += strspn(p, " \t");
+
+        script = realloc(script, (scriptLen + 1) * sizeof(*script));
+        c = &script[scriptLen];
+        memset(c, 0, sizeof(*c));
+        c->time = time;
+
+        if (strcmp(name, "pot") == 0)
+        {
+            c->cmd = CMD_POT;
+            c->arg = strtol(p, &end, 0);
+            if (end == p) goto error;
+        }
+        else if (strcmp(name, "press") == 0)
+        {
+            c->cmd = CMD_PRESS;
+            if (p[0] != 'S' || p[1] < '3' || p[1] > '6') goto error;
+            c->button = (p[1] == '3') ? BTN_S3 : (p[1] == '4') ? BTN_S4 : (p[1] == '5') ? BTN_S5 : BTN_S6;
+            c->arg = strtol(p + 2, &end, 0);
+            if (end == p + 2) c->arg = PRESS_DEFAULT_MS;
+        }
+        else if (strcmp(name, "uart") == 0)
+        {
+            c->cmd = CMD_UART;
+            c->text = strdup(p);
+            c->len = prvUnescape(c->text);
+        }
+        else if (strcmp(name, "quit") == 0)
+        {
+            c->cmd = CMD_QUIT;
+        }
+        else if (strcmp(name, "mark") == 0)
+        {
+            c->cmd = CMD_MARK;
+            mark = scriptLen;
+        }
+        else if (strcmp(name, "repeat") == 0)
+        {
+            c->cmd = CMD_REPEAT;
+            c->arg = strtol(p, &end, 0);
+
+            // the repeated part must take some time, or it would never end
+            if (c->arg < 0 || time <= script[mark].time) goto error;
+        }
+        else goto error;
+
+        scriptLen++;
+    }
+
+    fclose(f);
+    return scriptLen;
+
+error:
+    fprintf(stderr, "%s:%d: bad command\n", path, n);
+    fclose(f);
+    return -1;
+}
+
+/******************************************************************************
+ * Name:        vSimScriptTick
+ * Description: Called from the tick hook, applies the commands that are due.
+ *  Parameters: - unsigned long ms: simulated time since the scheduler started
+ *  Return:     None
+ *****************************************************************************/
+void vSimScriptTick(unsigned long ms)
+{
+    ScriptCmd_t *c;
+    int i;
+
+    for (i = 0; i < BTN_COUNT; i++)
+    {
+        if (release[i] != 0 && ms >= release[i])
+        {
+            prvSetButton(i, 0);
+            release[i] = 0;
+        }
+    }
+
+    while (scriptNext < scriptLen && script[scriptNext].time + scriptOffset <= ms)
+    {
+        c = &script[scriptNext++];
+
+        switch (c->cmd)
+        {
+            case CMD_POT:
+                vSimSetPot(c->arg);
+                break;
+
+            case CMD_PRESS:
+                prvSetButton(c->button, 1);
+                release[(int)c->button] = ms + (c->arg > 0 ? c->arg : 1);
+                break;
+
+            case CMD_UART:
+                vSimUartRx(COMM2_PORT, c->text, c->len);
+                break;
+
+            case CMD_QUIT:
+                quit = 1;
+                break;
+
+            case CMD_MARK:
+                scriptMark = scriptNext - 1;
+                break;
+
+            case CMD_REPEAT:
+                if (c->arg == 0 || passes < (unsigned long)c->arg)
+                {
+                    passes++;
+                    scriptOffset += c->time - script[scriptMark].time;
+                    scriptNext = scriptMark;
+                }
+                break;
+        }
+    }
+}
+
+/******************************************************************************
+ * Name:        iSimScriptDone
+ * Description: Tells if the script asked to end the simulation.
+ *  Parameters: None
+ *  Return:     - int:  1 once "quit" was executed
+ *****************************************************************************/
+int iSimScriptDone(void)
+{
+    return quit;
+}
+
+/******************************************************************************
+ * Name:        ulSimScriptPasses
+ * Description: Tells how many times the repeated part of the script ran.
+ *  Parameters: None
+ *  Return:     - unsigned long:    number of passes, 1 without repeat
+ *****************************************************************************/
+unsigned long ulSimScriptPasses(void)
+{
+    return passes;
+}
@@ -0,0 +1,593 @@
+/******************************************************************************
+ * File:        uart.c
+ * Description: Host stand-in of the UART driver (same interface as
+ *              ../Embedded_OS/uart.c). Every opened port is a pseudo terminal,
+ *              a terminal program or tools/telemetry_host can be attached to
+ *              the slave side printed at start up.
+ *
+ *              The RX stream buffer, TX ring buffer and TX semaphore are the
+ *              same as on the target. The "shift registers" are emulated by the tick hook,
+ *              which moves as many bytes per tick as the baud rate allows,
+ *              so tasks see the same blocking and buffer levels as on the
+ *              board. A reader thread per port stores the bytes read from the
+ *              pty in a host side FIFO until the tick hook picks them up.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Author        	Date                    Comments on this revision
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Samson Kaller    Oct 19 2026     v1.0.0  -   Created for the POSIX simulator
+ *   "      "       Oct 19 2026     v1.1.0  -   Added vSimUartEcho()
+ *   "      "       Oct 19 2026     v1.2.0  -   RX stream buffer, as on the target
+ *   "      "       Oct 19 2026     v1.3.0  -   RX stream buffer and TX semaphore created
+ *                                              statically in the port structure
+ *   "      "       Oct 19 2026     v1.4.0  -   iUartWrite() straight to the pty before the
+ *                                              scheduler starts, as the target polls
+ *****************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "../../Source/include/FreeRTOS.h"
+#include "../../Source/include/task.h"
+#include "../../Source/include/semphr.h"
+#include "../../Source/include/stream_buffer.h"
+#include "include/uart.h"
+#include "include/sim.h"
+
+/*****************************************************************************/
+/*********************************** MACROS **********************************/
+/*****************************************************************************/
+
+#define TX_MASK     (UART_TX_BUFF_SIZE - 1)
+#define FIFO_MASK   (SIM_RX_FIFO_SIZE - 1)
+
+#if (UART_TX_BUFF_SIZE & TX_MASK) || (SIM_RX_FIFO_SIZE & FIFO_MASK)
+#error UART_TX_BUFF_SIZE and SIM_RX_FIFO_SIZE must be powers of 2
+#endif
+
+#define BIT_TIMES_PER_CHAR  10      // start, 8 data, stop
+
+// Driver state for one port, as in the target driver plus the pty
+typedef struct
+{
+    StreamBufferHandle_t xRxStream; // written by the tick hook, wakes the reader on the first byte
+    StaticStreamBuffer_t xRxStreamBuffer;
+    uint8_t rxStorage[UART_RX_BUFF_SIZE + 1];   // a stream buffer keeps one byte free
+
+    char txBuff[UART_TX_BUFF_SIZE];
+    volatile unsigned int txHead, txTail;
+
+    xSemaphoreHandle xTxSem;    // given by the tick hook when space is freed
+    StaticSemaphore_t xTxSemBuffer;
+
+    UartStats_t stats;
+    unsigned long baud;
+    unsigned long rxCredit;     // bit times available to receive / send, in baud ticks
+    unsigned long txCredit;
+    char flowControl;
+    volatile char rxHeld;       // RX "interrupt" held off by vUartInjectRx()
+    char open;
+
+    int master, slave;          // pty, the slave is kept open so reads never fail
+    FILE *echo;                 // copy of the TX bytes, see vSimUartEcho()
+    char ptyName[64];
+    pthread_t reader;
+
+    // bytes read from the pty, written by the reader thread, read by the tick hook
+    pthread_mutex_t fifoMutex;
+    char fifo[SIM_RX_FIFO_SIZE];
+    unsigned int fifoHead, fifoTail;
+
+} Uart_t;
+
+static Uart_t uart[UART_PORT_COUNT];
+
+/******************************************************************************
+********************* Private static function declarations ********************
+******************************************************************************/
+
+static int prvOpenPty(Uart_t *u);
+static void *prvReader(void *pvParameters);
+static void prvFifoPut(Uart_t *u, const char *buf, int len);
+static unsigned int prvCharsThisTick(Uart_t *u, unsigned long *credit, unsigned int pending);
+static void prvTick(Uart_t *u);
+
+/******************************************************************************
+ * Name:        prvOpenPty
+ * Description: Creates the pseudo terminal of a port, in raw mode, and starts
+ *              its reader thread.
+ *  Parameters: - Uart_t *u:    port
+ *  Return:     - int:  0, or -1 if no pty could be created
+ *****************************************************************************/
+static int prvOpenPty(Uart_t *u)
+{
+    struct termios tio;
+
+    u->master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (u->master < 0) return -1;
+
+    if (grantpt(u->master) != 0 || unlockpt(u->master) != 0 ||
+        ptsname_r(u->master, u->ptyName, sizeof(u->ptyName)) != 0)
+    {
+        close(u->master);
+        return -1;
+    }
+
+    u->slave = open(u->ptyName, O_RDWR | O_NOCTTY);
+    if (u->slave >= 0 && tcgetattr(u->slave, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(u->slave, TCSANOW, &tio);
+    }
+
+    // bytes that cannot be sent because nobody reads the slave are dropped
+    fcntl(u->master, F_SETFL, fcntl(u->master, F_GETFL) | O_NONBLOCK);
+
+    pthread_mutex_init(&u->fifoMutex, NULL);
+    pthread_create(&u->reader, NULL, prvReader, u);
+
+    return 0;
+}
+
+/******************************************************************************
+ * Name:        prvReader
+ * Description: Reader thread of a port, not a task. Waits for bytes on the pty
+ *              and stores them in the FIFO.
+ *  Parameters: - void *pvParameters:   Uart_t of the port
+ *  Return:     None
+ *****************************************************************************/
+static void *prvReader(void *pvParameters)
+{
+    Uart_t *u = (Uart_t *)pvParameters;
+    char buf[256];
+    fd_set fds;
+    int n;
+
+    for (;;)
+    {
+        FD_ZERO(&fds);
+        FD_SET(u->master, &fds);
+        if (select(u->master + 1, &fds, NULL, NULL, NULL) < 0) continue;
+
+        n = read(u->master, buf, sizeof(buf));
+        if (n > 0) prvFifoPut(u, buf, n);
+    }
+
+    return NULL;
+}
+
+/******************************************************************************
+ * Name:        prvFifoPut
+ * Description: Appends received bytes to the FIFO, bytes that do not fit are
+ *              counted as overruns.
+ *  Parameters: - Uart_t *u:        port
+ *              - const char *buf:  received bytes
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+static void prvFifoPut(Uart_t *u, const char *buf, int len)
+{
+    int i;
+
+    pthread_mutex_lock(&u->fifoMutex);
+
+    for (i = 0; i < len; i++)
+    {
+        if (u->fifoHead - u->fifoTail >= SIM_RX_FIFO_SIZE)
+        {
+            u->stats.overruns++;
+            continue;
+        }
+
+        u->fifo[u->fifoHead++ & FIFO_MASK] = buf[i];
+    }
+
+    pthread_mutex_unlock(&u->fifoMutex);
+}
+
+/******************************************************************************
+ * Name:        prvCharsThisTick
+ * Description: Number of chars the line can carry during this tick. Credit is
+ *              not saved up while the line is idle, so a burst starts at the
+ *              normal rate.
+ *  Parameters: - Uart_t *u:                port
+ *              - unsigned long *credit:    rxCredit or txCredit
+ *              - unsigned int pending:     chars waiting to be moved
+ *  Return:     - unsigned int:             chars to move
+ *****************************************************************************/
+static unsigned int prvCharsThisTick(Uart_t *u, unsigned long *credit, unsigned int pending)
+{
+    const unsigned long perChar = BIT_TIMES_PER_CHAR * configTICK_RATE_HZ;
+    unsigned long n;
+
+    *credit += u->baud;
+    n = *credit / perChar;
+
+    if (n >= pending)
+    {
+        n = pending;
+        if (*credit - n * perChar > perChar) *credit = perChar + n * perChar;
+    }
+
+    *credit -= n * perChar;
+
+    return n;
+}
+
+/******************************************************************************
+ * Name:        prvTick
+ * Description: Emulates the RX and TX interrupts of a port for one tick.
+ *  Parameters: - Uart_t *u:    port
+ *  Return:     None
+ *****************************************************************************/
+static void prvTick(Uart_t *u)
+{
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+    char buf[UART_TX_BUFF_SIZE];
+    char rx[UART_RX_BUFF_SIZE];
+    unsigned int n, i, space, level, stored = 0;
+
+    // TX: ring buffer to the pty
+    n = prvCharsThisTick(u, &u->txCredit, u->txHead - u->txTail);
+    if (n > 0)
+    {
+        for (i = 0; i < n; i++)
+            buf[i] = u->txBuff[u->txTail++ & TX_MASK];
+
+        if (write(u->master, buf, n) < 0) { /* nobody listening, the bytes are lost */ }
+        if (u->echo != NULL) fwrite(buf, 1, n, u->echo);
+
+        u->stats.txBytes += n;
+        xSemaphoreGiveFromISR(u->xTxSem, &xHigherPriorityTaskWoken);
+    }
+
+    // RX: FIFO to the stream buffer, one write per tick like one per interrupt on the target
+    if (u->rxHeld) n = 0;
+    else
+    {
+        pthread_mutex_lock(&u->fifoMutex);
+
+        n = prvCharsThisTick(u, &u->rxCredit, u->fifoHead - u->fifoTail);
+        space = xStreamBufferSpacesAvailable(u->xRxStream);
+        for (i = 0; i < n; i++)
+        {
+            if (stored >= space)
+            {
+                // with flow control, RTS is de-asserted and the sender waits
+                if (u->flowControl == UART_FLOW_RTS_CTS) break;
+
+                u->fifoTail++;
+                u->stats.rxDropped++;
+                continue;
+            }
+
+            rx[stored++] = u->fifo[u->fifoTail++ & FIFO_MASK];
+        }
+
+        pthread_mutex_unlock(&u->fifoMutex);
+    }
+
+    if (stored > 0)
+    {
+        xStreamBufferSendFromISR(u->xRxStream, rx, stored, &xHigherPriorityTaskWoken);
+        u->stats.rxBytes += stored;
+
+        level = xStreamBufferBytesAvailable(u->xRxStream);
+        if (level > u->stats.rxHighWater) u->stats.rxHighWater = level;
+    }
+
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/******************************************************************************
+*************************** Public function declarations **********************
+******************************************************************************/
+
+/******************************************************************************
+ * Name:        iUartOpen
+ * Description: Configures a port. The pty is created the first time the port
+ *              is opened and its name printed on stderr.
+ *  Parameters: - UartPort_t port:              UART instance
+ *              - const UartConfig_t *config:   baud rate and flow control
+ *  Return:     - int:  UART_OK, UART_ERR_PORT or UART_ERR_BAUD
+ *****************************************************************************/
+int iUartOpen(UartPort_t port, const UartConfig_t *config)
+{
+    Uart_t *u;
+
+    if (port >= UART_PORT_COUNT) return UART_ERR_PORT;
+    if (config->baud == 0 || config->baud > UART_MAX_BAUD) return UART_ERR_BAUD;
+
+    u = &uart[port];
+
+    if (u->ptyName[0] == '\0')
+    {
+        if (prvOpenPty(u) != 0) return UART_ERR_PORT;
+        fprintf(stderr, "UART%d on %s\n", port + 1, u->ptyName);
+    }
+
+    // kernel objects are only created once, a port can be re-opened with new settings
+    if (u->xRxStream == NULL) u->xRxStream = xStreamBufferCreateStatic(UART_RX_BUFF_SIZE, 1, u->rxStorage, &u->xRxStreamBuffer);
+    if (u->xTxSem == NULL) u->xTxSem = xSemaphoreCreateBinaryStatic(&u->xTxSemBuffer);
+
+    taskENTER_CRITICAL();
+    xStreamBufferReset(u->xRxStream);
+    u->txHead = u->txTail = 0;
+    u->rxCredit = u->txCredit = 0;
+    u->flowControl = config->flowControl;
+    u->baud = config->baud;
+    memset(&u->stats, 0, sizeof(u->stats));
+    u->open = 1;
+    taskEXIT_CRITICAL();
+
+    return UART_OK;
+}
+
+/******************************************************************************
+ * Name:        iUartSetBaud
+ * Description: Changes the baud rate of an open port once the TX ring buffer
+ *              is empty.
+ *  Parameters: - UartPort_t port:      UART instance
+ *              - unsigned long baud:   new baud rate, up to UART_MAX_BAUD
+ *  Return:     - int:  UART_OK, UART_ERR_PORT or UART_ERR_BAUD
+ *****************************************************************************/
+int iUartSetBaud(UartPort_t port, unsigned long baud)
+{
+    Uart_t *u;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+    if (baud == 0 || baud > UART_MAX_BAUD) return UART_ERR_BAUD;
+
+    u = &uart[port];
+
+    while (u->txTail != u->txHead)
+    {
+        if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) vTaskDelay(1);
+    }
+
+    taskENTER_CRITICAL();
+    u->baud = baud;
+    taskEXIT_CRITICAL();
+
+    return UART_OK;
+}
+
+/******************************************************************************
+ * Name:        ulUartGetBaud
+ * Description: Returns the baud rate a port is running at.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     - unsigned long:    baud rate, 0 if the port is not open
+ *****************************************************************************/
+unsigned long ulUartGetBaud(UartPort_t port)
+{
+    if (port >= UART_PORT_COUNT || !uart[port].open) return 0;
+
+    return uart[port].baud;
+}
+
+/******************************************************************************
+ * Name:        iUartWrite
+ * Description: Queues "len" bytes for transmission. Blocks while the TX ring
+ *              buffer is full.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *buf:  bytes to send
+ *              - int len:          number of bytes
+ *  Return:     - int:  number of bytes queued, or UART_ERR_PORT
+ *****************************************************************************/
+int iUartWrite(UartPort_t port, const char *buf, int len)
+{
+    Uart_t *u;
+    int i;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+
+    u = &uart[port];
+
+    // the target polls UxTXREG before the scheduler starts, no tick drains the ring
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+    {
+        if (write(u->master, buf, len) < 0) { /* nobody listening, the bytes are lost */ }
+        if (u->echo != NULL) fwrite(buf, 1, len, u->echo);
+        u->stats.txBytes += len;
+
+        return len;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        // ring buffer full, let the tick hook drain it
+        while ((unsigned int)(u->txHead - u->txTail) >= UART_TX_BUFF_SIZE)
+        {
+            if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) xSemaphoreTake(u->xTxSem, portMAX_DELAY);
+        }
+
+        u->txBuff[u->txHead & TX_MASK] = buf[i];
+        u->txHead++;
+    }
+
+    return len;
+}
+
+/******************************************************************************
+ * Name:        vUartPutc
+ * Description: Queues a single char for transmission.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - char c:           char to send
+ *  Return:     None
+ *****************************************************************************/
+void vUartPutc(UartPort_t port, char c)
+{
+    iUartWrite(port, &c, 1);
+}
+
+/******************************************************************************
+ * Name:        vUartPuts
+ * Description: Queues a null terminated string for transmission.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *str:  string to send
+ *  Return:     None
+ *****************************************************************************/
+void vUartPuts(UartPort_t port, const char *str)
+{
+    iUartWrite(port, str, strlen(str));
+}
+
+/******************************************************************************
+ * Name:        iUartRead
+ * Description: Reads up to "len" received bytes. Blocks up to xTicksToWait for
+ *              the first byte, then returns whatever is available.
+ *  Parameters: - UartPort_t port:          UART instance
+ *              - char *buf:                destination buffer
+ *              - int len:                  maximum number of bytes to read
+ *              - TickType_t xTicksToWait:  block time if no byte is available
+ *  Return:     - int:  number of bytes read (0 on timeout), or UART_ERR_PORT
+ *****************************************************************************/
+int iUartRead(UartPort_t port, char *buf, int len, TickType_t xTicksToWait)
+{
+    if (port >= UART_PORT_COUNT || !uart[port].open) return UART_ERR_PORT;
+
+    return xStreamBufferReceive(uart[port].xRxStream, buf, len, xTicksToWait);
+}
+
+/******************************************************************************
+ * Name:        iUartGetc
+ * Description: Reads a single received char.
+ *  Parameters: - UartPort_t port:          UART instance
+ *              - char *c:                  destination
+ *              - TickType_t xTicksToWait:  block time if no char is available
+ *  Return:     - int:  1 if a char was read, 0 on timeout, or UART_ERR_PORT
+ *****************************************************************************/
+int iUartGetc(UartPort_t port, char *c, TickType_t xTicksToWait)
+{
+    return iUartRead(port, c, 1, xTicksToWait);
+}
+
+/******************************************************************************
+ * Name:        vUartInjectRx
+ * Description: Places bytes in the RX stream buffer as if they had been received.
+ *              The tick hook leaves the stream buffer alone meanwhile, as the
+ *              RX interrupt is held off on the target. Bytes that do not fit
+ *              are dropped.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *buf:  bytes to inject
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+void vUartInjectRx(UartPort_t port, const char *buf, int len)
+{
+    Uart_t *u;
+    int n;
+
+    if (port >= UART_PORT_COUNT || !uart[port].open) return;
+
+    u = &uart[port];
+
+    u->rxHeld = 1;
+
+    n = xStreamBufferSend(u->xRxStream, buf, len, 0);
+    u->stats.rxDropped += len - n;
+
+    u->rxHeld = 0;
+}
+
+/******************************************************************************
+ * Name:        vUartGetStats
+ * Description: Copies the statistics of a port.
+ *  Parameters: - UartPort_t port:      UART instance
+ *              - UartStats_t *stats:   destination
+ *  Return:     None
+ *****************************************************************************/
+void vUartGetStats(UartPort_t port, UartStats_t *stats)
+{
+    if (port >= UART_PORT_COUNT) return;
+
+    taskENTER_CRITICAL();
+    *stats = uart[port].stats;
+    taskEXIT_CRITICAL();
+}
+
+/******************************************************************************
+ * Name:        vSimUartTick
+ * Description: Called from the tick hook, moves the bytes of every open port.
+ *  Parameters: None
+ *  Return:     None
+ *****************************************************************************/
+void vSimUartTick(void)
+{
+    int port;
+
+    for (port = 0; port < UART_PORT_COUNT; port++)
+    {
+        if (uart[port].open) prvTick(&uart[port]);
+    }
+}
+
+/******************************************************************************
+ * Name:        vSimUartRx
+ * Description: Feeds bytes to a port as if they had been written to its pty.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - const char *buf:  bytes
+ *              - int len:          number of bytes
+ *  Return:     None
+ *****************************************************************************/
+void vSimUartRx(UartPort_t port, const char *buf, int len)
+{
+    if (port >= UART_PORT_COUNT || !uart[port].open) return;
+
+    prvFifoPut(&uart[port], buf, len);
+}
+
+/******************************************************************************
+ * Name:        pcSimUartPty
+ * Description: Returns the slave side of the pty of a port.
+ *  Parameters: - UartPort_t port:  UART instance
+ *  Return:     - const char *:     pty name, NULL if the port was never opened
+ *****************************************************************************/
+const char *pcSimUartPty(UartPort_t port)
+{
+    if (port >= UART_PORT_COUNT || uart[port].ptyName[0] == '\0') return NULL;
+
+    return uart[port].ptyName;
+}
+
+/******************************************************************************
+ * Name:        vSimUartEcho
+ * Description: Copies the bytes sent on a port to a file as well as to the pty.
+ *  Parameters: - UartPort_t port:  UART instance
+ *              - FILE *out:        destination, NULL to stop
+ *  Return:     None
+ *****************************************************************************/
+void vSimUartEcho(UartPort_t port, FILE *out)
+{
+    if (port < UART_PORT_COUNT) uart[port].echo = out;
+}
+
+/******************************************************************************
+ * Name:        vSimUartReport
+ * Description: Prints the statistics of every opened port.
+ *  Parameters: - FILE *out:    destination
+ *  Return:     None
+ *****************************************************************************/
+void vSimUartReport(FILE *out)
+{
+    UartStats_t *s;
+    int port;
+
+    for (port = 0; port < UART_PORT_COUNT; port++)
+    {
+        if (!uart[port].open) continue;
+
+        s = &uart[port].stats;
+        fprintf(out, "UART%d: %lu baud, rx %lu tx %lu, rx dropped %u, overruns %u, rx high water %u/%d\n",
+                port + 1, uart[port].baud, s->rxBytes, s->txBytes, s->rxDropped, s->overruns,
+                s->rxHighWater, UART_RX_BUFF_SIZE);
+    }
+}